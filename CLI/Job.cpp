@@ -0,0 +1,1130 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "Job.hpp"
+#include <Core/Enum/Lead.hpp>
+#include <Core/Enum/Method.hpp>
+#include <Core/Enum/Shiny.hpp>
+#include <Core/Gen3/Encounters3.hpp>
+#include <Core/Gen3/Generators/StaticGenerator3.hpp>
+#include <Core/Gen3/Profile3.hpp>
+#include <Core/Gen3/Searchers/ChannelSeedSearcher.hpp>
+#include <Core/Gen3/Searchers/StaticSearcher3.hpp>
+#include <Core/Gen3/StaticTemplate3.hpp>
+#include <Core/Gen4/Encounters4.hpp>
+#include <Core/Gen4/Generators/StaticGenerator4.hpp>
+#include <Core/Gen4/Profile4.hpp>
+#include <Core/Gen4/Searchers/StaticSearcher4.hpp>
+#include <Core/Gen4/States/State4.hpp>
+#include <Core/Gen4/StaticTemplate4.hpp>
+#include <Core/Gen5/Generators/EventGenerator5.hpp>
+#include <Core/Gen5/IVCache.hpp>
+#include <Core/Gen5/PGF.hpp>
+#include <Core/Gen5/Profile5.hpp>
+#include <Core/Gen5/Searchers/IVCacheSearcher.hpp>
+#include <Core/Gen5/Searchers/Searcher5.hpp>
+#include <Core/Gen5/States/EventState5.hpp>
+#include <Core/Gen5/States/SearcherState5.hpp>
+#include <Core/Gen8/Den.hpp>
+#include <Core/Gen8/Encounters8.hpp>
+#include <Core/Gen8/Generators/RaidGenerator.hpp>
+#include <Core/Gen8/Generators/StaticGenerator8.hpp>
+#include <Core/Gen8/Profile8.hpp>
+#include <Core/Gen8/Searchers/RaidSearcher.hpp>
+#include <Core/Gen8/Searchers/Searcher8.hpp>
+#include <Core/Gen8/States/State8.hpp>
+#include <Core/Gen8/StaticTemplate8.hpp>
+#include <Core/Parents/Filters/StateFilter.hpp>
+#include <Core/Parents/ProfileLoader.hpp>
+#include <Core/Parents/States/State.hpp>
+#include <Core/Util/Checkpoint.hpp>
+#include <Core/Util/DateTime.hpp>
+#include <Core/Util/Manifest.hpp>
+#include <Core/Util/Translator.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <thread>
+
+using json = nlohmann::json;
+
+/**
+ * @brief Hex number with a fixed width for output
+ */
+struct Hex
+{
+    u64 value;
+    int width;
+};
+
+static std::ostream &operator<<(std::ostream &out, const Hex &hex)
+{
+    return out << std::hex << std::uppercase << std::setw(hex.width) << std::setfill('0') << hex.value << std::dec << std::nouppercase;
+}
+
+/**
+ * @brief Reads an integer from the \p job. Strings are read as hex so that seeds can be written the same way the GUI shows them.
+ *
+ * @tparam Integer Integer type to read
+ * @param job Job specification
+ * @param key Key of the integer
+ * @param value Default value if the key is missing
+ *
+ * @return Integer value
+ */
+template <class Integer>
+static Integer getInteger(const json &job, const std::string &key, Integer value = 0)
+{
+    auto it = job.find(key);
+    if (it == job.end())
+    {
+        return value;
+    }
+    else if (it->is_string())
+    {
+        return static_cast<Integer>(std::stoull(it->get<std::string>(), nullptr, 16));
+    }
+    return it->get<Integer>();
+}
+
+/**
+ * @brief Reads a date in the YYYY-MM-DD format from the \p job
+ *
+ * @param job Job specification
+ * @param key Key of the date
+ * @param date Date to store the result in
+ *
+ * @return true Date is valid
+ * @return false Date is missing or invalid
+ */
+static bool getDate(const json &job, const std::string &key, Date &date)
+{
+    unsigned year, month, day;
+    if (std::sscanf(job.value(key, "").data(), "%u-%u-%u", &year, &month, &day) != 3 || year < 2000 || year > 2099 || month < 1
+        || month > 12 || day < 1 || day > Date::daysInMonth(year, month))
+    {
+        std::cerr << "Invalid " << key << " date, expected YYYY-MM-DD between 2000 and 2099" << std::endl;
+        return false;
+    }
+
+    date = Date(year, month, day);
+    return true;
+}
+
+/**
+ * @brief Reads the IVs from the filter of the \p job
+ *
+ * @param job Job specification
+ * @param key Key of the IVs
+ * @param iv Default value of each IV
+ *
+ * @return IVs
+ */
+static std::array<u8, 6> getIVs(const json &job, const std::string &key, u8 iv)
+{
+    return job.value("filter", json::object()).value(key, std::array<u8, 6> { iv, iv, iv, iv, iv, iv });
+}
+
+/**
+ * @brief Reads the minimum and maximum IVs from the filter of the \p job
+ *
+ * @param job Job specification
+ * @param min Minimum IVs to store the result in
+ * @param max Maximum IVs to store the result in
+ *
+ * @return true IV range is valid
+ * @return false An IV is above 31 or its minimum is above its maximum
+ */
+static bool getIVRange(const json &job, std::array<u8, 6> &min, std::array<u8, 6> &max)
+{
+    min = getIVs(job, "ivMin", 0);
+    max = getIVs(job, "ivMax", 31);
+    for (u8 i = 0; i < 6; i++)
+    {
+        if (min[i] > max[i] || max[i] > 31)
+        {
+            std::cerr << "Invalid IV range, expected 0 <= ivMin <= ivMax <= 31" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Reads the number of search threads from the \p job. Defaults to the number of hardware threads.
+ *
+ * @param job Job specification
+ * @param threads Thread count to store the result in
+ *
+ * @return true Thread count is valid
+ * @return false Thread count is below 1
+ */
+static bool getThreads(const json &job, int &threads)
+{
+    threads = job.value("threads", std::max(static_cast<int>(std::thread::hardware_concurrency()), 1));
+    if (threads < 1)
+    {
+        std::cerr << "Invalid thread count, expected at least 1" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Reads the state filter from the \p job. Missing values do not filter anything.
+ *
+ * @param job Job specification
+ *
+ * @return State filter
+ */
+static StateFilter getFilter(const json &job)
+{
+    json filter = job.value("filter", json::object());
+
+    std::array<bool, 25> natures;
+    natures.fill(true);
+    std::array<bool, 16> powers;
+    powers.fill(true);
+
+    return StateFilter(filter.value<u8>("gender", 255), filter.value<u8>("ability", 255), filter.value<u8>("shiny", 255),
+                       filter.value<u8>("levelMin", 1), filter.value<u8>("levelMax", 100), filter.value<u8>("heightMin", 0),
+                       filter.value<u8>("heightMax", 255), filter.value<u8>("weightMin", 0), filter.value<u8>("weightMax", 255),
+                       filter.value("skip", false), getIVs(job, "ivMin", 0), getIVs(job, "ivMax", 31), filter.value("natures", natures),
+                       filter.value("powers", powers));
+}
+
+/**
+ * @brief Reads the profile of the \p job. A missing profile uses the default of every setting.
+ *
+ * @tparam Profile Profile class
+ * @param job Job specification
+ * @param getProfile Function converting JSON text to a profile
+ *
+ * @return Profile if it is valid, otherwise std::nullopt
+ */
+template <class Profile>
+static std::optional<Profile> getProfile(const json &job, std::optional<Profile> (*getProfile)(const std::string &))
+{
+    auto profile = getProfile(job.value("profile", json::object()).dump());
+    if (!profile)
+    {
+        std::cerr << "Invalid profile" << std::endl;
+    }
+    return profile;
+}
+
+/**
+ * @brief Looks up the static encounter selected by the category and pokemon index of the \p job
+ *
+ * @tparam Template Static template class
+ * @param job Job specification
+ * @param getStaticEncounters Function returning the encounters of a category
+ *
+ * @return Static encounter if the indexes are valid, otherwise nullptr
+ */
+template <class Template>
+static const Template *getStaticTemplate(const json &job, const Template *(*getStaticEncounters)(int, int *))
+{
+    int category = job.value("category", 0);
+    int pokemon = job.value("pokemon", 0);
+
+    int size = 0;
+    const Template *templates = category >= 0 ? getStaticEncounters(category, &size) : nullptr;
+    if (!templates || pokemon < 0 || pokemon >= size)
+    {
+        std::cerr << "Invalid static encounter category/pokemon" << std::endl;
+        return nullptr;
+    }
+    return &templates[pokemon];
+}
+
+/**
+ * @brief Writes the column names shared by every state
+ *
+ * @param out Stream to write to
+ */
+static void writeHeader(std::ostream &out)
+{
+    out << "PID\tShiny\tNature\tAbility\tHP\tAtk\tDef\tSpA\tSpD\tSpe\tHidden\tPower\tGender\tLevel\n";
+}
+
+/**
+ * @brief Writes the columns shared by every state
+ *
+ * @param out Stream to write to
+ * @param state State to write
+ */
+static void writeState(std::ostream &out, const State &state)
+{
+    constexpr const char *shiny[3] = { "No", "Star", "Square" };
+
+    out << Hex(state.getPID(), 8) << '\t' << shiny[state.getShiny()] << '\t' << Translator::getNature(state.getNature()) << '\t'
+        << Translator::getAbility(state.getAbilityIndex());
+    for (u8 iv : state.getIVs())
+    {
+        out << '\t' << static_cast<int>(iv);
+    }
+    out << '\t' << Translator::getHiddenPower(state.getHiddenPower()) << '\t' << static_cast<int>(state.getHiddenPowerStrength()) << '\t'
+        << Translator::getGender(state.getGender()) << '\t' << static_cast<int>(state.getLevel()) << '\n';
+}
+
+/**
+ * @brief Runs the \p start function of a searcher on its own thread and calls \p poll while it runs
+ *
+ * @tparam Searcher Searcher class
+ * @tparam Start Function that starts the search
+ * @tparam Poll Function called periodically and once the search is done
+ * @param searcher Searcher to report progress of
+ * @param start Function that starts the search and returns once it is done
+ * @param poll Function called periodically and once the search is done
+ */
+template <class Searcher, class Start, class Poll>
+static void waitSearcher(Searcher &searcher, const Start &start, const Poll &poll)
+{
+    std::atomic<bool> finished = false;
+    std::thread thread([&] {
+        start();
+        finished = true;
+    });
+
+    while (!finished)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(250));
+        poll();
+        std::cerr << "\rProgress: " << searcher.getProgress() << "%" << std::flush;
+    }
+    thread.join();
+
+    poll();
+    std::cerr << "\rProgress: " << searcher.getProgress() << "%" << std::endl;
+}
+
+/**
+ * @brief Runs the \p start function of a searcher on its own thread and writes results as they are found
+ *
+ * @tparam Searcher Searcher class
+ * @tparam Start Function that starts the search
+ * @tparam Write Function that writes a result
+ * @param searcher Searcher to poll results from
+ * @param start Function that starts the search and returns once it is done
+ * @param write Function that writes a result
+ */
+template <class Searcher, class Start, class Write>
+static void runSearcher(Searcher &searcher, const Start &start, const Write &write)
+{
+    waitSearcher(searcher, start, [&] {
+        for (const auto &state : searcher.getResults())
+        {
+            write(state);
+        }
+    });
+}
+
+/**
+ * @brief Runs the \p start function of a searcher that stores packed results on its own thread and writes results as they are found.
+ * Each packed result is regenerated into its full state before being written.
+ *
+ * @tparam Searcher Searcher class
+ * @tparam Start Function that starts the search
+ * @tparam Write Function that writes a result
+ * @param searcher Searcher to poll results from
+ * @param start Function that starts the search and returns once it is done
+ * @param write Function that writes a result
+ */
+template <class Searcher, class Start, class Write>
+static void runPackedSearcher(Searcher &searcher, const Start &start, const Write &write)
+{
+    waitSearcher(searcher, start, [&] {
+        for (const auto &packed : searcher.getPackedResults())
+        {
+            if (auto state = searcher.rehydrate(packed))
+            {
+                write(*state);
+            }
+            else
+            {
+                std::cerr << "Failed to regenerate a packed result" << std::endl;
+            }
+        }
+    });
+}
+
+/**
+ * @brief Computes the key of the search parameters of the \p job. Settings that do not change the results are left out, so every shard
+ * of a search has the same key.
+ *
+ * @param job Job specification
+ *
+ * @return Key
+ */
+static u64 getKey(const json &job)
+{
+    json parameters = job;
+    for (const char *setting : { "directory", "locale", "output", "packed", "shard", "threads" })
+    {
+        parameters.erase(setting);
+    }
+    return Checkpoint::hash(parameters.dump());
+}
+
+/**
+ * @brief Returns the file a sharded search writes the results of a unit to
+ *
+ * @param directory Job directory
+ * @param unit Unit index
+ * @param extension File extension
+ *
+ * @return Unit file
+ */
+static std::filesystem::path getUnitPath(const std::filesystem::path &directory, u32 unit, std::string_view extension)
+{
+    return directory / ("unit-" + std::to_string(unit) + std::string(extension));
+}
+
+/**
+ * @brief Returns the file extension of the unit files of a search type
+ *
+ * @param type Search type
+ *
+ * @return File extension
+ */
+static std::string_view getUnitExtension(std::string_view type)
+{
+    return type == "ivcache5" ? ".bin" : ".tsv";
+}
+
+/**
+ * @brief Runs the work units of a search. Without a shard in the \p job every unit is written to \p out. With a shard each of its
+ * units is written to its own file in the job directory and marked complete in the manifest, so a restarted shard skips the units it
+ * already finished.
+ *
+ * @tparam Run Function that searches units and writes the results to a stream
+ * @param job Job specification
+ * @param out Stream to write to when not sharded
+ * @param manifest Manifest of the whole search
+ * @param run Function that searches units and writes the results to a stream
+ *
+ * @return true Units ran to completion
+ * @return false Shard specification or directory was invalid
+ */
+template <class Run>
+static bool runUnits(const json &job, std::ostream &out, const Manifest &manifest, const Run &run)
+{
+    auto it = job.find("shard");
+    if (it == job.end())
+    {
+        run(manifest.getUnits(), out);
+        return true;
+    }
+
+    u32 units = manifest.getUnits().size();
+    Shard shard;
+    if (it->contains("units"))
+    {
+        auto indexes = it->at("units").get<std::vector<u32>>();
+        if (std::ranges::any_of(indexes, [units](u32 index) { return index >= units; }))
+        {
+            std::cerr << "Invalid shard units, expected indexes below " << units << std::endl;
+            return false;
+        }
+        shard = Shard(indexes);
+    }
+    else
+    {
+        u32 index = it->value<u32>("index", 0);
+        u32 count = it->value<u32>("count", 1);
+        if (count == 0 || index >= count)
+        {
+            std::cerr << "Invalid shard, expected 0 <= index < count" << std::endl;
+            return false;
+        }
+        shard = Shard(index, count);
+    }
+
+    std::filesystem::path directory = job.value("directory", ".");
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+
+    std::string path = (directory / "manifest.json").string();
+    Manifest progress = manifest;
+    if (Manifest existing; existing.read(path))
+    {
+        if (!existing.matches(manifest))
+        {
+            std::cerr << path << " belongs to a different search" << std::endl;
+            return false;
+        }
+        progress = existing;
+    }
+
+    for (const auto &unit : shard.getUnits(progress.getUnits()))
+    {
+        if (progress.isDone(unit.index))
+        {
+            continue;
+        }
+
+        std::filesystem::path unitPath = getUnitPath(directory, unit.index, getUnitExtension(manifest.getType()));
+        std::ofstream file(unitPath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+        if (!file.is_open())
+        {
+            std::cerr << "Unable to open " << unitPath.string() << std::endl;
+            return false;
+        }
+
+        std::cerr << "Unit " << unit.index << " of " << progress.getUnits().size() << std::endl;
+        run({ unit }, file);
+        file.close();
+
+        progress.setDone(unit.index);
+        if (!file || !progress.write(path))
+        {
+            std::cerr << "Unable to write " << path << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Computes the number of IV combinations between \p min and \p max
+ *
+ * @param min Minimum IVs
+ * @param max Maximum IVs
+ *
+ * @return IV combination count
+ */
+static u64 getIVProgress(const std::array<u8, 6> &min, const std::array<u8, 6> &max)
+{
+    u64 progress = 1;
+    for (u8 i = 0; i < 6; i++)
+    {
+        progress *= max[i] - min[i] + 1;
+    }
+    return progress;
+}
+
+/**
+ * @brief Gen 3 static encounters
+ *
+ * @param job Job specification
+ * @param out Stream to write to
+ *
+ * @return true Job ran to completion
+ * @return false Job specification was invalid
+ */
+static bool static3(const json &job, std::ostream &out)
+{
+    auto loaded = getProfile(job, ProfileLoader3::getProfile);
+    if (!loaded)
+    {
+        return false;
+    }
+    const Profile3 &profile = *loaded;
+    const StaticTemplate3 *staticTemplate = getStaticTemplate(job, Encounters3::getStaticEncounters);
+    if (!staticTemplate)
+    {
+        return false;
+    }
+
+    auto method = job.value("method", Method::Method1);
+    auto filter = getFilter(job);
+    if (job.value("mode", "generate") == "generate")
+    {
+        StaticGenerator3 generator(getInteger<u32>(job, "initialAdvances"), getInteger<u32>(job, "maxAdvances", 1000),
+                                   getInteger<u32>(job, "offset"), method, *staticTemplate, profile, filter);
+
+        out << "Advances\t";
+        writeHeader(out);
+        for (const auto &state : generator.generate(getInteger<u32>(job, "seed")))
+        {
+            out << state.getAdvances() << '\t';
+            writeState(out, state);
+        }
+    }
+    else
+    {
+        StaticSearcher3 searcher(method, profile, filter);
+
+        std::array<u8, 6> min, max;
+        if (!getIVRange(job, min, max))
+        {
+            return false;
+        }
+        searcher.setMaxProgress(getIVProgress(min, max));
+
+        out << "Seed\t";
+        writeHeader(out);
+        runSearcher(
+            searcher, [&] { searcher.startSearch(min, max, staticTemplate); },
+            [&](const SearcherState &state) {
+                out << Hex(state.getSeed(), 8) << '\t';
+                writeState(out, state);
+            });
+    }
+
+    return true;
+}
+
+/**
+ * @brief Gen 4 static encounters
+ *
+ * @param job Job specification
+ * @param out Stream to write to
+ *
+ * @return true Job ran to completion
+ * @return false Job specification was invalid
+ */
+static bool static4(const json &job, std::ostream &out)
+{
+    auto loaded = getProfile(job, ProfileLoader4::getProfile);
+    if (!loaded)
+    {
+        return false;
+    }
+    const Profile4 &profile = *loaded;
+    const StaticTemplate4 *staticTemplate = getStaticTemplate(job, Encounters4::getStaticEncounters);
+    if (!staticTemplate)
+    {
+        return false;
+    }
+
+    auto filter = getFilter(job);
+    if (job.value("mode", "generate") == "generate")
+    {
+        StaticGenerator4 generator(getInteger<u32>(job, "initialAdvances"), getInteger<u32>(job, "maxAdvances", 1000),
+                                   getInteger<u32>(job, "offset"), staticTemplate->getMethod(), job.value("lead", Lead::None),
+                                   *staticTemplate, profile, filter);
+
+        out << "Advances\t";
+        writeHeader(out);
+        for (const auto &state : generator.generate(getInteger<u32>(job, "seed")))
+        {
+            out << state.getAdvances() << '\t';
+            writeState(out, state);
+        }
+    }
+    else
+    {
+        StaticSearcher4 searcher(getInteger<u32>(job, "minAdvance"), getInteger<u32>(job, "maxAdvance", 100),
+                                 getInteger<u32>(job, "minDelay", 600), getInteger<u32>(job, "maxDelay", 1000),
+                                 staticTemplate->getMethod(), job.value("leads", std::vector<Lead> { Lead::None }), profile, filter);
+
+        std::array<u8, 6> min, max;
+        if (!getIVRange(job, min, max))
+        {
+            return false;
+        }
+        searcher.setMaxProgress(getIVProgress(min, max));
+
+        out << "Seed\tAdvances\t";
+        writeHeader(out);
+        runSearcher(
+            searcher, [&] { searcher.startSearch(min, max, staticTemplate); },
+            [&](const SearcherState4 &state) {
+                out << Hex(state.getSeed(), 8) << '\t' << state.getAdvances() << '\t';
+                writeState(out, state);
+            });
+    }
+
+    return true;
+}
+
+/**
+ * @brief Gen 5 events
+ *
+ * @param job Job specification
+ * @param out Stream to write to
+ *
+ * @return true Job ran to completion
+ * @return false Job specification was invalid
+ */
+static bool event5(const json &job, std::ostream &out)
+{
+    auto loaded = getProfile(job, ProfileLoader5::getProfile);
+    if (!loaded)
+    {
+        return false;
+    }
+    const Profile5 &profile = *loaded;
+
+    json event = job.value("pgf", json::object());
+    auto ivs = event.value("ivs", std::array<u8, 6> { 255, 255, 255, 255, 255, 255 });
+    PGF pgf(event.value<u16>("tid", 0), event.value<u16>("sid", 0), event.value<u16>("species", 1), event.value<u8>("nature", 255),
+            event.value<u8>("gender", 255), event.value<u8>("ability", 255), event.value("shiny", Shiny::Random),
+            event.value<u8>("level", 1), ivs[0], ivs[1], ivs[2], ivs[3], ivs[4], ivs[5], event.value("egg", false));
+
+    auto filter = getFilter(job);
+    if (job.value("mode", "generate") == "generate")
+    {
+        EventGenerator5 generator(getInteger<u32>(job, "initialAdvances"), getInteger<u32>(job, "maxAdvances", 1000),
+                                  getInteger<u32>(job, "offset"), pgf, profile, filter);
+
+        out << "Advances\t";
+        writeHeader(out);
+        for (const auto &state : generator.generate(getInteger<u64>(job, "seed")))
+        {
+            out << state.getAdvances() << '\t';
+            writeState(out, state);
+        }
+    }
+    else
+    {
+        Date start, end;
+        if (!getDate(job, "start", start) || !getDate(job, "end", end))
+        {
+            return false;
+        }
+        else if (end < start)
+        {
+            std::cerr << "End date is before the start date" << std::endl;
+            return false;
+        }
+
+        EventGenerator5 generator(getInteger<u32>(job, "initialAdvances"), getInteger<u32>(job, "maxAdvances", 1000), 0, pgf, profile,
+                                  filter);
+        int threads;
+        if (!getThreads(job, threads))
+        {
+            return false;
+        }
+
+        // Packed results keep 16 bytes per result until they are written instead of the full state
+        bool packed = job.value("packed", false);
+
+        Manifest manifest("event5", getKey(job), Shard::split(start.getJD(), end.getJD(), job.value<u32>("units", 1)));
+        return runUnits(job, out, manifest, [&](const std::vector<WorkUnit> &units, std::ostream &stream) {
+            Searcher5<EventGenerator5, EventState5> searcher(generator, profile, packed);
+            searcher.setMaxProgress(searcher.getMaxProgress(units));
+
+            auto search = [&] { searcher.startSearch(threads, units); };
+            auto write = [&](const SearcherState5<EventState5> &state) {
+                stream << Hex(state.getInitialSeed(), 16) << '\t' << state.getDateTime().toString() << '\t'
+                       << Translator::getKeypresses(state.getButtons()) << '\t' << state.getState().getAdvances() << '\t';
+                writeState(stream, state.getState());
+            };
+
+            stream << "Seed\tDate/Time\tButtons\tAdvances\t";
+            writeHeader(stream);
+            if (packed)
+            {
+                runPackedSearcher(searcher, search, write);
+            }
+            else
+            {
+                runSearcher(searcher, search, write);
+            }
+        });
+    }
+
+    return true;
+}
+
+/**
+ * @brief Gen 3 Channel seed search
+ *
+ * @param job Job specification
+ * @param out Stream to write to
+ *
+ * @return true Job ran to completion
+ * @return false Job specification was invalid
+ */
+static bool channel3(const json &job, std::ostream &out)
+{
+    auto criteria = job.value("criteria", std::vector<u8>());
+    if (criteria.size() < 10)
+    {
+        std::cerr << "Channel search needs at least 10 criteria" << std::endl;
+        return false;
+    }
+
+    int threads;
+    if (!getThreads(job, threads))
+    {
+        return false;
+    }
+
+    Manifest manifest("channel3", getKey(job), ChannelSeedSearcher::getUnits(job.value<u32>("units", 1)));
+    return runUnits(job, out, manifest, [&](const std::vector<WorkUnit> &units, std::ostream &stream) {
+        ChannelSeedSearcher searcher(criteria);
+
+        u64 max = 0;
+        for (const auto &unit : units)
+        {
+            max += unit.end - unit.start + 1;
+        }
+        searcher.setMaxProgress(max);
+
+        stream << "Seed\n";
+        waitSearcher(searcher, [&] { searcher.startSearch(threads, units); }, [] {});
+        for (u32 seed : searcher.getResults())
+        {
+            stream << Hex(seed, 8) << '\n';
+        }
+    });
+}
+
+/**
+ * @brief Gen 5 IV cache. The cache is written in the same binary format as the IV Cache Finder tool.
+ *
+ * @param job Job specification
+ * @param out Stream to write to
+ *
+ * @return true Job ran to completion
+ * @return false Job specification was invalid
+ */
+static bool ivcache5(const json &job, std::ostream &out)
+{
+    u32 initialAdvances = getInteger<u32>(job, "initialAdvances");
+    u32 maxAdvances = getInteger<u32>(job, "maxAdvances", 0);
+    int threads;
+    if (!getThreads(job, threads))
+    {
+        return false;
+    }
+
+    Manifest manifest("ivcache5", getKey(job), IVCacheSearcher::getUnits(job.value<u32>("units", 1)));
+    return runUnits(job, out, manifest, [&](const std::vector<WorkUnit> &units, std::ostream &stream) {
+        IVCacheSearcher searcher(initialAdvances, maxAdvances);
+
+        u64 max = 0;
+        for (const auto &unit : units)
+        {
+            max += unit.end - unit.start + 1;
+        }
+        searcher.setMaxProgress(max);
+
+        auto start = std::chrono::steady_clock::now();
+        waitSearcher(searcher, [&] { searcher.startSearch(threads, units); }, [] {});
+        std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+        std::cerr << "Searched " << max << " seeds at " << static_cast<u64>(max / seconds.count()) << " seeds/s" << std::endl;
+
+        searcher.writeResults(stream);
+    });
+}
+
+/**
+ * @brief Gen 8 static encounters
+ *
+ * @param job Job specification
+ * @param out Stream to write to
+ *
+ * @return true Job ran to completion
+ * @return false Job specification was invalid
+ */
+static bool static8(const json &job, std::ostream &out)
+{
+    auto loaded = getProfile(job, ProfileLoader8::getProfile);
+    if (!loaded)
+    {
+        return false;
+    }
+    const Profile8 &profile = *loaded;
+    const StaticTemplate8 *staticTemplate = getStaticTemplate(job, Encounters8::getStaticEncounters);
+    if (!staticTemplate)
+    {
+        return false;
+    }
+
+    auto filter = getFilter(job);
+    StaticGenerator8 generator(getInteger<u32>(job, "initialAdvances"), getInteger<u32>(job, "maxAdvances", 1000),
+                               getInteger<u32>(job, "offset"), job.value("lead", Lead::None), *staticTemplate, profile, filter);
+
+    int threads;
+    if (!getThreads(job, threads))
+    {
+        return false;
+    }
+
+    if (job.value("mode", "generate") == "generate")
+    {
+        out << "Advances\t";
+        writeHeader(out);
+        for (const auto &state : generator.generate(getInteger<u64>(job, "seed0"), getInteger<u64>(job, "seed1"), threads))
+        {
+            out << state.getAdvances() << '\t';
+            writeState(out, state);
+        }
+    }
+    else
+    {
+        std::vector<XorshiftObservation> observations;
+        for (const auto &observation : job.value("observations", json::array()))
+        {
+            observations.emplace_back(XorshiftObservation { getInteger<u32>(observation, "advance"),
+                                                            getInteger<u32>(observation, "mask", 0xffffffff),
+                                                            getInteger<u32>(observation, "value") });
+        }
+
+        Searcher8<StaticGenerator8, State8> searcher(observations, generator);
+        if (searcher.getMaxProgress() == 0)
+        {
+            std::cerr << "Observations are contradictory or leave too many state bits unknown" << std::endl;
+            return false;
+        }
+        searcher.setMaxProgress(searcher.getMaxProgress());
+
+        out << "Seed 0\tSeed 1\tAdvances\t";
+        writeHeader(out);
+        runSearcher(
+            searcher, [&] { searcher.startSearch(threads); },
+            [&](const SearcherState8<State8> &state) {
+                out << Hex(state.getSeed0(), 16) << '\t' << Hex(state.getSeed1(), 16) << '\t' << state.getState().getAdvances() << '\t';
+                writeState(out, state.getState());
+            });
+    }
+
+    return true;
+}
+
+/**
+ * @brief SwSh raid dens
+ *
+ * @param job Job specification
+ * @param out Stream to write to
+ *
+ * @return true Job ran to completion
+ * @return false Job specification was invalid
+ */
+static bool raid8(const json &job, std::ostream &out)
+{
+    auto loaded = getProfile(job, ProfileLoader8::getProfile);
+    if (!loaded)
+    {
+        return false;
+    }
+    const Profile8 &profile = *loaded;
+    if (profile.getVersion() != Game::Sword && profile.getVersion() != Game::Shield)
+    {
+        std::cerr << "Raids need a Sword or Shield profile" << std::endl;
+        return false;
+    }
+
+    int den = job.value("den", 0);
+    int rarity = job.value("rarity", 0);
+    int raidIndex = job.value("raid", 0);
+    if (den < 0 || den >= 276 || rarity < 0 || rarity > 1 || raidIndex < 0 || raidIndex >= 12)
+    {
+        std::cerr << "Invalid den/rarity/raid" << std::endl;
+        return false;
+    }
+
+    Raid raid = Encounters8::getDen(den, rarity)->getRaid(raidIndex, profile.getVersion());
+    u8 level = job.value<u8>("level", 15);
+
+    if (job.value("mode", "generate") == "generate")
+    {
+        RaidGenerator generator(getInteger<u32>(job, "initialAdvances"), getInteger<u32>(job, "maxAdvances", 1000),
+                                getInteger<u32>(job, "offset"), profile, getFilter(job));
+
+        out << "Advances\tEC\t";
+        writeHeader(out);
+        for (const auto &state : generator.generate(getInteger<u64>(job, "seed"), level, raid))
+        {
+            out << state.getAdvances() << '\t' << Hex(state.getEC(), 8) << '\t';
+            writeState(out, state);
+        }
+    }
+    else
+    {
+        std::vector<RaidObservation> observations;
+        u32 maxAdvances = 0;
+        for (const auto &observation : job.value("observations", json::array()))
+        {
+            RaidObservation raidObservation { getInteger<u32>(observation, "advances"), getInteger<u32>(observation, "ec"),
+                                              getInteger<u32>(observation, "pid") };
+            raidObservation.ivs = observation.value("ivs", raidObservation.ivs);
+            raidObservation.nature = observation.value<u8>("nature", 255);
+            observations.emplace_back(raidObservation);
+            maxAdvances = std::max(maxAdvances, raidObservation.advances);
+        }
+
+        if (observations.empty())
+        {
+            std::cerr << "Missing raid observations" << std::endl;
+            return false;
+        }
+
+        int threads;
+        if (!getThreads(job, threads))
+        {
+            return false;
+        }
+
+        // The observations are checked against every generated state, so the job filter is not applied to the generator
+        RaidGenerator generator(0, maxAdvances, 0, profile, getFilter(json::object()));
+        RaidSearcher searcher(observations, level, raid, generator);
+        if (searcher.getMaxProgress() == 0)
+        {
+            std::cerr << "Observations disagree on the den seed" << std::endl;
+            return false;
+        }
+        searcher.setMaxProgress(searcher.getMaxProgress());
+
+        out << "Seed\tAdvances\tEC\t";
+        writeHeader(out);
+        runSearcher(
+            searcher, [&] { searcher.startSearch(threads); },
+            [&](const SearcherState8<State8> &state) {
+                out << Hex(state.getSeed0(), 16) << '\t' << state.getState().getAdvances() << '\t' << Hex(state.getState().getEC(), 8)
+                    << '\t';
+                writeState(out, state.getState());
+            });
+    }
+
+    return true;
+}
+
+namespace Job
+{
+    bool merge(const std::vector<std::string> &directories, std::ostream &out)
+    {
+        if (directories.empty())
+        {
+            std::cerr << "No job directories to merge" << std::endl;
+            return false;
+        }
+
+        std::vector<Manifest> manifests(directories.size());
+        for (size_t i = 0; i < directories.size(); i++)
+        {
+            std::string path = (std::filesystem::path(directories[i]) / "manifest.json").string();
+            if (!manifests[i].read(path))
+            {
+                std::cerr << "Unable to read " << path << std::endl;
+                return false;
+            }
+            else if (!manifests[i].matches(manifests[0]))
+            {
+                std::cerr << path << " belongs to a different search" << std::endl;
+                return false;
+            }
+        }
+
+        // Every unit has to be complete in one of the directories
+        std::vector<std::filesystem::path> files;
+        std::vector<u32> missing;
+        std::string type = manifests[0].getType();
+        for (const auto &unit : manifests[0].getUnits())
+        {
+            auto it = std::ranges::find_if(manifests, [&unit](const Manifest &manifest) { return manifest.isDone(unit.index); });
+            if (it == manifests.end())
+            {
+                missing.emplace_back(unit.index);
+            }
+            else
+            {
+                files.emplace_back(getUnitPath(directories[std::distance(manifests.begin(), it)], unit.index, getUnitExtension(type)));
+            }
+        }
+
+        if (!missing.empty())
+        {
+            std::cerr << "Units not complete:";
+            for (u32 unit : missing)
+            {
+                std::cerr << ' ' << unit;
+            }
+            std::cerr << std::endl;
+            return false;
+        }
+
+        if (type == "ivcache5")
+        {
+            IVCache cache(files[0].string(), false);
+            IVCacheSearcher searcher(cache.getInitialAdvances(), cache.getMaxAdvances());
+            for (const auto &file : files)
+            {
+                if (!searcher.readResults(file.string()))
+                {
+                    std::cerr << "Unable to read " << file.string() << std::endl;
+                    return false;
+                }
+            }
+            searcher.writeResults(out);
+            return true;
+        }
+
+        // Text results are sorted by their first column, which is always a fixed width seed
+        std::string header;
+        std::vector<std::string> rows;
+        for (const auto &file : files)
+        {
+            std::ifstream stream(file);
+            if (!stream.is_open() || !std::getline(stream, header))
+            {
+                std::cerr << "Unable to read " << file.string() << std::endl;
+                return false;
+            }
+
+            for (std::string row; std::getline(stream, row);)
+            {
+                rows.emplace_back(std::move(row));
+            }
+        }
+
+        std::ranges::sort(rows);
+        rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+
+        out << header << '\n';
+        for (const auto &row : rows)
+        {
+            out << row << '\n';
+        }
+        return true;
+    }
+
+    bool run(const json &job, std::ostream &out)
+    {
+        static const std::map<std::string, bool (*)(const json &, std::ostream &)> jobs
+            = { { "channel3", channel3 }, { "event5", event5 },   { "ivcache5", ivcache5 }, { "raid8", raid8 },
+                { "static3", static3 },   { "static4", static4 }, { "static8", static8 } };
+
+        std::string type = job.value("type", "");
+        auto it = jobs.find(type);
+        if (it == jobs.end())
+        {
+            std::cerr << "Unknown job type \"" << type << "\", expected one of:";
+            for (const auto &[name, function] : jobs)
+            {
+                std::cerr << ' ' << name;
+            }
+            std::cerr << std::endl;
+            return false;
+        }
+
+        try
+        {
+            return it->second(job, out);
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Invalid job: " << e.what() << std::endl;
+            return false;
+        }
+    }
+}
@@ -0,0 +1,55 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef JOB_HPP
+#define JOB_HPP
+
+#include <nlohmann/json.hpp>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace Job
+{
+    /**
+     * @brief Combines the unit results of sharded searches into one sorted output. Fails if any unit of the search is not complete in
+     * one of the \p directories.
+     *
+     * @param directories Job directories of the shards
+     * @param out Stream to write results to
+     *
+     * @return true Results were merged
+     * @return false Manifests are missing, belong to different searches or units are not complete
+     */
+    bool merge(const std::vector<std::string> &directories, std::ostream &out);
+
+    /**
+     * @brief Runs the generator or searcher described by the \p job and writes the results to \p out as tab separated rows.
+     * Errors are written to stderr.
+     *
+     * @param job Job specification
+     * @param out Stream to write results to
+     *
+     * @return true Job ran to completion
+     * @return false Job specification was invalid
+     */
+    bool run(const nlohmann::json &job, std::ostream &out);
+}
+
+#endif // JOB_HPP
@@ -0,0 +1,69 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "Job.hpp"
+#include <Core/Util/Translator.hpp>
+#include <fstream>
+#include <iostream>
+
+using json = nlohmann::json;
+
+int main(int argc, char *argv[])
+{
+    if (argc >= 4 && std::string(argv[1]) == "merge")
+    {
+        std::ofstream out(argv[2], std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+        if (!out.is_open())
+        {
+            std::cerr << "Unable to open output file " << argv[2] << std::endl;
+            return 1;
+        }
+        return Job::merge(std::vector<std::string>(argv + 3, argv + argc), out) ? 0 : 1;
+    }
+    else if (argc < 2 || argc > 3)
+    {
+        std::cerr << "Usage: pokefinder-cli <job.json> [output]" << std::endl;
+        std::cerr << "       pokefinder-cli merge <output> <directory>..." << std::endl;
+        return 1;
+    }
+
+    std::ifstream file(argv[1]);
+    json job = json::parse(file, nullptr, false);
+    if (job.is_discarded() || !job.is_object())
+    {
+        std::cerr << "Unable to read job file " << argv[1] << std::endl;
+        return 1;
+    }
+
+    Translator::init(job.value("locale", "en"));
+
+    std::string output = argc == 3 ? argv[2] : job.value("output", "");
+    if (output.empty())
+    {
+        return Job::run(job, std::cout) ? 0 : 1;
+    }
+
+    std::ofstream out(output, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    if (!out.is_open())
+    {
+        std::cerr << "Unable to open output file " << output << std::endl;
+        return 1;
+    }
+    return Job::run(job, out) ? 0 : 1;
+}
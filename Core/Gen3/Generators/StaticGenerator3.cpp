@@ -22,8 +22,10 @@
 #include <Core/Enum/Method.hpp>
 #include <Core/Parents/PersonalInfo.hpp>
 #include <Core/Parents/States/State.hpp>
+#include <Core/Parents/States/StateBatch.hpp>
 #include <Core/RNG/LCRNG.hpp>
 #include <Core/Util/Utilities.hpp>
+#include <algorithm>
 
 StaticGenerator3::StaticGenerator3(u32 initialAdvances, u32 maxAdvances, u32 offset, Method method, const StaticTemplate3 &staticTemplate,
                                    const Profile3 &profile, const StateFilter &filter) :
@@ -36,35 +38,53 @@ std::vector<GeneratorState> StaticGenerator3::generate(u32 seed) const
     std::vector<GeneratorState> states;
     const PersonalInfo *info = staticTemplate.getInfo();
 
+    // Advances are generated a batch at a time so only the states that pass the filter compute their stats
+    StateBatch batch;
+    std::vector<u32> rows;
+
     PokeRNG rng(seed, initialAdvances + offset);
-    for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rng.next())
+    for (u64 start = 0; start <= maxAdvances; start += StateBatch::capacity)
     {
-        PokeRNG go(rng);
-
-        u32 pid = go.nextUShort();
-        pid |= go.nextUShort() << 16;
+        u32 size = std::min<u64>(StateBatch::capacity, maxAdvances - start + 1);
+        batch.resize(size);
 
-        u16 iv1 = staticTemplate.getBuggedRoamer() ? go.nextUShort() & 0xff : go.nextUShort();
-        if (method == Method::Method4)
+        for (u32 i = 0; i < size; i++, rng.next())
         {
-            go.next();
-        }
-        u16 iv2 = staticTemplate.getBuggedRoamer() ? 0 : go.nextUShort();
+            PokeRNG go(rng);
+
+            u32 pid = go.nextUShort();
+            pid |= go.nextUShort() << 16;
 
-        std::array<u8, 6> ivs;
-        ivs[0] = iv1 & 31;
-        ivs[1] = (iv1 >> 5) & 31;
-        ivs[2] = (iv1 >> 10) & 31;
-        ivs[3] = (iv2 >> 5) & 31;
-        ivs[4] = (iv2 >> 10) & 31;
-        ivs[5] = iv2 & 31;
+            u16 iv1 = staticTemplate.getBuggedRoamer() ? go.nextUShort() & 0xff : go.nextUShort();
+            if (method == Method::Method4)
+            {
+                go.next();
+            }
+            u16 iv2 = staticTemplate.getBuggedRoamer() ? 0 : go.nextUShort();
 
-        GeneratorState state(initialAdvances + cnt, pid, ivs, pid & 1, Utilities::getGender(pid, info), staticTemplate.getLevel(), pid % 25,
-                             Utilities::getShiny<true>(pid, tsv), info);
-        if (filter.compareState(static_cast<const State &>(state)))
+            batch.advances[i] = initialAdvances + start + i;
+            batch.ec[i] = pid;
+            batch.pid[i] = pid;
+            batch.ivs[0][i] = iv1 & 31;
+            batch.ivs[1][i] = (iv1 >> 5) & 31;
+            batch.ivs[2][i] = (iv1 >> 10) & 31;
+            batch.ivs[3][i] = (iv2 >> 5) & 31;
+            batch.ivs[4][i] = (iv2 >> 10) & 31;
+            batch.ivs[5][i] = iv2 & 31;
+        }
+
+        for (u32 i = 0; i < size; i++)
         {
-            states.emplace_back(state);
+            u32 pid = batch.pid[i];
+            batch.ability[i] = pid & 1;
+            batch.gender[i] = Utilities::getGender(pid, info);
+            batch.level[i] = staticTemplate.getLevel();
+            batch.nature[i] = pid % 25;
+            batch.shiny[i] = Utilities::getShiny<true>(pid, tsv);
         }
+
+        filter.compareStates(batch, rows);
+        batch.getStates(rows, info, states);
     }
 
     return states;
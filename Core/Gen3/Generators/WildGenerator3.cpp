@@ -84,6 +84,8 @@ std::vector<WildGeneratorState> WildGenerator3::generate(u32 seed) const
         return (pid & 0xff) < info->getGender();
     };
 
+    const auto &slotTable = EncounterSlot::hTable(area.getEncounter());
+
     PokeRNG rng(seed, initialAdvances + offset);
     for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rng.next())
     {
@@ -112,7 +114,7 @@ std::vector<WildGeneratorState> WildGenerator3::generate(u32 seed) const
             }
             else
             {
-                encounterSlot = EncounterSlot::hSlot(go.nextUShort(100), area.getEncounter());
+                encounterSlot = slotTable[go.nextUShort(100)];
             }
         }
 
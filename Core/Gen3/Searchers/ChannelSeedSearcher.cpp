@@ -25,29 +25,48 @@ ChannelSeedSearcher::ChannelSeedSearcher(const std::vector<u8> &criteria) : crit
 {
 }
 
+std::vector<WorkUnit> ChannelSeedSearcher::getUnits(u32 count)
+{
+    return Shard::split(0x40000001, 0xfffffffe, count);
+}
+
 void ChannelSeedSearcher::startSearch(int threads)
+{
+    startSearch(threads, getUnits(1));
+}
+
+void ChannelSeedSearcher::startSearch(int threads, const std::vector<WorkUnit> &units)
 {
     searching = true;
 
     auto *threadContainer = new std::thread[threads];
 
-    u32 split = 0xbffffffe / threads;
-    u32 start = 0x40000001;
-    for (int i = 0; i < threads; i++, start += split)
+    for (const auto &unit : units)
     {
-        if (i == threads - 1)
+        // Units are inclusive while search excludes its end
+        u32 split = (unit.end - unit.start + 1) / threads;
+        u32 start = unit.start;
+        for (int i = 0; i < threads; i++, start += split)
         {
-            threadContainer[i] = std::thread([=] { search(start, 0xffffffff); });
+            if (i == threads - 1)
+            {
+                threadContainer[i] = std::thread([=, end = static_cast<u32>(unit.end + 1)] { search(start, end); });
+            }
+            else
+            {
+                threadContainer[i] = std::thread([=] { search(start, start + split); });
+            }
         }
-        else
+
+        for (int i = 0; i < threads; i++)
         {
-            threadContainer[i] = std::thread([=] { search(start, start + split); });
+            threadContainer[i].join();
         }
-    }
 
-    for (int i = 0; i < threads; i++)
-    {
-        threadContainer[i].join();
+        if (!searching)
+        {
+            break;
+        }
     }
 
     delete[] threadContainer;
@@ -22,6 +22,7 @@
 
 #include <Core/Parents/Searchers/Searcher.hpp>
 #include <Core/RNG/LCRNG.hpp>
+#include <Core/Util/Shard.hpp>
 
 /**
  * @brief Searches for candidate PRNG states
@@ -36,6 +37,15 @@ public:
      */
     ChannelSeedSearcher(const std::vector<u8> &criteria);
 
+    /**
+     * @brief Returns the work units covering every PRNG state the search checks
+     *
+     * @param count Number of units
+     *
+     * @return Work units
+     */
+    static std::vector<WorkUnit> getUnits(u32 count);
+
     /**
      * @brief Starts the search
      *
@@ -43,6 +53,14 @@ public:
      */
     void startSearch(int threads);
 
+    /**
+     * @brief Starts the search over each of the \p units
+     *
+     * @param threads Number of threads to search with
+     * @param units Work units of PRNG states
+     */
+    void startSearch(int threads, const std::vector<WorkUnit> &units);
+
 private:
     std::vector<u8> criteria;
 
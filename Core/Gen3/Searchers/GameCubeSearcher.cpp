@@ -131,39 +131,40 @@ void GameCubeSearcher::startSearch(const std::array<u8, 6> &min, const std::arra
 {
     searching = true;
 
+    bool colo = (profile.getVersion() & Game::Colosseum) != Game::None;
+
+    std::vector<SearcherState> states;
+    auto addStates = [&](const std::array<u8, 6> &ivs, const RecoverySeeds<6> &seeds) {
+        std::vector<SearcherState> found;
+        if (colo)
+        {
+            found = searchColoShadow(ivs[0], ivs[1], ivs[2], ivs[3], ivs[4], ivs[5], seeds, shadowTemplate);
+        }
+        else
+        {
+            found = searchGalesShadow(ivs[0], ivs[1], ivs[2], ivs[3], ivs[4], ivs[5], seeds, shadowTemplate);
+        }
+        states.insert(states.end(), found.begin(), found.end());
+    };
+
+    u32 combinations = (max[3] - min[3] + 1) * (max[4] - min[4] + 1) * (max[5] - min[5] + 1);
     for (u8 hp = min[0]; hp <= max[0]; hp++)
     {
         for (u8 atk = min[1]; atk <= max[1]; atk++)
         {
             for (u8 def = min[2]; def <= max[2]; def++)
             {
-                for (u8 spa = min[3]; spa <= max[3]; spa++)
+                if (!searching)
                 {
-                    for (u8 spd = min[4]; spd <= max[4]; spd++)
-                    {
-                        for (u8 spe = min[5]; spe <= max[5]; spe++)
-                        {
-                            if (!searching)
-                            {
-                                return;
-                            }
+                    return;
+                }
 
-                            std::vector<SearcherState> states;
-                            if ((profile.getVersion() & Game::Colosseum) != Game::None)
-                            {
-                                states = searchColoShadow(hp, atk, def, spa, spd, spe, shadowTemplate);
-                            }
-                            else
-                            {
-                                states = searchGalesShadow(hp, atk, def, spa, spd, spe, shadowTemplate);
-                            }
+                LCRNGReverse::recoverXDRNGIVRow(hp, atk, def, min, max, addStates);
 
-                            std::lock_guard<std::mutex> guard(mutex);
-                            results.insert(results.end(), states.begin(), states.end());
-                            progress++;
-                        }
-                    }
-                }
+                std::lock_guard<std::mutex> guard(mutex);
+                results.insert(results.end(), states.begin(), states.end());
+                states.clear();
+                progress += combinations;
             }
         }
     }
@@ -184,41 +185,65 @@ void GameCubeSearcher::startSearch(const std::array<u8, 6> &min, const std::arra
         tsv = 10048; // TID: 10048 SID: 0
     }
 
-    for (u8 hp = min[0]; hp <= max[0]; hp++)
+    if (method == Method::Channel)
     {
-        for (u8 atk = min[1]; atk <= max[1]; atk++)
+        for (u8 hp = min[0]; hp <= max[0]; hp++)
         {
-            for (u8 def = min[2]; def <= max[2]; def++)
+            for (u8 atk = min[1]; atk <= max[1]; atk++)
             {
-                for (u8 spa = min[3]; spa <= max[3]; spa++)
+                for (u8 def = min[2]; def <= max[2]; def++)
                 {
-                    for (u8 spd = min[4]; spd <= max[4]; spd++)
+                    for (u8 spa = min[3]; spa <= max[3]; spa++)
                     {
-                        for (u8 spe = min[5]; spe <= max[5]; spe++)
+                        for (u8 spd = min[4]; spd <= max[4]; spd++)
                         {
-                            if (!searching)
+                            for (u8 spe = min[5]; spe <= max[5]; spe++)
                             {
-                                return;
-                            }
+                                if (!searching)
+                                {
+                                    return;
+                                }
 
-                            std::vector<SearcherState> states;
-                            if (method == Method::Channel)
-                            {
-                                states = searchChannel(hp, atk, def, spa, spd, spe, staticTemplate);
-                            }
-                            else
-                            {
-                                states = searchNonLock(hp, atk, def, spa, spd, spe, staticTemplate);
-                            }
+                                auto states = searchChannel(hp, atk, def, spa, spd, spe, staticTemplate);
 
-                            std::lock_guard<std::mutex> guard(mutex);
-                            results.insert(results.end(), states.begin(), states.end());
-                            progress++;
+                                std::lock_guard<std::mutex> guard(mutex);
+                                results.insert(results.end(), states.begin(), states.end());
+                                progress++;
+                            }
                         }
                     }
                 }
             }
         }
+        return;
+    }
+
+    std::vector<SearcherState> states;
+    auto addStates = [&](const std::array<u8, 6> &ivs, const RecoverySeeds<6> &seeds) {
+        auto found = searchNonLock(ivs[0], ivs[1], ivs[2], ivs[3], ivs[4], ivs[5], seeds, staticTemplate);
+        states.insert(states.end(), found.begin(), found.end());
+    };
+
+    u32 combinations = (max[3] - min[3] + 1) * (max[4] - min[4] + 1) * (max[5] - min[5] + 1);
+    for (u8 hp = min[0]; hp <= max[0]; hp++)
+    {
+        for (u8 atk = min[1]; atk <= max[1]; atk++)
+        {
+            for (u8 def = min[2]; def <= max[2]; def++)
+            {
+                if (!searching)
+                {
+                    return;
+                }
+
+                LCRNGReverse::recoverXDRNGIVRow(hp, atk, def, min, max, addStates);
+
+                std::lock_guard<std::mutex> guard(mutex);
+                results.insert(results.end(), states.begin(), states.end());
+                states.clear();
+                progress += combinations;
+            }
+        }
     }
 }
 
@@ -271,7 +296,7 @@ std::vector<SearcherState> GameCubeSearcher::searchChannel(u8 hp, u8 atk, u8 def
 }
 
 std::vector<SearcherState> GameCubeSearcher::searchColoShadow(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
-                                                              const ShadowTemplate *shadowTemplate) const
+                                                              const RecoverySeeds<6> &seeds, const ShadowTemplate *shadowTemplate) const
 {
     std::vector<SearcherState> states;
     const PersonalInfo *info = shadowTemplate->getInfo();
@@ -286,7 +311,6 @@ std::vector<SearcherState> GameCubeSearcher::searchColoShadow(u8 hp, u8 atk, u8
         ivs = { hp, atk, def, spa, spd, spe };
     }
 
-    auto seeds = LCRNGReverse::recoverXDRNGIV(hp, atk, def, spa, spd, spe);
     for (int i = 0; i < seeds.count; i++)
     {
         XDRNG rng(seeds[i]);
@@ -336,13 +360,12 @@ std::vector<SearcherState> GameCubeSearcher::searchColoShadow(u8 hp, u8 atk, u8
 }
 
 std::vector<SearcherState> GameCubeSearcher::searchGalesShadow(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
-                                                               const ShadowTemplate *shadowTemplate) const
+                                                               const RecoverySeeds<6> &seeds, const ShadowTemplate *shadowTemplate) const
 {
     std::vector<SearcherState> states;
     const PersonalInfo *info = shadowTemplate->getInfo();
     std::array<u8, 6> ivs = { hp, atk, def, spa, spd, spe };
 
-    auto seeds = LCRNGReverse::recoverXDRNGIV(hp, atk, def, spa, spd, spe);
     for (int i = 0; i < seeds.count; i++)
     {
         XDRNG rng(seeds[i]);
@@ -417,13 +440,12 @@ std::vector<SearcherState> GameCubeSearcher::searchGalesShadow(u8 hp, u8 atk, u8
 }
 
 std::vector<SearcherState> GameCubeSearcher::searchNonLock(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
-                                                           const StaticTemplate3 *staticTemplate)
+                                                           const RecoverySeeds<6> &seeds, const StaticTemplate3 *staticTemplate)
 {
     std::vector<SearcherState> states;
     const PersonalInfo *info = staticTemplate->getInfo();
     std::array<u8, 6> ivs = { hp, atk, def, spa, spd, spe };
 
-    auto seeds = LCRNGReverse::recoverXDRNGIV(hp, atk, def, spa, spd, spe);
     for (int i = 0; i < seeds.count; i++)
     {
         XDRNG rng(seeds[i]);
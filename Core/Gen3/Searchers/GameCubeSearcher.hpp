@@ -26,6 +26,8 @@
 
 class StaticTemplate3;
 class ShadowTemplate;
+template <int size>
+struct RecoverySeeds;
 
 /**
  * @brief Wild encounter searcher for GameCube
@@ -86,11 +88,13 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
      * @param shadowTemplate Pokemon template
      *
      * @return Vector of computed states
      */
-    std::vector<SearcherState> searchColoShadow(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const ShadowTemplate *shadowTemplate) const;
+    std::vector<SearcherState> searchColoShadow(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
+                                                const ShadowTemplate *shadowTemplate) const;
 
     /**
      * @brief Searches for matching states from provided IVs
@@ -101,11 +105,13 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
      * @param shadowTemplate Pokemon template
      *
      * @return Vector of computed states
      */
-    std::vector<SearcherState> searchGalesShadow(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const ShadowTemplate *shadowTemplate) const;
+    std::vector<SearcherState> searchGalesShadow(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
+                                                 const ShadowTemplate *shadowTemplate) const;
 
     /**
      * @brief Searches for matching states from provided IVs
@@ -116,11 +122,13 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
      * @param staticTemplate Pokemon template
      *
      * @return Vector of computed states
      */
-    std::vector<SearcherState> searchNonLock(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const StaticTemplate3 *staticTemplate);
+    std::vector<SearcherState> searchNonLock(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
+                                             const StaticTemplate3 *staticTemplate);
 };
 
 #endif // GAMECUBESEARCHER_HPP
@@ -36,37 +36,36 @@ void StaticSearcher3::startSearch(const std::array<u8, 6> &min, const std::array
 {
     searching = true;
 
+    std::vector<SearcherState> states;
+    auto addStates = [&](const std::array<u8, 6> &ivs, const RecoverySeeds<6> &seeds) {
+        auto found = search(ivs[0], ivs[1], ivs[2], ivs[3], ivs[4], ivs[5], seeds, staticTemplate);
+        states.insert(states.end(), found.begin(), found.end());
+    };
+
+    u32 combinations = (max[3] - min[3] + 1) * (max[4] - min[4] + 1) * (max[5] - min[5] + 1);
     for (u8 hp = min[0]; hp <= max[0]; hp++)
     {
         for (u8 atk = min[1]; atk <= max[1]; atk++)
         {
             for (u8 def = min[2]; def <= max[2]; def++)
             {
-                for (u8 spa = min[3]; spa <= max[3]; spa++)
+                if (!searching)
                 {
-                    for (u8 spd = min[4]; spd <= max[4]; spd++)
-                    {
-                        for (u8 spe = min[5]; spe <= max[5]; spe++)
-                        {
-                            if (!searching)
-                            {
-                                return;
-                            }
+                    return;
+                }
 
-                            auto states = search(hp, atk, def, spa, spd, spe, staticTemplate);
+                LCRNGReverse::recoverPokeRNGIVRow(hp, atk, def, min, max, method, addStates);
 
-                            std::lock_guard<std::mutex> guard(mutex);
-                            results.insert(results.end(), states.begin(), states.end());
-                            progress++;
-                        }
-                    }
-                }
+                std::lock_guard<std::mutex> guard(mutex);
+                results.insert(results.end(), states.begin(), states.end());
+                states.clear();
+                progress += combinations;
             }
         }
     }
 }
 
-std::vector<SearcherState> StaticSearcher3::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
+std::vector<SearcherState> StaticSearcher3::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
                                                    const StaticTemplate3 *staticTemplate) const
 {
     std::vector<SearcherState> states;
@@ -81,7 +80,6 @@ std::vector<SearcherState> StaticSearcher3::search(u8 hp, u8 atk, u8 def, u8 spa
     }
     const PersonalInfo *info = staticTemplate->getInfo();
 
-    auto seeds = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, method);
     for (int i = 0; i < seeds.count; i++)
     {
         PokeRNGR rng(seeds[i]);
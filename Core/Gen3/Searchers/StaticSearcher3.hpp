@@ -25,6 +25,8 @@
 #include <Core/Parents/Searchers/StaticSearcher.hpp>
 
 class StaticTemplate3;
+template <int size>
+struct RecoverySeeds;
 
 /**
  * @brief Static encounter searcher for Gen3
@@ -62,11 +64,13 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
      * @param staticTemplate Pokemon template
      *
      * @return Vector of computed states
      */
-    std::vector<SearcherState> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const StaticTemplate3 *staticTemplate) const;
+    std::vector<SearcherState> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
+                                      const StaticTemplate3 *staticTemplate) const;
 };
 
 #endif // STATICSEARCHER3_HPP
@@ -134,43 +134,42 @@ void WildSearcher3::startSearch(const std::array<u8, 6> &min, const std::array<u
     bool safari = area.safariZone(profile.getVersion());
     bool tanoby = area.tanobyChamber(profile.getVersion());
 
+    std::vector<WildSearcherState> states;
+    auto addStates = [&](const std::array<u8, 6> &ivs, const RecoverySeeds<6> &seeds) {
+        auto found = search(ivs[0], ivs[1], ivs[2], ivs[3], ivs[4], ivs[5], seeds, feebas, safari, tanoby);
+        states.insert(states.end(), found.begin(), found.end());
+    };
+
+    u32 combinations = (max[3] - min[3] + 1) * (max[4] - min[4] + 1) * (max[5] - min[5] + 1);
     for (u8 hp = min[0]; hp <= max[0]; hp++)
     {
         for (u8 atk = min[1]; atk <= max[1]; atk++)
         {
             for (u8 def = min[2]; def <= max[2]; def++)
             {
-                for (u8 spa = min[3]; spa <= max[3]; spa++)
+                if (!searching)
                 {
-                    for (u8 spd = min[4]; spd <= max[4]; spd++)
-                    {
-                        for (u8 spe = min[5]; spe <= max[5]; spe++)
-                        {
-                            if (!searching)
-                            {
-                                return;
-                            }
+                    return;
+                }
 
-                            auto states = search(hp, atk, def, spa, spd, spe, feebas, safari, tanoby);
+                LCRNGReverse::recoverPokeRNGIVRow(hp, atk, def, min, max, method, addStates);
 
-                            std::lock_guard<std::mutex> guard(mutex);
-                            results.insert(results.end(), states.begin(), states.end());
-                            progress++;
-                        }
-                    }
-                }
+                std::lock_guard<std::mutex> guard(mutex);
+                results.insert(results.end(), states.begin(), states.end());
+                states.clear();
+                progress += combinations;
             }
         }
     }
 }
 
-std::vector<WildSearcherState> WildSearcher3::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, bool feebas, bool safari,
-                                                     bool tanoby) const
+std::vector<WildSearcherState> WildSearcher3::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
+                                                     bool feebas, bool safari, bool tanoby) const
 {
     std::vector<WildSearcherState> states;
     std::array<u8, 6> ivs = { hp, atk, def, spa, spd, spe };
+    const auto &slotTable = EncounterSlot::hTable(area.getEncounter());
 
-    auto seeds = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, method);
     for (int i = 0; i < seeds.count; i++)
     {
         PokeRNGR rng(seeds[i]);
@@ -223,7 +222,7 @@ std::vector<WildSearcherState> WildSearcher3::search(u8 hp, u8 atk, u8 def, u8 s
                 if (tanoby)
                 {
                     levelRand[0] = nextRNG;
-                    encounterSlot[0] = EncounterSlot::hSlot(nextRNG2 % 100, area.getEncounter());
+                    encounterSlot[0] = slotTable[nextRNG2 % 100];
                     valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                 }
                 else if ((nextRNG % 25) == nature)
@@ -243,20 +242,20 @@ std::vector<WildSearcherState> WildSearcher3::search(u8 hp, u8 atk, u8 def, u8 s
                             u8 rand = test[1].nextUShort(100);
                             if (test[1].nextUShort(100) >= 50)
                             {
-                                encounterSlot[1] = EncounterSlot::hSlot(rand, area.getEncounter());
+                                encounterSlot[1] = slotTable[rand];
                                 valid[1] = filter.compareEncounterSlot(encounterSlot[1]);
                             }
                         }
                         else
                         {
                             test[0].advance(1);
-                            encounterSlot[0] = EncounterSlot::hSlot(test[0].nextUShort(100), area.getEncounter());
+                            encounterSlot[0] = slotTable[test[0].nextUShort(100)];
                             valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                         }
                     }
                     else
                     {
-                        encounterSlot[0] = EncounterSlot::hSlot(test[0].nextUShort(100), area.getEncounter());
+                        encounterSlot[0] = slotTable[test[0].nextUShort(100)];
                         valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                     }
                 }
@@ -285,20 +284,20 @@ std::vector<WildSearcherState> WildSearcher3::search(u8 hp, u8 atk, u8 def, u8 s
                             u8 rand = test[1].nextUShort(100);
                             if (test[1].nextUShort(100) >= 50)
                             {
-                                encounterSlot[1] = EncounterSlot::hSlot(rand, area.getEncounter());
+                                encounterSlot[1] = slotTable[rand];
                                 valid[1] = filter.compareEncounterSlot(encounterSlot[1]);
                             }
                         }
                         else
                         {
                             test[0].advance(1);
-                            encounterSlot[0] = EncounterSlot::hSlot(test[0].nextUShort(100), area.getEncounter());
+                            encounterSlot[0] = slotTable[test[0].nextUShort(100)];
                             valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                         }
                     }
                     else
                     {
-                        encounterSlot[0] = EncounterSlot::hSlot(test[0].nextUShort(100), area.getEncounter());
+                        encounterSlot[0] = slotTable[test[0].nextUShort(100)];
                         valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                     }
                 }
@@ -321,20 +320,20 @@ std::vector<WildSearcherState> WildSearcher3::search(u8 hp, u8 atk, u8 def, u8 s
                             u8 rand = test[1].nextUShort(100);
                             if (test[1].nextUShort(100) >= 50)
                             {
-                                encounterSlot[1] = EncounterSlot::hSlot(rand, area.getEncounter());
+                                encounterSlot[1] = slotTable[rand];
                                 valid[1] = filter.compareEncounterSlot(encounterSlot[1]);
                             }
                         }
                         else
                         {
                             test[0].advance(1);
-                            encounterSlot[0] = EncounterSlot::hSlot(test[0].nextUShort(100), area.getEncounter());
+                            encounterSlot[0] = slotTable[test[0].nextUShort(100)];
                             valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                         }
                     }
                     else
                     {
-                        encounterSlot[0] = EncounterSlot::hSlot(test[0].nextUShort(100), area.getEncounter());
+                        encounterSlot[0] = slotTable[test[0].nextUShort(100)];
                         valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                     }
                     leadMask[0] = getLeadFlag(static_cast<Lead>(nature));
@@ -363,20 +362,20 @@ std::vector<WildSearcherState> WildSearcher3::search(u8 hp, u8 atk, u8 def, u8 s
                             u8 rand = test[3].nextUShort(100);
                             if (test[3].nextUShort(100) >= 50)
                             {
-                                encounterSlot[3] = EncounterSlot::hSlot(rand, area.getEncounter());
+                                encounterSlot[3] = slotTable[rand];
                                 valid[3] = filter.compareEncounterSlot(encounterSlot[3]);
                             }
                         }
                         else
                         {
                             test[2].advance(1);
-                            encounterSlot[2] = EncounterSlot::hSlot(test[2].nextUShort(100), area.getEncounter());
+                            encounterSlot[2] = slotTable[test[2].nextUShort(100)];
                             valid[2] = filter.compareEncounterSlot(encounterSlot[2]);
                         }
                     }
                     else
                     {
-                        encounterSlot[2] = EncounterSlot::hSlot(test[2].nextUShort(100), area.getEncounter());
+                        encounterSlot[2] = slotTable[test[2].nextUShort(100)];
                         valid[2] = filter.compareEncounterSlot(encounterSlot[2]);
                     }
                     leadMask[2] = synchronizeMask();
@@ -396,7 +395,7 @@ std::vector<WildSearcherState> WildSearcher3::search(u8 hp, u8 atk, u8 def, u8 s
                     }
                     else
                     {
-                        encounterSlot[0] = EncounterSlot::hSlot(encounterRand % 100, area.getEncounter());
+                        encounterSlot[0] = slotTable[encounterRand % 100];
                     }
                     valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                 }
@@ -420,20 +419,20 @@ std::vector<WildSearcherState> WildSearcher3::search(u8 hp, u8 atk, u8 def, u8 s
                             u8 rand = test[1].nextUShort(100);
                             if (test[1].nextUShort(100) >= 50)
                             {
-                                encounterSlot[1] = EncounterSlot::hSlot(rand, area.getEncounter());
+                                encounterSlot[1] = slotTable[rand];
                                 valid[1] = filter.compareEncounterSlot(encounterSlot[1]);
                             }
                         }
                         else
                         {
                             test[0].advance(1);
-                            encounterSlot[0] = EncounterSlot::hSlot(test[0].nextUShort(100), area.getEncounter());
+                            encounterSlot[0] = slotTable[test[0].nextUShort(100)];
                             valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                         }
                     }
                     else
                     {
-                        encounterSlot[0] = EncounterSlot::hSlot(test[0].nextUShort(100), area.getEncounter());
+                        encounterSlot[0] = slotTable[test[0].nextUShort(100)];
                         valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                     }
                 }
@@ -29,6 +29,8 @@
 
 class WildSearcherState;
 enum class Item : u8;
+template <int size>
+struct RecoverySeeds;
 
 /**
  * @brief Wild encounter searcher for Gen3
@@ -80,13 +82,15 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
      * @param feebas Whether the encounter location contains Feebas
      * @param safari Whether the encounter location is the Safari Zone in RSE
      * @param tanoby Whether the encounter location is Tanoby Ruins in FRLG
      *
      * @return Vector of computed states
      */
-    std::vector<WildSearcherState> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, bool feebas, bool safari, bool tanoby) const;
+    std::vector<WildSearcherState> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds, bool feebas,
+                                          bool safari, bool tanoby) const;
 };
 
 #endif // WILDSEARCHER3_HPP
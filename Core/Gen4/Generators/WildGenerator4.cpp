@@ -384,6 +384,7 @@ std::vector<WildGeneratorState4> WildGenerator4::generateMethodJ(u32 seed) const
 
     u32 battleAdvancesConst = getBattleAdvances(area, profile.getVersion());
     u8 movements = searchStepEncounter ? getStepMovements(area.getRate(), lead, whiteFlute) : 0;
+    const auto &slotTable = EncounterSlot::jTable(area.getEncounter());
 
     for (u32 cnt = 0; cnt <= maxAdvances; cnt++)
     {
@@ -426,7 +427,7 @@ std::vector<WildGeneratorState4> WildGenerator4::generateMethodJ(u32 seed) const
             }
             else
             {
-                encounterSlot = EncounterSlot::jSlot(go.nextUShort<false>(100, &battleAdvances), area.getEncounter());
+                encounterSlot = slotTable[go.nextUShort<false>(100, &battleAdvances)];
             }
         }
 
@@ -551,6 +552,7 @@ std::vector<WildGeneratorState4> WildGenerator4::generateMethodK(u32 seed) const
     auto jump = rng.getJump(offset);
 
     u32 battleAdvancesConst = getBattleAdvances(area, profile.getVersion());
+    const auto &slotTable = EncounterSlot::kTable(area.getEncounter());
     for (u32 cnt = 0; cnt <= maxAdvances; cnt++)
     {
         u32 battleAdvances = battleAdvancesConst + initialAdvances + offset + cnt;
@@ -606,7 +608,7 @@ std::vector<WildGeneratorState4> WildGenerator4::generateMethodK(u32 seed) const
             }
             else
             {
-                encounterSlot = EncounterSlot::kSlot(go.nextUShort(100, &battleAdvances), area.getEncounter());
+                encounterSlot = slotTable[go.nextUShort(100, &battleAdvances)];
             }
         }
 
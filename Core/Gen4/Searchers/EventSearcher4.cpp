@@ -35,37 +35,37 @@ void EventSearcher4::startSearch(const std::array<u8, 6> &min, const std::array<
 {
     searching = true;
 
+    std::vector<SearcherState4> states;
+    auto addStates = [&](const std::array<u8, 6> &ivs, const RecoverySeeds<6> &seeds) {
+        auto found = search(ivs[0], ivs[1], ivs[2], ivs[3], ivs[4], ivs[5], seeds, species, nature, level);
+        states.insert(states.end(), found.begin(), found.end());
+    };
+
+    u32 combinations = (max[3] - min[3] + 1) * (max[4] - min[4] + 1) * (max[5] - min[5] + 1);
     for (u8 hp = min[0]; hp <= max[0]; hp++)
     {
         for (u8 atk = min[1]; atk <= max[1]; atk++)
         {
             for (u8 def = min[2]; def <= max[2]; def++)
             {
-                for (u8 spa = min[3]; spa <= max[3]; spa++)
+                if (!searching)
                 {
-                    for (u8 spd = min[4]; spd <= max[4]; spd++)
-                    {
-                        for (u8 spe = min[5]; spe <= max[5]; spe++)
-                        {
-                            if (!searching)
-                            {
-                                return;
-                            }
-
-                            auto states = search(hp, atk, def, spa, spd, spe, species, nature, level);
-
-                            std::lock_guard<std::mutex> guard(mutex);
-                            results.insert(results.end(), states.begin(), states.end());
-                            progress++;
-                        }
-                    }
+                    return;
                 }
+
+                LCRNGReverse::recoverPokeRNGIVRow(hp, atk, def, min, max, Method::Method1, addStates);
+
+                std::lock_guard<std::mutex> guard(mutex);
+                results.insert(results.end(), states.begin(), states.end());
+                states.clear();
+                progress += combinations;
             }
         }
     }
 }
 
-std::vector<SearcherState4> EventSearcher4::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u16 species, u8 nature, u8 level) const
+std::vector<SearcherState4> EventSearcher4::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
+                                                   u16 species, u8 nature, u8 level) const
 {
     std::vector<SearcherState4> states;
     std::array<u8, 6> ivs = { hp, atk, def, spa, spd, spe };
@@ -77,7 +77,6 @@ std::vector<SearcherState4> EventSearcher4::search(u8 hp, u8 atk, u8 def, u8 spa
         return states;
     }
 
-    auto seeds = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, Method::Method1);
     for (int i = 0; i < seeds.count; i++)
     {
         PokeRNGR rng(seeds[i]);
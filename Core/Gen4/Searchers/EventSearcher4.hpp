@@ -25,6 +25,9 @@
 #include <Core/Parents/Filters/StateFilter.hpp>
 #include <Core/Parents/Searchers/Searcher.hpp>
 
+template <int size>
+struct RecoverySeeds;
+
 /**
  * @brief Event encounter searcher for Gen4
  */
@@ -70,13 +73,15 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
      * @param species Pokemon specie
      * @param nature Pokemon nature
      * @param level Pokemon level
      *
      * @return Vector of computed states
      */
-    std::vector<SearcherState4> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u16 species, u8 nature, u8 level) const;
+    std::vector<SearcherState4> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds, u16 species, u8 nature,
+                                       u8 level) const;
 
     /**
      * @brief Searches for initial seeds within min/max advances and min/max delay
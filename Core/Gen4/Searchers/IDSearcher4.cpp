@@ -20,44 +20,94 @@
 #include "IDSearcher4.hpp"
 #include <Core/Gen4/States/IDState4.hpp>
 #include <Core/RNG/MTFast.hpp>
+#include <Core/Util/Shard.hpp>
+#include <cstring>
 
-IDSearcher4::IDSearcher4(const IDFilter &filter) : filter(filter)
+IDSearcher4::IDSearcher4(const IDFilter &filter) : filter(filter), checkpointFailed(false)
 {
 }
 
 void IDSearcher4::startSearch(bool infinite, u16 year, u32 minDelay, u32 maxDelay)
 {
     searching = true;
+    checkpointFailed = false;
     maxDelay = infinite ? 0xe8ffff : maxDelay;
 
-    for (u32 efgh = minDelay; efgh <= maxDelay; efgh++)
+    // Checkpointed searches save every 4096 delays
+    auto units = Shard::split(minDelay, maxDelay, checkpoint.enabled() ? (maxDelay - minDelay) / 4096 + 1 : 1);
+
+    if (checkpoint.open(Checkpoint::hash(infinite, year, minDelay, maxDelay, filter.hash()), units.size()))
     {
-        for (u16 ab = 0; ab < 256; ab++)
+        std::vector<IDState4> found;
+        const std::string &data = checkpoint.getData();
+        for (size_t offset = 0; offset + sizeof(IDState4) <= data.size(); offset += sizeof(IDState4))
         {
-            for (u16 cd = 0; cd < 24; cd++)
+            IDState4 state(0, 0, 0, 0);
+            std::memcpy(&state, data.data() + offset, sizeof(IDState4));
+            found.emplace_back(state);
+        }
+
+        std::lock_guard<std::mutex> guard(mutex);
+        results = found;
+    }
+
+    for (const auto &unit : units)
+    {
+        if (checkpoint.isDone(unit.index))
+        {
+            progress += 256 * 24 * (unit.end - unit.start + 1);
+            continue;
+        }
+
+        std::vector<IDState4> unitResults;
+        for (u32 efgh = unit.start; efgh <= unit.end; efgh++)
+        {
+            for (u16 ab = 0; ab < 256; ab++)
             {
-                if (!searching)
+                for (u16 cd = 0; cd < 24; cd++)
                 {
-                    return;
-                }
+                    // A cancelled search keeps its checkpoint so it can be resumed
+                    if (!searching)
+                    {
+                        return;
+                    }
 
-                u32 seed = static_cast<u32>((ab << 24) | (cd << 16)) + efgh;
-                MTFast<2> mt(seed, 1);
+                    u32 seed = static_cast<u32>((ab << 24) | (cd << 16)) + efgh;
+                    MTFast<2> mt(seed, 1);
 
-                u32 sidtid = mt.next();
+                    u32 sidtid = mt.next();
 
-                u16 tid = sidtid & 0xffff;
-                u16 sid = sidtid >> 16;
+                    u16 tid = sidtid & 0xffff;
+                    u16 sid = sidtid >> 16;
 
-                IDState4 state(seed, efgh + 2000 - year, tid, sid);
-                if (filter.compareState(static_cast<const IDState &>(state)))
-                {
-                    std::lock_guard<std::mutex> guard(mutex);
-                    results.emplace_back(state);
-                }
+                    IDState4 state(seed, efgh + 2000 - year, tid, sid);
+                    if (filter.compareState(static_cast<const IDState &>(state)))
+                    {
+                        std::lock_guard<std::mutex> guard(mutex);
+                        results.emplace_back(state);
+                        if (checkpoint.enabled())
+                        {
+                            unitResults.emplace_back(state);
+                        }
+                    }
 
-                progress++;
+                    progress++;
+                }
             }
         }
+
+        // Records after a failed write can not be read back, so the rest of the search is not checkpointed
+        if (checkpoint.enabled() && !checkpointFailed)
+        {
+            std::string data(reinterpret_cast<const char *>(unitResults.data()), unitResults.size() * sizeof(IDState4));
+            checkpointFailed = !checkpoint.write(unit.index, data);
+        }
     }
+
+    checkpoint.remove();
+}
+
+void IDSearcher4::setCheckpoint(const std::string &file)
+{
+    checkpoint = Checkpoint(file);
 }
@@ -22,6 +22,7 @@
 
 #include <Core/Parents/Filters/IDFilter.hpp>
 #include <Core/Parents/Searchers/Searcher.hpp>
+#include <Core/Util/Checkpoint.hpp>
 
 class IDState4;
 
@@ -48,8 +49,30 @@ public:
      */
     void startSearch(bool infinite, u16 year, u32 minDelay, u32 maxDelay);
 
+    /**
+     * @brief Checkpoints the search to the \p file after each block of delays. Starting the same search again skips the delays the
+     * checkpoint completed and returns their results first. A cancelled search keeps its checkpoint so it can be resumed.
+     *
+     * @param file Path of the checkpoint
+     */
+    void setCheckpoint(const std::string &file);
+
+    /**
+     * @brief Returns if writing the checkpoint failed. The units completed after the failure are not checkpointed, so resuming the
+     * search repeats them.
+     *
+     * @return true Checkpoint could not be written
+     * @return false Checkpoint was written or is disabled
+     */
+    bool getCheckpointFailed() const
+    {
+        return checkpointFailed;
+    }
+
 private:
+    Checkpoint checkpoint;
     IDFilter filter;
+    bool checkpointFailed;
 };
 
 #endif // IDSEARCHER4_HPP
@@ -79,52 +79,51 @@ void StaticSearcher4::startSearch(const std::array<u8, 6> &min, const std::array
 {
     searching = true;
 
+    std::vector<SearcherState4> states;
+    auto addStates = [&](const std::array<u8, 6> &ivs, const RecoverySeeds<6> &seeds) {
+        auto found = search(ivs[0], ivs[1], ivs[2], ivs[3], ivs[4], ivs[5], seeds, staticTemplate);
+        states.insert(states.end(), found.begin(), found.end());
+    };
+
+    u32 combinations = (max[3] - min[3] + 1) * (max[4] - min[4] + 1) * (max[5] - min[5] + 1);
     for (u8 hp = min[0]; hp <= max[0]; hp++)
     {
         for (u8 atk = min[1]; atk <= max[1]; atk++)
         {
             for (u8 def = min[2]; def <= max[2]; def++)
             {
-                for (u8 spa = min[3]; spa <= max[3]; spa++)
+                if (!searching)
                 {
-                    for (u8 spd = min[4]; spd <= max[4]; spd++)
-                    {
-                        for (u8 spe = min[5]; spe <= max[5]; spe++)
-                        {
-                            if (!searching)
-                            {
-                                return;
-                            }
-
-                            auto states = search(hp, atk, def, spa, spd, spe, staticTemplate);
-
-                            std::lock_guard<std::mutex> guard(mutex);
-                            results.insert(results.end(), states.begin(), states.end());
-                            progress++;
-                        }
-                    }
+                    return;
                 }
+
+                LCRNGReverse::recoverPokeRNGIVRow(hp, atk, def, min, max, Method::Method1, addStates);
+
+                std::lock_guard<std::mutex> guard(mutex);
+                results.insert(results.end(), states.begin(), states.end());
+                states.clear();
+                progress += combinations;
             }
         }
     }
 }
 
-std::vector<SearcherState4> StaticSearcher4::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
+std::vector<SearcherState4> StaticSearcher4::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
                                                     const StaticTemplate4 *staticTemplate) const
 {
     std::vector<SearcherState4> states;
 
     if (method == Method::Method1)
     {
-        states = searchMethod1(hp, atk, def, spa, spd, spe, staticTemplate);
+        states = searchMethod1(hp, atk, def, spa, spd, spe, seeds, staticTemplate);
     }
     else if (method == Method::MethodJ)
     {
-        states = searchMethodJ(hp, atk, def, spa, spd, spe, staticTemplate);
+        states = searchMethodJ(hp, atk, def, spa, spd, spe, seeds, staticTemplate);
     }
     else if (method == Method::MethodK)
     {
-        states = searchMethodK(hp, atk, def, spa, spd, spe, staticTemplate);
+        states = searchMethodK(hp, atk, def, spa, spd, spe, seeds, staticTemplate);
     }
 
     return searchInitialSeeds(states);
@@ -158,14 +157,13 @@ std::vector<SearcherState4> StaticSearcher4::searchInitialSeeds(const std::vecto
     return states;
 }
 
-std::vector<SearcherState4> StaticSearcher4::searchMethod1(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
+std::vector<SearcherState4> StaticSearcher4::searchMethod1(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
                                                            const StaticTemplate4 *staticTemplate) const
 {
     std::vector<SearcherState4> states;
     std::array<u8, 6> ivs = { hp, atk, def, spa, spd, spe };
     const PersonalInfo *info = staticTemplate->getInfo();
 
-    auto seeds = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, Method::Method1);
     for (int i = 0; i < seeds.count; i++)
     {
         PokeRNGR rng(seeds[i]);
@@ -216,14 +214,13 @@ std::vector<SearcherState4> StaticSearcher4::searchMethod1(u8 hp, u8 atk, u8 def
     return states;
 }
 
-std::vector<SearcherState4> StaticSearcher4::searchMethodJ(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
+std::vector<SearcherState4> StaticSearcher4::searchMethodJ(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
                                                            const StaticTemplate4 *staticTemplate) const
 {
     std::vector<SearcherState4> states;
     std::array<u8, 6> ivs = { hp, atk, def, spa, spd, spe };
     const PersonalInfo *info = staticTemplate->getInfo();
 
-    auto seeds = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, Method::Method1);
     for (int i = 0; i < seeds.count; i++)
     {
         PokeRNGR rng(seeds[i]);
@@ -321,14 +318,13 @@ std::vector<SearcherState4> StaticSearcher4::searchMethodJ(u8 hp, u8 atk, u8 def
     return states;
 }
 
-std::vector<SearcherState4> StaticSearcher4::searchMethodK(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
+std::vector<SearcherState4> StaticSearcher4::searchMethodK(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
                                                            const StaticTemplate4 *staticTemplate) const
 {
     std::vector<SearcherState4> states;
     std::array<u8, 6> ivs = { hp, atk, def, spa, spd, spe };
     const PersonalInfo *info = staticTemplate->getInfo();
 
-    auto seeds = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, Method::Method1);
     for (int i = 0; i < seeds.count; i++)
     {
         PokeRNGR rng(seeds[i]);
@@ -608,93 +608,90 @@ void WildSearcher4::startSearch(const std::array<u8, 6> &min, const std::array<u
 {
     searching = true;
 
+    std::vector<WildSearcherState4> rowStates;
+    auto addStates = [&](const std::array<u8, 6> &ivs, const RecoverySeeds<6> &seeds) {
+        std::vector<WildSearcherState4> mergedStates;
+        for (Lead activeLead : leads)
+        {
+            lead = activeLead;
+            modifiedSlots = area.getSlots(activeLead);
+            thresh = area.getRate();
+            if ((profile.getVersion() & Game::HGSS) != Game::None)
+            {
+                if (area.getEncounter() == Encounter::OldRod || area.getEncounter() == Encounter::GoodRod
+                    || area.getEncounter() == Encounter::SuperRod)
+                {
+                    thresh += happiness;
+                    if (activeLead == Lead::SuctionCups)
+                    {
+                        thresh *= 2;
+                    }
+                }
+                else if (activeLead == Lead::ArenaTrap && area.getEncounter() == Encounter::RockSmash)
+                {
+                    thresh *= 2;
+                }
+            }
+
+            auto states = search(ivs[0], ivs[1], ivs[2], ivs[3], ivs[4], ivs[5], seeds, index);
+            for (auto &state : states)
+            {
+                state.setLead(activeLead);
+                addOrMerge(mergedStates, state);
+            }
+        }
+        rowStates.insert(rowStates.end(), mergedStates.begin(), mergedStates.end());
+    };
+
+    u32 combinations = (max[3] - min[3] + 1) * (max[4] - min[4] + 1) * (max[5] - min[5] + 1);
     for (u8 hp = min[0]; hp <= max[0]; hp++)
     {
         for (u8 atk = min[1]; atk <= max[1]; atk++)
         {
             for (u8 def = min[2]; def <= max[2]; def++)
             {
-                for (u8 spa = min[3]; spa <= max[3]; spa++)
+                if (!searching)
                 {
-                    for (u8 spd = min[4]; spd <= max[4]; spd++)
-                    {
-                        for (u8 spe = min[5]; spe <= max[5]; spe++)
-                        {
-                            if (!searching)
-                            {
-                                return;
-                            }
-
-                            std::vector<WildSearcherState4> mergedStates;
-                            for (Lead activeLead : leads)
-                            {
-                                lead = activeLead;
-                                modifiedSlots = area.getSlots(activeLead);
-                                thresh = area.getRate();
-                                if ((profile.getVersion() & Game::HGSS) != Game::None)
-                                {
-                                    if (area.getEncounter() == Encounter::OldRod || area.getEncounter() == Encounter::GoodRod
-                                        || area.getEncounter() == Encounter::SuperRod)
-                                    {
-                                        thresh += happiness;
-                                        if (activeLead == Lead::SuctionCups)
-                                        {
-                                            thresh *= 2;
-                                        }
-                                    }
-                                    else if (activeLead == Lead::ArenaTrap && area.getEncounter() == Encounter::RockSmash)
-                                    {
-                                        thresh *= 2;
-                                    }
-                                }
-
-                                auto states = search(hp, atk, def, spa, spd, spe, index);
-                                for (auto &state : states)
-                                {
-                                    state.setLead(activeLead);
-                                    addOrMerge(mergedStates, state);
-                                }
+                    return;
+                }
 
-                                progress++;
-                            }
+                LCRNGReverse::recoverPokeRNGIVRow(hp, atk, def, min, max, Method::Method1, addStates);
 
-                            {
-                                std::lock_guard<std::mutex> guard(mutex);
-                                results.insert(results.end(), mergedStates.begin(), mergedStates.end());
-                            }
-                        }
-                    }
-                }
+                std::lock_guard<std::mutex> guard(mutex);
+                results.insert(results.end(), rowStates.begin(), rowStates.end());
+                rowStates.clear();
+                progress += combinations * leads.size();
             }
         }
     }
 }
 
-std::vector<WildSearcherState4> WildSearcher4::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 index) const
+std::vector<WildSearcherState4> WildSearcher4::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
+                                                      u8 index) const
 {
     std::vector<WildSearcherState4> states;
 
     if (method == Method::MethodJ)
     {
-        states = searchMethodJ(hp, atk, def, spa, spd, spe);
+        states = searchMethodJ(hp, atk, def, spa, spd, spe, seeds);
     }
     else if (method == Method::MethodK)
     {
-        states = searchMethodK(hp, atk, def, spa, spd, spe);
+        states = searchMethodK(hp, atk, def, spa, spd, spe, seeds);
     }
     else if (method == Method::HoneyTree)
     {
-        states = searchHoneyTree(hp, atk, def, spa, spd, spe, index);
+        states = searchHoneyTree(hp, atk, def, spa, spd, spe, seeds, index);
     }
     else if (method == Method::PokeRadar)
     {
         if (shiny)
         {
-            states = searchPokeRadarShiny(hp, atk, def, spa, spd, spe, index);
+            states = searchPokeRadarShiny(hp, atk, def, spa, spd, spe, seeds, index);
         }
         else
         {
-            states = searchPokeRadar(hp, atk, def, spa, spd, spe, index);
+            states = searchPokeRadar(hp, atk, def, spa, spd, spe, seeds, index);
         }
     }
 
@@ -754,7 +751,8 @@ std::vector<WildSearcherState4> WildSearcher4::searchInitialSeeds(const std::vec
     return states;
 }
 
-std::vector<WildSearcherState4> WildSearcher4::searchMethodJ(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const
+std::vector<WildSearcherState4> WildSearcher4::searchMethodJ(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
+                                                             const RecoverySeeds<6> &seeds) const
 {
     std::vector<WildSearcherState4> states;
 
@@ -762,8 +760,8 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodJ(u8 hp, u8 atk, u8 d
     bool grass = area.getEncounter() == Encounter::Grass;
     bool nibble = area.getEncounter() == Encounter::OldRod || area.getEncounter() == Encounter::GoodRod
         || area.getEncounter() == Encounter::SuperRod;
+    const auto &slotTable = EncounterSlot::jTable(area.getEncounter());
 
-    auto seeds = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, Method::Method1);
     for (int i = 0; i < seeds.count; i++)
     {
         PokeRNGR rng(seeds[i]);
@@ -796,18 +794,18 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodJ(u8 hp, u8 atk, u8 d
                         }
                         else
                         {
-                            encounterSlot = EncounterSlot::jSlot(rand, area.getEncounter());
+                            encounterSlot = slotTable[rand];
                         }
                     }
                     else
                     {
-                        encounterSlot = EncounterSlot::jSlot(rng.nextUShort<false>(100), area.getEncounter());
+                        encounterSlot = slotTable[rng.nextUShort<false>(100)];
                         rng.advance(1);
                     }
                 }
                 else
                 {
-                    encounterSlot = EncounterSlot::jSlot(rng.nextUShort<false>(100), area.getEncounter());
+                    encounterSlot = slotTable[rng.nextUShort<false>(100)];
                 }
 
                 if (filter.compareEncounterSlot(encounterSlot) && (!nibble || rng.nextUShort<false>(100) < thresh))
@@ -888,7 +886,7 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodJ(u8 hp, u8 atk, u8 d
                     {
                         if (grass)
                         {
-                            encounterSlot[0] = EncounterSlot::jSlot(nextRNG2 / 0x290, area.getEncounter());
+                            encounterSlot[0] = slotTable[nextRNG2 / 0x290];
                             valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                         }
                         else
@@ -906,20 +904,20 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodJ(u8 hp, u8 atk, u8 d
                                     }
                                     else
                                     {
-                                        encounterSlot[0] = EncounterSlot::jSlot(rand, area.getEncounter());
+                                        encounterSlot[0] = slotTable[rand];
                                     }
                                     valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                                 }
                                 else
                                 {
-                                    encounterSlot[0] = EncounterSlot::jSlot(test[0].nextUShort<false>(100), area.getEncounter());
+                                    encounterSlot[0] = slotTable[test[0].nextUShort<false>(100)];
                                     test[0].advance(1);
                                     valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                                 }
                             }
                             else
                             {
-                                encounterSlot[0] = EncounterSlot::jSlot(test[0].nextUShort<false>(100), area.getEncounter());
+                                encounterSlot[0] = slotTable[test[0].nextUShort<false>(100)];
                                 valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                             }
                         }
@@ -930,7 +928,7 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodJ(u8 hp, u8 atk, u8 d
                     {
                         if (grass)
                         {
-                            encounterSlot[0] = EncounterSlot::jSlot(nextRNG2 / 0x290, area.getEncounter());
+                            encounterSlot[0] = slotTable[nextRNG2 / 0x290];
                             valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                         }
                         else
@@ -948,20 +946,20 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodJ(u8 hp, u8 atk, u8 d
                                     }
                                     else
                                     {
-                                        encounterSlot[0] = EncounterSlot::jSlot(rand, area.getEncounter());
+                                        encounterSlot[0] = slotTable[rand];
                                     }
                                     valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                                 }
                                 else
                                 {
-                                    encounterSlot[0] = EncounterSlot::jSlot(test[0].nextUShort<false>(100), area.getEncounter());
+                                    encounterSlot[0] = slotTable[test[0].nextUShort<false>(100)];
                                     test[0].advance(1);
                                     valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                                 }
                             }
                             else
                             {
-                                encounterSlot[0] = EncounterSlot::jSlot(test[0].nextUShort<false>(100), area.getEncounter());
+                                encounterSlot[0] = slotTable[test[0].nextUShort<false>(100)];
                                 valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                             }
                         }
@@ -971,7 +969,7 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodJ(u8 hp, u8 atk, u8 d
                     {
                         if (grass)
                         {
-                            encounterSlot[1] = EncounterSlot::jSlot(test[1].nextUShort<false>(100), area.getEncounter());
+                            encounterSlot[1] = slotTable[test[1].nextUShort<false>(100)];
                             valid[1] = filter.compareEncounterSlot(encounterSlot[1]);
                         }
                         else
@@ -989,20 +987,20 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodJ(u8 hp, u8 atk, u8 d
                                     }
                                     else
                                     {
-                                        encounterSlot[1] = EncounterSlot::jSlot(rand, area.getEncounter());
+                                        encounterSlot[1] = slotTable[rand];
                                     }
                                     valid[1] = filter.compareEncounterSlot(encounterSlot[1]);
                                 }
                                 else
                                 {
-                                    encounterSlot[1] = EncounterSlot::jSlot(test[1].nextUShort<false>(100), area.getEncounter());
+                                    encounterSlot[1] = slotTable[test[1].nextUShort<false>(100)];
                                     test[1].advance(1);
                                     valid[1] = filter.compareEncounterSlot(encounterSlot[1]);
                                 }
                             }
                             else
                             {
-                                encounterSlot[1] = EncounterSlot::jSlot(test[1].nextUShort<false>(100), area.getEncounter());
+                                encounterSlot[1] = slotTable[test[1].nextUShort<false>(100)];
                                 valid[1] = filter.compareEncounterSlot(encounterSlot[1]);
                             }
                         }
@@ -1030,7 +1028,7 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodJ(u8 hp, u8 atk, u8 d
                         }
                         else
                         {
-                            slot = EncounterSlot::jSlot(encounterRand / 0x290, area.getEncounter());
+                            slot = slotTable[encounterRand / 0x290];
                         }
 
                         if (feebas)
@@ -1067,7 +1065,7 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodJ(u8 hp, u8 atk, u8 d
                         force = (nextRNG2 / 0x8000) != 0;
                         if (grass)
                         {
-                            encounterSlot[0] = EncounterSlot::jSlot(test[0].nextUShort<false>(100), area.getEncounter());
+                            encounterSlot[0] = slotTable[test[0].nextUShort<false>(100)];
                             valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                         }
                         else
@@ -1085,20 +1083,20 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodJ(u8 hp, u8 atk, u8 d
                                     }
                                     else
                                     {
-                                        encounterSlot[0] = EncounterSlot::jSlot(rand, area.getEncounter());
+                                        encounterSlot[0] = slotTable[rand];
                                     }
                                     valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                                 }
                                 else
                                 {
-                                    encounterSlot[0] = EncounterSlot::jSlot(test[0].nextUShort<false>(100), area.getEncounter());
+                                    encounterSlot[0] = slotTable[test[0].nextUShort<false>(100)];
                                     test[0].advance(1);
                                     valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                                 }
                             }
                             else
                             {
-                                encounterSlot[0] = EncounterSlot::jSlot(test[0].nextUShort<false>(100), area.getEncounter());
+                                encounterSlot[0] = slotTable[test[0].nextUShort<false>(100)];
                                 valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                             }
                         }
@@ -1151,7 +1149,8 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodJ(u8 hp, u8 atk, u8 d
     return states;
 }
 
-std::vector<WildSearcherState4> WildSearcher4::searchMethodK(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const
+std::vector<WildSearcherState4> WildSearcher4::searchMethodK(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
+                                                             const RecoverySeeds<6> &seeds) const
 {
     std::vector<WildSearcherState4> states;
 
@@ -1159,8 +1158,8 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodK(u8 hp, u8 atk, u8 d
     bool grass = area.getEncounter() == Encounter::Grass;
     bool nibble = area.getEncounter() == Encounter::RockSmash || area.getEncounter() == Encounter::OldRod
         || area.getEncounter() == Encounter::GoodRod || area.getEncounter() == Encounter::SuperRod;
+    const auto &slotTable = EncounterSlot::kTable(area.getEncounter());
 
-    auto seeds = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, Method::Method1);
     for (int i = 0; i < seeds.count; i++)
     {
         PokeRNGR rng(seeds[i]);
@@ -1203,12 +1202,12 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodK(u8 hp, u8 atk, u8 d
                 }
                 else if (grass)
                 {
-                    encounterSlot = EncounterSlot::kSlot(rng.nextUShort(100), area.getEncounter());
+                    encounterSlot = slotTable[rng.nextUShort(100)];
                 }
                 else
                 {
                     levelRand = rng.nextUShort();
-                    encounterSlot = EncounterSlot::kSlot(rng.nextUShort(100), area.getEncounter());
+                    encounterSlot = slotTable[rng.nextUShort(100)];
                 }
 
                 if (!filter.compareEncounterSlot(encounterSlot))
@@ -1295,12 +1294,12 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodK(u8 hp, u8 atk, u8 d
                         }
                         else if (grass)
                         {
-                            encounterSlot[0] = EncounterSlot::kSlot(nextRNG2 % 100, area.getEncounter());
+                            encounterSlot[0] = slotTable[nextRNG2 % 100];
                         }
                         else
                         {
                             levelRand[0] = nextRNG2;
-                            encounterSlot[0] = EncounterSlot::kSlot(test[0].nextUShort(100), area.getEncounter());
+                            encounterSlot[0] = slotTable[test[0].nextUShort(100)];
                         }
                         valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                     }
@@ -1314,12 +1313,12 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodK(u8 hp, u8 atk, u8 d
                         }
                         else if (grass)
                         {
-                            encounterSlot[0] = EncounterSlot::kSlot(nextRNG2 % 100, area.getEncounter());
+                            encounterSlot[0] = slotTable[nextRNG2 % 100];
                         }
                         else
                         {
                             levelRand[0] = nextRNG2;
-                            encounterSlot[0] = EncounterSlot::kSlot(test[0].nextUShort(100), area.getEncounter());
+                            encounterSlot[0] = slotTable[test[0].nextUShort(100)];
                         }
                         valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                     }
@@ -1332,12 +1331,12 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodK(u8 hp, u8 atk, u8 d
                         }
                         else if (grass)
                         {
-                            encounterSlot[1] = EncounterSlot::kSlot(test[1].nextUShort(100), area.getEncounter());
+                            encounterSlot[1] = slotTable[test[1].nextUShort(100)];
                         }
                         else
                         {
                             levelRand[1] = test[1].nextUShort();
-                            encounterSlot[1] = EncounterSlot::kSlot(test[1].nextUShort(100), area.getEncounter());
+                            encounterSlot[1] = slotTable[test[1].nextUShort(100)];
                         }
                         valid[1] = filter.compareEncounterSlot(encounterSlot[1]);
                     }
@@ -1367,7 +1366,7 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodK(u8 hp, u8 atk, u8 d
                         }
                         else
                         {
-                            encounterSlot[0] = EncounterSlot::kSlot(encounterRand % 100, area.getEncounter());
+                            encounterSlot[0] = slotTable[encounterRand % 100];
                         }
                         valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                     }
@@ -1382,12 +1381,12 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodK(u8 hp, u8 atk, u8 d
                         }
                         else if (grass)
                         {
-                            encounterSlot[0] = EncounterSlot::kSlot(test[0].nextUShort(100), area.getEncounter());
+                            encounterSlot[0] = slotTable[test[0].nextUShort(100)];
                         }
                         else
                         {
                             levelRand[0] = test[0].nextUShort();
-                            encounterSlot[0] = EncounterSlot::kSlot(test[0].nextUShort(100), area.getEncounter());
+                            encounterSlot[0] = slotTable[test[0].nextUShort(100)];
                         }
                         valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                     }
@@ -1434,7 +1433,8 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodK(u8 hp, u8 atk, u8 d
     return states;
 }
 
-std::vector<WildSearcherState4> WildSearcher4::searchHoneyTree(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 index) const
+std::vector<WildSearcherState4> WildSearcher4::searchHoneyTree(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
+                                                               u8 index) const
 {
     std::vector<WildSearcherState4> states;
 
@@ -1453,7 +1453,6 @@ std::vector<WildSearcherState4> WildSearcher4::searchHoneyTree(u8 hp, u8 atk, u8
         }
     }
 
-    auto seeds = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, Method::Method1);
     for (int i = 0; i < seeds.count; i++)
     {
         PokeRNGR rng(seeds[i]);
@@ -1560,7 +1559,8 @@ std::vector<WildSearcherState4> WildSearcher4::searchHoneyTree(u8 hp, u8 atk, u8
     return states;
 }
 
-std::vector<WildSearcherState4> WildSearcher4::searchPokeRadar(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 index) const
+std::vector<WildSearcherState4> WildSearcher4::searchPokeRadar(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
+                                                               u8 index) const
 {
     std::vector<WildSearcherState4> states;
 
@@ -1579,7 +1579,6 @@ std::vector<WildSearcherState4> WildSearcher4::searchPokeRadar(u8 hp, u8 atk, u8
         }
     }
 
-    auto seeds = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, Method::Method1);
     for (int i = 0; i < seeds.count; i++)
     {
         PokeRNGR rng(seeds[i]);
@@ -1672,7 +1671,8 @@ std::vector<WildSearcherState4> WildSearcher4::searchPokeRadar(u8 hp, u8 atk, u8
     return states;
 }
 
-std::vector<WildSearcherState4> WildSearcher4::searchPokeRadarShiny(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 index) const
+std::vector<WildSearcherState4> WildSearcher4::searchPokeRadarShiny(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
+                                                                    const RecoverySeeds<6> &seeds, u8 index) const
 {
     std::vector<WildSearcherState4> states;
 
@@ -1690,7 +1690,6 @@ std::vector<WildSearcherState4> WildSearcher4::searchPokeRadarShiny(u8 hp, u8 at
         return (pid & 0xff) < info->getGender();
     };
 
-    auto seeds = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, Method::Method1);
     for (int i = 0; i < seeds.count; i++)
     {
         PokeRNGR rng(seeds[i]);
@@ -28,6 +28,8 @@
 #include <vector>
 
 class WildSearcherState4;
+template <int size>
+struct RecoverySeeds;
 
 /**
  * @brief Wild encounter searcher for Gen 4
@@ -104,11 +106,12 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
      * @param index Pokeradar slot index
      *
      * @return Vector of computed states
      */
-    std::vector<WildSearcherState4> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 index) const;
+    std::vector<WildSearcherState4> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds, u8 index) const;
 
     /**
      * @brief Searches for initial seeds within min/max advances and min/max delay
@@ -128,10 +131,11 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
      *
      * @return Vector of computed states
      */
-    std::vector<WildSearcherState4> searchMethodJ(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const;
+    std::vector<WildSearcherState4> searchMethodJ(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds) const;
 
     /**
      * @brief Searches for matching states from provided IVs via Method K
@@ -142,10 +146,11 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
      *
      * @return Vector of computed states
      */
-    std::vector<WildSearcherState4> searchMethodK(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const;
+    std::vector<WildSearcherState4> searchMethodK(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds) const;
 
     /**
      * @brief Searches for matching states from provided IVs via Honey Tree
@@ -156,10 +161,12 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
      *
      * @return Vector of computed states
      */
-    std::vector<WildSearcherState4> searchHoneyTree(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 index) const;
+    std::vector<WildSearcherState4> searchHoneyTree(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
+                                                    u8 index) const;
 
     /**
      * @brief Searches for matching states from provided IVs via Poke Radar
@@ -170,10 +177,12 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
      *
      * @return Vector of computed states
      */
-    std::vector<WildSearcherState4> searchPokeRadar(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 index) const;
+    std::vector<WildSearcherState4> searchPokeRadar(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
+                                                    u8 index) const;
 
     /**
      * @brief Searches for matching states from provided IVs via Poke Radar chained shiny
@@ -184,10 +193,12 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
      *
      * @return Vector of computed states
      */
-    std::vector<WildSearcherState4> searchPokeRadarShiny(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 index) const;
+    std::vector<WildSearcherState4> searchPokeRadarShiny(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
+                                                         u8 index) const;
 };
 
 #endif // WILDSEARCHER4_HPP
@@ -19,27 +19,28 @@
 
 #include "HiddenGrottoFilter.hpp"
 #include <Core/Gen5/States/HiddenGrottoState.hpp>
+#include <Core/Parents/Filters/FilterMask.hpp>
 
 HiddenGrottoFilter::HiddenGrottoFilter(const std::array<bool, 11> &encounterSlots, const std::array<bool, 2> &genders,
                                        const std::array<bool, 4> &groups) :
-    encounterSlots(encounterSlots), genders(genders), groups(groups)
+    encounterSlots(compileMask(encounterSlots)), genders(compileMask(genders)), groups(compileMask(groups))
 {
 }
 
 bool HiddenGrottoFilter::compareState(const HiddenGrottoState &state) const
 {
-    if (!encounterSlots[state.getSlot()])
+    if (!((encounterSlots >> state.getSlot()) & 1))
     {
         return false;
     }
 
     // Only check gender filter if not an item
-    if (!state.getItem() && !genders[state.getGender()])
+    if (!state.getItem() && !((genders >> state.getGender()) & 1))
     {
         return false;
     }
 
-    if (!groups[state.getGroup()])
+    if (!((groups >> state.getGroup()) & 1))
     {
         return false;
     }
@@ -20,6 +20,7 @@
 #ifndef HIDDENGROTTOFILTER_HPP
 #define HIDDENGROTTOFILTER_HPP
 
+#include <Core/Global.hpp>
 #include <array>
 
 class HiddenGrottoState;
@@ -47,9 +48,9 @@ public:
     bool compareState(const HiddenGrottoState &state) const;
 
 private:
-    std::array<bool, 11> encounterSlots;
-    std::array<bool, 2> genders;
-    std::array<bool, 4> groups;
+    u16 encounterSlots;
+    u8 genders;
+    u8 groups;
 };
 
 #endif // HIDDENGROTTOFILTER_HPP
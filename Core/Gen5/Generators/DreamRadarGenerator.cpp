@@ -63,11 +63,16 @@ DreamRadarGenerator::DreamRadarGenerator(u32 initialAdvances, u32 maxAdvances, u
 }
 
 std::vector<DreamRadarState> DreamRadarGenerator::generate(u64 seed) const
+{
+    return generatePrecomputed(seed, Utilities5::initialAdvancesBW2(seed, profile.getMemoryLink()));
+}
+
+std::vector<DreamRadarState> DreamRadarGenerator::generatePrecomputed(u64 seed, u32 advances) const
 {
     const PersonalInfo *info = radarTemplate.getInfo();
     u8 gender = radarTemplate.getLegend() && !radarTemplate.getGenie() ? 2 : radarTemplate.getGender();
 
-    BWRNG rng(seed, (initialAdvances * 2) + Utilities5::initialAdvancesBW2(seed, profile.getMemoryLink()));
+    BWRNG rng(seed, (initialAdvances * 2) + advances);
     auto jump = rng.getJump(pidAdvances);
 
     if (!profile.getMemoryLink())
@@ -56,6 +56,16 @@ public:
      */
     std::vector<DreamRadarState> generate(u64 seed) const;
 
+    /**
+     * @brief Generates states with the initial advances of the \p seed already calculated
+     *
+     * @param seed Starting PRNG state
+     * @param advances Initial advances of the \p seed
+     *
+     * @return Vector of computed states
+     */
+    std::vector<DreamRadarState> generatePrecomputed(u64 seed, u32 advances) const;
+
 private:
     DreamRadarTemplate radarTemplate;
     u8 ivAdvances;
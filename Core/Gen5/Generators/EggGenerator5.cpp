@@ -46,16 +46,42 @@ std::vector<EggState5> EggGenerator5::generate(u64 seed) const
     {
     case Game::Black:
     case Game::White:
-        return generateBW(seed);
+        return generateBW(seed, Utilities5::initialAdvancesBW(seed));
     case Game::Black2:
     case Game::White2:
-        return generateBW2(seed);
+        return generateBW2(seed, nullptr);
     default:
         return std::vector<EggState5>();
     }
 }
 
-std::vector<EggState5> EggGenerator5::generateBW(u64 seed) const
+std::vector<EggState5> EggGenerator5::generatePrecomputed(u64 seed, u32 advances) const
+{
+    switch (profile.getVersion())
+    {
+    case Game::Black:
+    case Game::White:
+        return generateBW(seed, advances);
+    case Game::Black2:
+    case Game::White2:
+        return generateBW2(seed, &advances);
+    default:
+        return std::vector<EggState5>();
+    }
+}
+
+bool EggGenerator5::acceptsSeed(u64 seed) const
+{
+    if ((profile.getVersion() & Game::BW2) == Game::None)
+    {
+        return true;
+    }
+
+    const PersonalInfo *info = nullptr;
+    return compareBW2Egg(generateBW2Egg(seed, &info));
+}
+
+std::vector<EggState5> EggGenerator5::generateBW(u64 seed, u32 advances) const
 {
     const PersonalInfo *base = PersonalLoader::getPersonal(profile.getVersion(), daycare.getEggSpecie());
     const PersonalInfo *male;
@@ -75,7 +101,6 @@ std::vector<EggState5> EggGenerator5::generateBW(u64 seed) const
     std::array<u8, 6> mtIVs;
     std::ranges::generate(mtIVs, [&mt] { return mt.next(); });
 
-    u32 advances = Utilities5::initialAdvances(seed, profile);
     BWRNG rng(seed, advances + initialAdvances);
     auto jump = rng.getJump(offset);
 
@@ -185,23 +210,18 @@ std::vector<EggState5> EggGenerator5::generateBW(u64 seed) const
     return states;
 }
 
-std::vector<EggState5> EggGenerator5::generateBW2(u64 seed) const
+std::vector<EggState5> EggGenerator5::generateBW2(u64 seed, const u32 *precomputed) const
 {
     std::vector<EggState5> states;
 
-    MTFast<4> mt(seed >> 32, 2);
-
-    u64 eggSeed = static_cast<u64>(mt.next()) << 32;
-    eggSeed |= mt.next();
-
     const PersonalInfo *info = nullptr;
-    EggState5 state = generateBW2Egg(eggSeed, &info);
+    EggState5 state = generateBW2Egg(seed, &info);
     u8 ability = state.getAbility() == 2 ? 0 : state.getAbility();
 
-    if (filter.compareAbility(state.getAbility()) && filter.compareNature(state.getNature()) && filter.compareIV(state.getIVs())
-        && filter.compareHiddenPower(state.getHiddenPower()))
+    if (compareBW2Egg(state))
     {
-        u32 advances = Utilities5::initialAdvances(seed, profile);
+        // Searchers pass the initial advances calculated for the whole SHA1 batch, otherwise calculate them once the egg passes the filter
+        u32 advances = precomputed ? *precomputed : Utilities5::initialAdvancesBW2(seed, profile.getMemoryLink());
         BWRNG rng(seed, advances + initialAdvances);
         auto jump = rng.getJump(offset);
 
@@ -232,7 +252,12 @@ std::vector<EggState5> EggGenerator5::generateBW2(u64 seed) const
 
 EggState5 EggGenerator5::generateBW2Egg(u64 seed, const PersonalInfo **info) const
 {
-    BWRNG rng(seed);
+    MTFast<4> mt(seed >> 32, 2);
+
+    u64 eggSeed = static_cast<u64>(mt.next()) << 32;
+    eggSeed |= mt.next();
+
+    BWRNG rng(eggSeed);
 
     // Nidoran
     // Volbeat / Illumise
@@ -348,3 +373,9 @@ EggState5 EggGenerator5::generateBW2Egg(u64 seed, const PersonalInfo **info) con
 
     return EggState5(ivs, ability, nature, inheritance, *info);
 }
+
+bool EggGenerator5::compareBW2Egg(const EggState5 &state) const
+{
+    return filter.compareAbility(state.getAbility()) && filter.compareNature(state.getNature()) && filter.compareIV(state.getIVs())
+        && filter.compareHiddenPower(state.getHiddenPower());
+}
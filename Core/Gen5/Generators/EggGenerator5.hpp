@@ -55,6 +55,27 @@ public:
      */
     std::vector<EggState5> generate(u64 seed) const;
 
+    /**
+     * @brief Generates states with the initial advances of the \p seed already calculated
+     *
+     * @param seed Starting PRNG state
+     * @param advances Initial advances of the \p seed
+     *
+     * @return Vector of computed states
+     */
+    std::vector<EggState5> generatePrecomputed(u64 seed, u32 advances) const;
+
+    /**
+     * @brief Checks if the part of the egg that does not depend on the initial advances passes the filter.
+     * Searchers use this to skip calculating the initial advances of seeds that can not produce any states.
+     *
+     * @param seed Starting PRNG state
+     *
+     * @return true Seed can produce states
+     * @return false Seed can not produce states
+     */
+    bool acceptsSeed(u64 seed) const;
+
 private:
     bool ditto;
     u8 everstone;
@@ -62,9 +83,10 @@ private:
     u8 poweritem;
     u8 rolls;
 
-    std::vector<EggState5> generateBW(u64 seed) const;
-    std::vector<EggState5> generateBW2(u64 seed) const;
+    std::vector<EggState5> generateBW(u64 seed, u32 advances) const;
+    std::vector<EggState5> generateBW2(u64 seed, const u32 *precomputed) const;
     EggState5 generateBW2Egg(u64 seed, const PersonalInfo **info) const;
+    bool compareBW2Egg(const EggState5 &state) const;
 };
 
 #endif // EGGGENERATOR5_HPP
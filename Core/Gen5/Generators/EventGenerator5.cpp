@@ -36,10 +36,14 @@ EventGenerator5::EventGenerator5(u32 initialAdvances, u32 maxAdvances, u32 offse
 }
 
 std::vector<EventState5> EventGenerator5::generate(u64 seed) const
+{
+    return generatePrecomputed(seed, Utilities5::initialAdvances(seed, profile));
+}
+
+std::vector<EventState5> EventGenerator5::generatePrecomputed(u64 seed, u32 advances) const
 {
     const PersonalInfo *info = PersonalLoader::getPersonal(profile.getVersion(), pgf.getSpecies());
 
-    u32 advances = Utilities5::initialAdvances(seed, profile);
     BWRNG rng(seed, advances + initialAdvances);
     auto jump = rng.getJump(pgf.getAdvances() + offset);
     u8 abilitySpec = pgf.getAbility() == 2 ? 0 : pgf.getAbility();
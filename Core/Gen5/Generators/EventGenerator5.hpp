@@ -54,6 +54,16 @@ public:
      */
     std::vector<EventState5> generate(u64 seed) const;
 
+    /**
+     * @brief Generates states with the initial advances of the \p seed already calculated
+     *
+     * @param seed Starting PRNG state
+     * @param advances Initial advances of the \p seed
+     *
+     * @return Vector of computed states
+     */
+    std::vector<EventState5> generatePrecomputed(u64 seed, u32 advances) const;
+
 private:
     PGF pgf;
 };
@@ -35,16 +35,23 @@
 
 constexpr std::array<u8, 10> encounterThresholds = { 1, 5, 20, 21, 25, 35, 60, 61, 65, 75 };
 
-static u8 getEncounterSlot(u8 rand, u8 slot)
-{
+// Encounter slot of each PRNG call below the last threshold
+constexpr auto encounterSlots = [] {
+    std::array<u8, 75> slots;
+    u8 rand = 0;
     for (u8 i = 0; i < encounterThresholds.size(); i++)
     {
-        if (rand < encounterThresholds[i])
+        for (; rand < encounterThresholds[i]; rand++)
         {
-            return i;
+            slots[rand] = i;
         }
     }
-    return slot;
+    return slots;
+}();
+
+static u8 getEncounterSlot(u8 rand, u8 slot)
+{
+    return rand < encounterSlots.size() ? encounterSlots[rand] : slot;
 }
 
 static u8 gen(MT &rng)
@@ -78,11 +85,16 @@ HiddenGrottoSlotGenerator::HiddenGrottoSlotGenerator(u32 initialAdvances, u32 ma
 }
 
 std::vector<HiddenGrottoState> HiddenGrottoSlotGenerator::generate(u64 seed) const
+{
+    return generatePrecomputed(seed, Utilities5::initialAdvancesBW2(seed, profile.getMemoryLink()));
+}
+
+std::vector<HiddenGrottoState> HiddenGrottoSlotGenerator::generatePrecomputed(u64 seed, u32 advances) const
 {
     std::vector<HiddenGrottoState> states;
     for (u8 activePowerLevel : powerLevels)
     {
-        auto powerStates = generate(seed, activePowerLevel);
+        auto powerStates = generate(seed, advances, activePowerLevel);
         states.reserve(states.size() + powerStates.size());
         for (const auto &state : powerStates)
         {
@@ -100,9 +112,8 @@ std::vector<HiddenGrottoState> HiddenGrottoSlotGenerator::generate(u64 seed) con
     return states;
 }
 
-std::vector<HiddenGrottoState> HiddenGrottoSlotGenerator::generate(u64 seed, u8 powerLevel) const
+std::vector<HiddenGrottoState> HiddenGrottoSlotGenerator::generate(u64 seed, u32 advances, u8 powerLevel) const
 {
-    u32 advances = Utilities5::initialAdvancesBW2(seed, profile.getMemoryLink());
     BWRNG rng(seed, advances + initialAdvances);
     auto jump = rng.getJump(offset);
     bool searchItemAmount = item != 0 && minItemAmount > 1;
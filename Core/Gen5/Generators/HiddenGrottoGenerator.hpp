@@ -64,13 +64,23 @@ public:
      */
     std::vector<HiddenGrottoState> generate(u64 seed) const;
 
+    /**
+     * @brief Generates states with the initial advances of the \p seed already calculated
+     *
+     * @param seed Starting PRNG state
+     * @param advances Initial advances of the \p seed
+     *
+     * @return Vector of computed states
+     */
+    std::vector<HiddenGrottoState> generatePrecomputed(u64 seed, u32 advances) const;
+
 private:
     HiddenGrottoArea encounterArea;
     u16 item;
     u8 minItemAmount;
     std::vector<u8> powerLevels;
 
-    std::vector<HiddenGrottoState> generate(u64 seed, u8 powerLevel) const;
+    std::vector<HiddenGrottoState> generate(u64 seed, u32 advances, u8 powerLevel) const;
 };
 
 /**
@@ -206,7 +206,11 @@ PickupGenerator::PickupGenerator(u32 initialAdvances, u32 maxAdvances, const std
 
 std::vector<PickupState> PickupGenerator::generate(u64 seed, u32 ivAdvances) const
 {
-    u32 advances = Utilities5::initialAdvances(seed, profile);
+    return generatePrecomputed(seed, Utilities5::initialAdvances(seed, profile), ivAdvances);
+}
+
+std::vector<PickupState> PickupGenerator::generatePrecomputed(u64 seed, u32 advances, u32 ivAdvances) const
+{
     u16 tsv = profile.getTID() ^ profile.getSID();
     bool bw2 = (profile.getVersion() & Game::BW2) != Game::None;
     u32 consumed = 5 + (profile.getMemoryLink() ? 1 : 0) + (bw2 && profile.getShinyCharm() ? 2 : 0);
@@ -51,8 +51,27 @@ public:
     PickupGenerator(u32 initialAdvances, u32 maxAdvances, const std::array<Slot, 6> &pickupSlots, const EncounterArea5 &area,
                     const Profile5 &profile, const WildStateFilter &filter, bool includeInvalid = false);
 
+    /**
+     * @brief Generates states for the \p seed
+     *
+     * @param seed Starting PRNG state
+     * @param ivAdvances Advances of the IV PRNG
+     *
+     * @return Vector of computed states
+     */
     std::vector<PickupState> generate(u64 seed, u32 ivAdvances = 0) const;
 
+    /**
+     * @brief Generates states with the initial advances of the \p seed already calculated
+     *
+     * @param seed Starting PRNG state
+     * @param advances Initial advances of the \p seed
+     * @param ivAdvances Advances of the IV PRNG
+     *
+     * @return Vector of computed states
+     */
+    std::vector<PickupState> generatePrecomputed(u64 seed, u32 advances, u32 ivAdvances = 0) const;
+
     static std::vector<u16> getLevelItems(u8 level);
 
 private:
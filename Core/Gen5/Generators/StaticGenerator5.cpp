@@ -229,6 +229,9 @@ std::vector<State5> StaticGenerator5::generateNonWild(u64 seed, const std::vecto
 
 std::vector<State5> StaticGenerator5::generateWild(u64 seed, const std::vector<std::pair<u32, std::array<u8, 6>>> &ivs) const
 {
+    // Only depends on the seed, so compute it once for every lucky power and lead
+    u32 advances = Utilities5::initialAdvances(seed, profile);
+
     std::vector<State5> states;
     for (u8 activeLuckyPower : luckyPowers)
     {
@@ -249,7 +252,7 @@ std::vector<State5> StaticGenerator5::generateWild(u64 seed, const std::vector<s
 
         for (Lead activeLead : leads)
         {
-            auto leadStates = generateWild(seed, powerIVs, activeLuckyPower, activeLead);
+            auto leadStates = generateWild(seed, advances, powerIVs, activeLuckyPower, activeLead);
             states.reserve(states.size() + leadStates.size());
             for (auto state : leadStates)
             {
@@ -266,10 +269,9 @@ std::vector<State5> StaticGenerator5::generateWild(u64 seed, const std::vector<s
     return states;
 }
 
-std::vector<State5> StaticGenerator5::generateWild(u64 seed, const std::vector<std::pair<u32, std::array<u8, 6>>> &ivs, u8 luckyPower,
-                                                   Lead lead) const
+std::vector<State5> StaticGenerator5::generateWild(u64 seed, u32 advances, const std::vector<std::pair<u32, std::array<u8, 6>>> &ivs,
+                                                   u8 luckyPower, Lead lead) const
 {
-    u32 advances = Utilities5::initialAdvances(seed, profile);
     BWRNG rng(seed, advances + initialAdvances);
     auto jump = rng.getJump(offset);
     const PersonalInfo *info = staticTemplate.getInfo();
@@ -443,6 +443,9 @@ std::vector<WildState5> WildGenerator5::generate(u64 seed, u32 initialAdvances,
 
 std::vector<WildState5> WildGenerator5::generate(u64 seed, const std::vector<std::pair<u32, std::array<u8, 6>>> &ivs) const
 {
+    // Only depends on the seed, so compute it once for every pass power and lead
+    u32 advances = Utilities5::initialAdvances(seed, profile);
+
     std::vector<WildState5> states;
     for (u8 activePassPower : passPowers)
     {
@@ -458,7 +461,7 @@ std::vector<WildState5> WildGenerator5::generate(u64 seed, const std::vector<std
 
         for (Lead activeLead : leads)
         {
-            auto leadStates = generate(seed, powerIVs, activePassPower, activeLead);
+            auto leadStates = generate(seed, advances, powerIVs, activePassPower, activeLead);
             states.reserve(states.size() + leadStates.size());
             for (auto state : leadStates)
             {
@@ -508,11 +511,10 @@ std::vector<WildState5> WildGenerator5::generate(u64 seed, const std::vector<std
     return states;
 }
 
-std::vector<WildState5> WildGenerator5::generate(u64 seed, const std::vector<std::pair<u32, std::array<u8, 6>>> &ivs, u8 passPower,
-                                                 Lead lead) const
+std::vector<WildState5> WildGenerator5::generate(u64 seed, u32 advances, const std::vector<std::pair<u32, std::array<u8, 6>>> &ivs,
+                                                 u8 passPower, Lead lead) const
 {
     u8 luckyPower = getLuckyPower(passPower);
-    u32 advances = Utilities5::initialAdvances(seed, profile);
     u32 start = advances + initialAdvances;
     bool bw2 = (profile.getVersion() & Game::BW2) != Game::None;
     bool bw = (profile.getVersion() & Game::BW) != Game::None;
@@ -558,6 +560,7 @@ std::vector<WildState5> WildGenerator5::generate(u64 seed, const std::vector<std
     std::vector<WildState5> states;
     bool nsPokemonReleasedOffset
         = profile.getMemoryLink() && profile.getNsPokemonReleased() && usesNsPokemonReleasedOffset(area.getEncounter());
+    const auto &slotTable = EncounterSlot::bwTable(area.getEncounter(), luckyPower);
     for (u32 cnt = 0; cnt <= maxAdvances; cnt++)
     {
         BWRNG payloadRng(searchMovingTrigger ? encounterRNG : rng);
@@ -707,7 +710,7 @@ std::vector<WildState5> WildGenerator5::generate(u64 seed, const std::vector<std
             }
             else
             {
-                encounterSlot = EncounterSlot::bwSlot(getPercentRand(go, bw), area.getEncounter(), luckyPower);
+                encounterSlot = slotTable[getPercentRand(go, bw)];
             }
 
             level = area.calculateLevel(encounterSlot, getPercentRand(go, bw), pressure);
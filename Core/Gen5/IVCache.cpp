@@ -21,7 +21,11 @@
 #include <Core/Enum/Game.hpp>
 #include <Core/Parents/Filters/StateFilter.hpp>
 #include <Core/RNG/MT.hpp>
+#include <Core/RNG/SIMD.hpp>
+#include <Core/Util/Parallel.hpp>
 #include <Core/Util/Utilities.hpp>
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <numeric>
 
@@ -34,6 +38,8 @@ struct SeedCache
 };
 static_assert(sizeof(SeedCache) == 48);
 
+using CacheEntry = std::pair<u64, std::array<u8, 6>>;
+
 static bool compareIVs(const std::array<u8, 6> &ivs, const StateFilter &filter)
 {
     constexpr u8 order[6] = { 0, 1, 2, 5, 3, 4 };
@@ -83,6 +89,205 @@ static std::array<u8, 6> computeIVs(u32 seed, u32 advance, CacheType type)
     return ivs;
 }
 
+/**
+ * @brief Computes the IVs of a vector of seeds at the same advance.
+ * Like MTFast only the MT words that produce the IVs are computed instead of the full 624 word state.
+ *
+ * @tparam Vector Vector type to compute the seeds in
+ * @param seeds Seeds to compute the IVs of
+ * @param advance IV advance
+ * @param type What cache type the seeds belong to
+ * @param ivs Computed IVs of each seed
+ */
+template <class Vector>
+static void computeIVs(const u32 *seeds, u32 advance, CacheType type, std::array<u8, 6> *ivs)
+{
+    constexpr int lanes = sizeof(Vector) / sizeof(u32);
+
+    if (type == CacheType::Entralink)
+    {
+        advance += 22;
+    }
+    else if (type == CacheType::Roamer)
+    {
+        advance += 1;
+    }
+
+    Vector mult(0x6c078965);
+    auto init = [&mult](Vector seed, u32 i) { return mult * (seed ^ (seed >> 30)) + Vector(i); };
+
+    Vector seed;
+    std::memcpy(&seed, seeds, sizeof(Vector));
+
+    // Only words [advance, advance + 7) and [advance + 397, advance + 403) of the initial state are needed for six outputs
+    Vector low[7];
+    Vector high[6];
+
+    u32 i = 1;
+    for (; i <= advance; i++)
+    {
+        seed = init(seed, i);
+    }
+
+    for (int j = 0; j < 7; j++, i++)
+    {
+        low[j] = seed;
+        seed = init(seed, i);
+    }
+
+    for (; i <= advance + 397; i++)
+    {
+        seed = init(seed, i);
+    }
+
+    for (int j = 0; j < 6; j++, i++)
+    {
+        high[j] = seed;
+        seed = init(seed, i);
+    }
+
+    u32 words[6][lanes];
+    for (int j = 0; j < 6; j++)
+    {
+        Vector y = MT::getIV(low[j], low[j + 1], high[j]);
+        std::memcpy(words[j], &y, sizeof(Vector));
+    }
+
+    constexpr u8 normal[6] = { 0, 1, 2, 3, 4, 5 };
+    constexpr u8 roamer[6] = { 0, 1, 2, 4, 5, 3 };
+    const u8 *order = type == CacheType::Roamer ? roamer : normal;
+    for (int lane = 0; lane < lanes; lane++)
+    {
+        for (int j = 0; j < 6; j++)
+        {
+            ivs[lane][order[j]] = words[j][lane];
+        }
+    }
+}
+
+/**
+ * @brief Computes the IVs of the seeds of a single advance and keeps the ones that pass the filter
+ *
+ * @param seeds Seeds to compute the IVs of
+ * @param count Number of seeds
+ * @param advance IV advance
+ * @param key Upper 32bits of the cache key
+ * @param type What cache type the seeds belong to
+ * @param filter IV filter
+ * @param entries Vector to add passing cache entries to
+ */
+static void computeEntries(const u32 *seeds, u32 count, u32 advance, u64 key, CacheType type, const StateFilter &filter,
+                           std::vector<CacheEntry> &entries)
+{
+    u32 offset = type == CacheType::Entralink ? 22 : type == CacheType::Roamer ? 1 : 0;
+
+    u32 i = 0;
+    std::array<u8, 6> ivs[8];
+    auto add = [&](u32 seed, const std::array<u8, 6> &ivs) {
+        if (compareIVs(ivs, filter))
+        {
+            entries.emplace_back(key | seed, ivs);
+        }
+    };
+
+    // The partial computation only works while the needed words are generated by the first shuffle
+    if (advance + offset + 6 <= 227)
+    {
+#ifdef SIMD_X86
+        static const bool avx2 = hasAVX2();
+        if (avx2)
+        {
+            for (; i + 8 <= count; i += 8)
+            {
+                computeIVs<vuint256>(seeds + i, advance, type, ivs);
+                for (int j = 0; j < 8; j++)
+                {
+                    add(seeds[i + j], ivs[j]);
+                }
+            }
+        }
+#endif
+
+        for (; i + 4 <= count; i += 4)
+        {
+            computeIVs<vuint128>(seeds + i, advance, type, ivs);
+            for (int j = 0; j < 4; j++)
+            {
+                add(seeds[i + j], ivs[j]);
+            }
+        }
+
+        for (; i < count; i++)
+        {
+            computeIVs<u32>(seeds + i, advance, type, ivs);
+            add(seeds[i], ivs[0]);
+        }
+    }
+    else
+    {
+        for (; i < count; i++)
+        {
+            add(seeds[i], computeIVs(seeds[i], advance, type));
+        }
+    }
+}
+
+/**
+ * @brief Computes the IV cache of the \p seeds
+ *
+ * @param seeds Seeds of each advance
+ * @param initialAdvances Initial IV advances
+ * @param maxAdvances Maximum IV advances
+ * @param offset Offset of the cache advances from the searched advances
+ * @param type What cache type the seeds belong to
+ * @param filter IV filter
+ * @param threads Number of threads to compute the IVs with
+ *
+ * @return IV caches
+ */
+static fph::MetaFphMap<u64, std::array<u8, 6>> getCache(const std::vector<std::vector<u32>> &seeds, u32 initialAdvances,
+                                                        u32 maxAdvances, u32 offset, CacheType type, const StateFilter &filter,
+                                                        int threads)
+{
+    // Flatten the seeds of every advance so each thread gets an even share no matter how the seeds are spread across advances
+    std::vector<u64> advances;
+    std::vector<u64> starts { 0 };
+    for (u64 i = initialAdvances; i <= (initialAdvances + maxAdvances) && (i + offset) < seeds.size(); i++)
+    {
+        advances.emplace_back(i);
+        starts.emplace_back(starts.back() + seeds[i + offset].size());
+    }
+
+    auto entries = generateParallel<CacheEntry>(starts.back(), threads, [&](u64 start, u64 end) {
+        std::vector<CacheEntry> entries;
+
+        size_t index = std::upper_bound(starts.begin(), starts.end(), start) - starts.begin() - 1;
+        for (; start < end; index++)
+        {
+            u64 advance = advances[index];
+            u64 first = start - starts[index];
+            u64 last = std::min(end, starts[index + 1]) - starts[index];
+
+            computeEntries(seeds[advance + offset].data() + first, last - first, advance + offset, advance << 32, type, filter, entries);
+            start = starts[index] + last;
+        }
+
+        return entries;
+    });
+
+    fph::MetaFphMap<u64, std::array<u8, 6>> cache;
+    cache.max_load_factor(0.9);
+    cache.reserve(entries.size());
+    for (const auto &[key, ivs] : entries)
+    {
+        cache.emplace(key, ivs);
+    }
+
+    cache.rehash(cache.size());
+
+    return cache;
+}
+
 IVCache::IVCache(std::string_view file, bool read) : valid(false)
 {
     std::ifstream stream(file.data(), std::ios_base::in | std::ios_base::binary);
@@ -137,19 +342,20 @@ IVCache::IVCache(std::string_view file, bool read) : valid(false)
 }
 
 fph::MetaFphMap<u64, std::array<u8, 6>> IVCache::getCache(u32 initialAdvances, u32 maxAdvances, Game version, CacheType type,
-                                                          const StateFilter &filter) const
+                                                          const StateFilter &filter, int threads) const
 {
     if (type == CacheType::Entralink)
     {
-        return getEntralinkCache(initialAdvances, maxAdvances, filter);
+        return ::getCache(entralinkSeeds, initialAdvances, maxAdvances, 0, type, filter, threads);
     }
     else if (type == CacheType::Normal)
     {
-        return getNormalCache(initialAdvances, maxAdvances, version, filter);
+        bool bw = (version & Game::BW) != Game::None;
+        return ::getCache(normalSeeds, initialAdvances, maxAdvances, bw ? 0 : 2, type, filter, threads);
     }
     else
     {
-        return getRoamerCache(initialAdvances, maxAdvances, filter);
+        return ::getCache(roamerSeeds, initialAdvances, maxAdvances, 0, type, filter, threads);
     }
 }
 
@@ -190,71 +396,3 @@ bool IVCache::isValid() const
 {
     return valid;
 }
-
-fph::MetaFphMap<u64, std::array<u8, 6>> IVCache::getEntralinkCache(u32 initialAdvances, u32 maxAdvances, const StateFilter &filter) const
-{
-    fph::MetaFphMap<u64, std::array<u8, 6>> cache;
-
-    for (u64 i = initialAdvances; i <= (initialAdvances + maxAdvances) && i < entralinkSeeds.size(); i++)
-    {
-        for (u32 seed : entralinkSeeds[i])
-        {
-            auto ivs = computeIVs(seed, i, CacheType::Entralink);
-            if (compareIVs(ivs, filter))
-            {
-                cache.emplace((i << 32) | seed, ivs);
-            }
-        }
-    }
-
-    cache.max_load_factor(0.9);
-    cache.rehash(cache.size());
-
-    return cache;
-}
-
-fph::MetaFphMap<u64, std::array<u8, 6>> IVCache::getNormalCache(u32 initialAdvances, u32 maxAdvances, Game version,
-                                                                const StateFilter &filter) const
-{
-    fph::MetaFphMap<u64, std::array<u8, 6>> cache;
-
-    bool bw = (version & Game::BW) != Game::None;
-    for (u64 i = initialAdvances; i <= (initialAdvances + maxAdvances) && (i + (bw ? 0 : 2)) < normalSeeds.size(); i++)
-    {
-        for (u32 seed : normalSeeds[i + (bw ? 0 : 2)])
-        {
-            auto ivs = computeIVs(seed, i + (bw ? 0 : 2), CacheType::Normal);
-            if (compareIVs(ivs, filter))
-            {
-                cache.emplace((i << 32) | seed, ivs);
-            }
-        }
-    }
-
-    cache.max_load_factor(0.9);
-    cache.rehash(cache.size());
-
-    return cache;
-}
-
-fph::MetaFphMap<u64, std::array<u8, 6>> IVCache::getRoamerCache(u32 initialAdvances, u32 maxAdvances, const StateFilter &filter) const
-{
-    fph::MetaFphMap<u64, std::array<u8, 6>> cache;
-
-    for (u64 i = initialAdvances; i <= (initialAdvances + maxAdvances) && i < roamerSeeds.size(); i++)
-    {
-        for (u32 seed : roamerSeeds[i])
-        {
-            auto ivs = computeIVs(seed, i, CacheType::Roamer);
-            if (compareIVs(ivs, filter))
-            {
-                cache.emplace((i << 32) | seed, ivs);
-            }
-        }
-    }
-
-    cache.max_load_factor(0.9);
-    cache.rehash(cache.size());
-
-    return cache;
-}
@@ -57,11 +57,12 @@ public:
      * @param version Game version
      * @param type What cache type to get
      * @param filter IV filter
+     * @param threads Number of threads to compute the IVs with
      *
      * @return IV caches
      */
     fph::MetaFphMap<u64, std::array<u8, 6>> getCache(u32 initialAdvances, u32 maxAdvances, Game version, CacheType type,
-                                                     const StateFilter &filter) const;
+                                                     const StateFilter &filter, int threads = 1) const;
 
     /**
      * @brief Returns the initial advance supported by the cache
@@ -105,41 +106,6 @@ private:
     u32 initialAdvances;
     u32 maxAdvances;
     bool valid;
-
-    /**
-     * @brief Returns the IV caches for entralink
-     *
-     * @param initialAdvance Initial IV advances
-     * @param maxAdvance Maximum IV advances
-     * @param filter IV filter
-     *
-     * @return IV caches
-     */
-    fph::MetaFphMap<u64, std::array<u8, 6>> getEntralinkCache(u32 initialAdvances, u32 maxAdvances, const StateFilter &filter) const;
-
-    /**
-     * @brief Returns the IV caches for most encounter types
-     *
-     * @param initialAdvance Initial IV advances
-     * @param maxAdvance Maximum IV advances
-     * @param version Game version
-     * @param filter IV filter
-     *
-     * @return IV caches
-     */
-    fph::MetaFphMap<u64, std::array<u8, 6>> getNormalCache(u32 initialAdvances, u32 maxAdvances, Game version,
-                                                           const StateFilter &filter) const;
-
-    /**
-     * @brief Returns the IV caches for roamers
-     *
-     * @param initialAdvance Initial IV advances
-     * @param maxAdvance Maximum IV advances
-     * @param filter IV filter
-     *
-     * @return IV caches
-     */
-    fph::MetaFphMap<u64, std::array<u8, 6>> getRoamerCache(u32 initialAdvances, u32 maxAdvances, const StateFilter &filter) const;
 };
 
 #endif // IVCACHE_HPP
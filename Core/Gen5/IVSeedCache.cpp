@@ -0,0 +1,146 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "IVSeedCache.hpp"
+#include <Core/RNG/SIMD.hpp>
+#include <algorithm>
+#include <bit>
+#include <tuple>
+
+constexpr u32 multiplier = 0x9e3779b1;
+
+IVSeedCache::IVSeedCache(const fph::MetaFphMap<u64, std::array<u8, 6>> &ivCache, u32 initialAdvances, u32 maxAdvances)
+{
+    std::vector<std::tuple<u32, u32, std::array<u8, 6>>> seeds;
+    seeds.reserve(ivCache.size());
+    for (const auto &[key, ivs] : ivCache)
+    {
+        u32 advance = key >> 32;
+        if (advance >= initialAdvances && advance <= initialAdvances + maxAdvances)
+        {
+            seeds.emplace_back(key & 0xffffffff, advance, ivs);
+        }
+    }
+    std::ranges::sort(seeds);
+
+    u32 unique = 0;
+    for (size_t i = 0; i < seeds.size(); i++)
+    {
+        unique += i == 0 || std::get<0>(seeds[i]) != std::get<0>(seeds[i - 1]);
+    }
+
+    // Table is at most half full, filter has 32 bits per seed to keep false positives around 3%
+    u64 size = std::max(unique, 1u);
+    u32 tableBits = std::max<u32>(std::bit_width(size * 2 - 1), 4);
+    u32 filterBits = std::clamp<u32>(std::bit_width(size * 32 - 1), 5, 32);
+
+    tableShift = 32 - tableBits;
+    filterShift = 32 - filterBits;
+    mask = (1u << tableBits) - 1;
+
+    keys.resize(1u << tableBits);
+    counts.resize(1u << tableBits);
+    starts.resize(1u << tableBits);
+    filter.resize((1ull << filterBits) / 32);
+    entries.reserve(seeds.size());
+
+    for (size_t i = 0; i < seeds.size();)
+    {
+        u32 seed = std::get<0>(seeds[i]);
+        u32 start = entries.size();
+        for (; i < seeds.size() && std::get<0>(seeds[i]) == seed; i++)
+        {
+            entries.emplace_back(std::get<1>(seeds[i]), std::get<2>(seeds[i]));
+        }
+
+        u32 hash = seed * multiplier;
+        u32 bit = hash >> filterShift;
+        filter[bit >> 5] |= 1u << (bit & 31);
+
+        u32 slot = hash >> tableShift;
+        while (counts[slot] != 0)
+        {
+            slot = (slot + 1) & mask;
+        }
+        keys[slot] = seed;
+        counts[slot] = entries.size() - start;
+        starts[slot] = start;
+    }
+}
+
+std::span<const IVSeedCache::Entry> IVSeedCache::find(u32 seed) const
+{
+    u32 hash = seed * multiplier;
+    u32 bit = hash >> filterShift;
+    if ((filter[bit >> 5] & (1u << (bit & 31))) == 0)
+    {
+        return {};
+    }
+
+    for (u32 slot = hash >> tableShift; counts[slot] != 0; slot = (slot + 1) & mask)
+    {
+        if (keys[slot] == seed)
+        {
+            return { entries.data() + starts[slot], counts[slot] };
+        }
+    }
+    return {};
+}
+
+u32 IVSeedCache::find(const u64 *seeds, u32 count, std::span<const Entry> *entries) const
+{
+    u32 hits = 0;
+    u32 i = 0;
+
+#ifdef SIMD_X86
+    static const bool avx2 = hasAVX2();
+    if (avx2)
+    {
+        const __m256i high = _mm256_setr_epi32(1, 3, 5, 7, 1, 3, 5, 7);
+        const __m128i shift = _mm_cvtsi32_si128(filterShift);
+        for (; i + 8 <= count; i += 8)
+        {
+            // Upper halves of the SHA1 seeds are the MT seeds
+            __m256i first = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(seeds + i)), high);
+            __m256i second = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(seeds + i + 4)), high);
+            __m256i mt = _mm256_permute2x128_si256(first, second, 0x20);
+
+            __m256i bit = _mm256_srl_epi32(_mm256_mullo_epi32(mt, _mm256_set1_epi32(multiplier)), shift);
+            __m256i word = _mm256_i32gather_epi32(reinterpret_cast<const int *>(filter.data()), _mm256_srli_epi32(bit, 5), 4);
+            __m256i set = _mm256_and_si256(_mm256_srlv_epi32(word, _mm256_and_si256(bit, _mm256_set1_epi32(31))), _mm256_set1_epi32(1));
+
+            u32 candidates = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(set, _mm256_set1_epi32(1))));
+            for (; candidates; candidates &= candidates - 1)
+            {
+                u32 lane = i + std::countr_zero(candidates);
+                entries[lane] = find(seeds[lane] >> 32);
+                hits |= static_cast<u32>(!entries[lane].empty()) << lane;
+            }
+        }
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        entries[i] = find(seeds[i] >> 32);
+        hits |= static_cast<u32>(!entries[i].empty()) << i;
+    }
+
+    return hits;
+}
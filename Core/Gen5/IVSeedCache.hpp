@@ -0,0 +1,80 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef IVSEEDCACHE_HPP
+#define IVSEEDCACHE_HPP
+
+#include <Core/Global.hpp>
+#include <array>
+#include <fph/meta_fph_table.h>
+#include <span>
+#include <vector>
+
+/**
+ * @brief IV cache keyed only by the MT seed. Every seed maps to all of its matching advances, so a SHA1 seed needs a single lookup
+ * instead of one per advance.
+ *
+ * Lookups first test a bit filter that rejects almost every seed that is not in the cache, then probe an open addressing table.
+ */
+class IVSeedCache
+{
+public:
+    using Entry = std::pair<u32, std::array<u8, 6>>;
+
+    /**
+     * @brief Construct a new IVSeedCache object
+     *
+     * @param ivCache IV cache keyed by advance and seed from IVCache::getCache
+     * @param initialAdvances Minimum IV advances
+     * @param maxAdvances Maximum IV advances
+     */
+    IVSeedCache(const fph::MetaFphMap<u64, std::array<u8, 6>> &ivCache, u32 initialAdvances, u32 maxAdvances);
+
+    /**
+     * @brief Returns the advances and IVs of the \p seed sorted by advance
+     *
+     * @param seed MT seed
+     *
+     * @return Matching advances and IVs, empty if the seed is not in the cache
+     */
+    std::span<const Entry> find(u32 seed) const;
+
+    /**
+     * @brief Looks up the MT seed of each SHA1 seed in \p seeds
+     *
+     * @param seeds SHA1 seeds
+     * @param count Number of seeds
+     * @param entries Matching advances and IVs of each seed
+     *
+     * @return Bit mask of the seeds that are in the cache
+     */
+    u32 find(const u64 *seeds, u32 count, std::span<const Entry> *entries) const;
+
+private:
+    std::vector<Entry> entries;
+    std::vector<u32> filter;
+    std::vector<u32> keys;
+    std::vector<u32> counts;
+    std::vector<u32> starts;
+    u32 filterShift;
+    u32 mask;
+    u32 tableShift;
+};
+
+#endif // IVSEEDCACHE_HPP
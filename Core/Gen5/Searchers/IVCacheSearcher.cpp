@@ -20,8 +20,12 @@
 #include "IVCacheSearcher.hpp"
 #include <Core/RNG/MT.hpp>
 #include <Core/RNG/RNGList.hpp>
+#include <Core/RNG/SIMD.hpp>
 #include <algorithm>
+#include <cstring>
 #include <fstream>
+#include <numeric>
+#include <sstream>
 #include <thread>
 
 static u8 gen(MT &rng)
@@ -29,46 +33,287 @@ static u8 gen(MT &rng)
     return rng.next() >> 27;
 }
 
+/**
+ * @brief Checks if the IVs are kept by the entralink and normal caches
+ *
+ * @param ivs IVs in generation order
+ *
+ * @return true IVs are kept
+ * @return false IVs are not kept
+ */
+static bool keep(const u8 *ivs)
+{
+    u8 hp = ivs[0];
+    u8 atk = ivs[1];
+    u8 def = ivs[2];
+    u8 spa = ivs[3];
+    u8 spd = ivs[4];
+    u8 spe = ivs[5];
+    return hp >= 30 && def >= 30 && spd >= 30 && (atk >= 30 || spa >= 30) && (spe <= 1 || spe >= 30);
+}
+
+/**
+ * @brief Checks if the IVs are kept by the roamer cache
+ *
+ * @param ivs IVs in generation order
+ *
+ * @return true IVs are kept
+ * @return false IVs are not kept
+ */
+static bool keepRoamer(const u8 *ivs)
+{
+    u8 hp = ivs[0];
+    u8 atk = ivs[1];
+    u8 def = ivs[2];
+    u8 spd = ivs[3];
+    u8 spe = ivs[4];
+    u8 spa = ivs[5];
+    return hp >= 30 && def >= 30 && spd >= 30 && (atk >= 30 || spa >= 30) && spe >= 30;
+}
+
+/**
+ * @brief Adds the seeds each thread found to the search results
+ *
+ * @param seeds Search results
+ * @param found Seeds found by a thread
+ */
+static void merge(std::vector<std::vector<u32>> &seeds, std::vector<std::vector<u32>> &found)
+{
+    for (int i = 0; i < seeds.size(); i++)
+    {
+        seeds[i].insert(seeds[i].end(), found[i].begin(), found[i].end());
+        found[i].clear();
+    }
+}
+
 template <typename Type>
-static void write(std::ofstream &file, Type val)
+static void write(std::ostream &file, Type val)
 {
     file.write(reinterpret_cast<char *>(&val), sizeof(val));
 }
 
-IVCacheSearcher::IVCacheSearcher(u32 initialAdvances, u32 maxAdvances) : SearcherBase<std::vector<u32>>(), initialAdvances(initialAdvances), maxAdvances(maxAdvances)
+/**
+ * @brief Writes seeds to the \p stream in the IV cache format. Each list of seeds is sorted first.
+ *
+ * @param stream Stream to write to
+ * @param initialAdvances Initial IV advances
+ * @param maxAdvances Maximum IV advances
+ * @param entralink Entralink seeds of each advance
+ * @param normal Normal seeds of each advance
+ * @param roamer Roamer seeds of each advance
+ */
+static void writeSeeds(std::ostream &stream, u32 initialAdvances, u32 maxAdvances, std::vector<std::vector<u32>> &entralink,
+                       std::vector<std::vector<u32>> &normal, std::vector<std::vector<u32>> &roamer)
+{
+    // Write magic identifier: CRC32 of "IVCache"
+    write(stream, 0xd08cb7c0);
+
+    // Write cache advances
+    write(stream, initialAdvances);
+    write(stream, maxAdvances);
+
+    // Write seed sizes
+    for (int i = 0; i < entralink.size(); i++)
+    {
+        std::ranges::sort(entralink[i]);
+        write<u32>(stream, entralink[i].size());
+    }
+
+    for (int i = 0; i < normal.size(); i++)
+    {
+        std::ranges::sort(normal[i]);
+        write<u32>(stream, normal[i].size());
+    }
+
+    for (int i = 0; i < roamer.size(); i++)
+    {
+        std::ranges::sort(roamer[i]);
+        write<u32>(stream, roamer[i].size());
+    }
+
+    // Write seeds
+    for (int i = 0; i < entralink.size(); i++)
+    {
+        stream.write(reinterpret_cast<char *>(entralink[i].data()), entralink[i].size() * sizeof(u32));
+    }
+
+    for (int i = 0; i < normal.size(); i++)
+    {
+        stream.write(reinterpret_cast<char *>(normal[i].data()), normal[i].size() * sizeof(u32));
+    }
+
+    for (int i = 0; i < roamer.size(); i++)
+    {
+        stream.write(reinterpret_cast<char *>(roamer[i].data()), roamer[i].size() * sizeof(u32));
+    }
+}
+
+IVCacheSearcher::IVCacheSearcher(u32 initialAdvances, u32 maxAdvances) :
+    SearcherBase<std::vector<u32>>(), initialAdvances(initialAdvances), maxAdvances(maxAdvances), checkpointFailed(false)
 {
     entralink.resize(maxAdvances + 5);
     results.resize(maxAdvances + 3);
     roamer.resize(maxAdvances + 1);
 }
 
+std::vector<WorkUnit> IVCacheSearcher::getUnits(u32 count)
+{
+    return Shard::split(0, 0xffffffff, count);
+}
+
 void IVCacheSearcher::startSearch(int threads)
+{
+    startSearch(threads, getUnits(checkpoint.enabled() ? 256 : 1));
+}
+
+void IVCacheSearcher::startSearch(int threads, const std::vector<WorkUnit> &units)
 {
     this->searching = true;
+    checkpointFailed = false;
+
+    u64 key = Checkpoint::hash(initialAdvances, maxAdvances);
+    u32 count = 0;
+    for (const auto &unit : units)
+    {
+        key = Checkpoint::hash(key, unit.index, unit.start, unit.end);
+        count = std::max(count, unit.index + 1);
+    }
+
+    if (checkpoint.open(key, count))
+    {
+        // The checkpoint holds one block of seeds for each completed unit
+        std::istringstream stream(checkpoint.getData());
+        while (stream.peek() != std::char_traits<char>::eof() && readResults(stream))
+        {
+        }
+    }
 
     auto *threadContainer = new std::thread[threads];
 
-    u32 split = 0x100000000 / threads;
-    u32 start = 0;
+    // Each thread keeps its own seeds so finding one never waits on a lock
+    auto *entralinkSeeds = new std::vector<std::vector<u32>>[threads];
+    auto *normalSeeds = new std::vector<std::vector<u32>>[threads];
+    auto *roamerSeeds = new std::vector<std::vector<u32>>[threads];
+    for (int i = 0; i < threads; i++)
+    {
+        entralinkSeeds[i].resize(entralink.size());
+        normalSeeds[i].resize(results.size());
+        roamerSeeds[i].resize(roamer.size());
+    }
 
-    for (int i = 0; i < threads; i++, start += split)
+    for (const auto &unit : units)
     {
-        if (i == threads - 1)
+        if (checkpoint.isDone(unit.index))
         {
-            threadContainer[i] = std::thread([=] { search(start, 0xffffffff); });
+            progress += unit.end - unit.start + 1;
+            continue;
+        }
+
+        u64 length = unit.end - unit.start + 1;
+        for (int i = 0; i < threads; i++)
+        {
+            u64 start = unit.start + length * i / threads;
+            u64 end = unit.start + length * (i + 1) / threads;
+            if (start < end)
+            {
+                threadContainer[i] = std::thread([=] { search(start, end - 1, entralinkSeeds[i], normalSeeds[i], roamerSeeds[i]); });
+            }
         }
-        else
+
+        std::vector<std::vector<u32>> unitEntralink(entralink.size());
+        std::vector<std::vector<u32>> unitNormal(results.size());
+        std::vector<std::vector<u32>> unitRoamer(roamer.size());
+        for (int i = 0; i < threads; i++)
+        {
+            if (threadContainer[i].joinable())
+            {
+                threadContainer[i].join();
+            }
+
+            merge(unitEntralink, entralinkSeeds[i]);
+            merge(unitNormal, normalSeeds[i]);
+            merge(unitRoamer, roamerSeeds[i]);
+        }
+
+        // Only complete units are recorded so a resumed search never sees the seeds of a partial unit. Records after a failed write
+        // can not be read back, so the rest of the search is not checkpointed.
+        if (searching && checkpoint.enabled() && !checkpointFailed)
+        {
+            std::ostringstream stream;
+            writeSeeds(stream, initialAdvances, maxAdvances, unitEntralink, unitNormal, unitRoamer);
+            checkpointFailed = !checkpoint.write(unit.index, stream.str());
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            merge(entralink, unitEntralink);
+            merge(results, unitNormal);
+            merge(roamer, unitRoamer);
+        }
+
+        if (!searching)
         {
-            threadContainer[i] = std::thread([=] { search(start, start + split); });
+            break;
         }
     }
 
-    for (int i = 0; i < threads; i++)
+    delete[] threadContainer;
+    delete[] entralinkSeeds;
+    delete[] normalSeeds;
+    delete[] roamerSeeds;
+
+    // A cancelled search keeps its checkpoint so it can be resumed
+    if (searching)
     {
-        threadContainer[i].join();
+        checkpoint.remove();
     }
+}
 
-    delete[] threadContainer;
+bool IVCacheSearcher::readResults(std::string_view file)
+{
+    std::ifstream stream(file.data(), std::ios_base::in | std::ios_base::binary);
+    return stream.is_open() && readResults(stream);
+}
+
+bool IVCacheSearcher::readResults(std::istream &stream)
+{
+    u32 magic, initial, max;
+    stream.read(reinterpret_cast<char *>(&magic), sizeof(magic));
+    stream.read(reinterpret_cast<char *>(&initial), sizeof(initial));
+    stream.read(reinterpret_cast<char *>(&max), sizeof(max));
+    if (!stream.good() || magic != 0xd08cb7c0 || initial != initialAdvances || max != maxAdvances)
+    {
+        return false;
+    }
+
+    std::vector<u32> entralinkCount(entralink.size());
+    std::vector<u32> resultsCount(results.size());
+    std::vector<u32> roamerCount(roamer.size());
+
+    stream.read(reinterpret_cast<char *>(entralinkCount.data()), entralinkCount.size() * sizeof(u32));
+    stream.read(reinterpret_cast<char *>(resultsCount.data()), resultsCount.size() * sizeof(u32));
+    stream.read(reinterpret_cast<char *>(roamerCount.data()), roamerCount.size() * sizeof(u32));
+
+    auto append = [&stream](std::vector<std::vector<u32>> &seeds, const std::vector<u32> &counts) {
+        for (int i = 0; i < seeds.size(); i++)
+        {
+            size_t size = seeds[i].size();
+            seeds[i].resize(size + counts[i]);
+            stream.read(reinterpret_cast<char *>(seeds[i].data() + size), counts[i] * sizeof(u32));
+        }
+    };
+
+    std::lock_guard<std::mutex> lock(mutex);
+    append(entralink, entralinkCount);
+    append(results, resultsCount);
+    append(roamer, roamerCount);
+
+    return stream.good();
+}
+
+void IVCacheSearcher::setCheckpoint(const std::string &file)
+{
+    checkpoint = Checkpoint(file);
 }
 
 void IVCacheSearcher::writeResults(std::string_view file)
@@ -76,51 +321,181 @@ void IVCacheSearcher::writeResults(std::string_view file)
     std::ofstream stream(file.data(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
     if (stream.is_open())
     {
-        // Write magic identifier: CRC32 of "IVCache"
-        write(stream, 0xd08cb7c0);
+        writeResults(stream);
+    }
+}
+
+void IVCacheSearcher::writeResults(std::ostream &stream)
+{
+    writeSeeds(stream, initialAdvances, maxAdvances, entralink, results, roamer);
+}
+
+void IVCacheSearcher::search(u32 start, u32 end, std::vector<std::vector<u32>> &entralink, std::vector<std::vector<u32>> &normal,
+                             std::vector<std::vector<u32>> &roamer)
+{
+    // The six IVs of the last entralink advance are the highest MT outputs needed.
+    // Each output needs its word and the word 397 after it, so only the first 227 outputs come from the initial state.
+    if (initialAdvances + maxAdvances + 32 > 227)
+    {
+        searchFull(start, end, entralink, normal, roamer);
+        return;
+    }
+
+    u64 seed = start;
+#ifdef SIMD_X86
+    static const bool avx2 = hasAVX2();
+    if (avx2)
+    {
+        seed = searchBlocks<vuint256, 2>(seed, end, entralink, normal, roamer);
+    }
+#endif
+    seed = searchBlocks<vuint128, 4>(seed, end, entralink, normal, roamer);
+    searchBlocks<u32, 1>(seed, end, entralink, normal, roamer);
+}
+
+template <class Vector, int width>
+u64 IVCacheSearcher::searchBlocks(u64 start, u64 end, std::vector<std::vector<u32>> &entralink, std::vector<std::vector<u32>> &normal,
+                                  std::vector<std::vector<u32>> &roamer)
+{
+    constexpr int lanes = sizeof(Vector) / sizeof(u32);
+    constexpr int block = lanes * width;
+
+    // Outputs are relative to the initial advance
+    u32 count = maxAdvances + 32;
+    std::vector<Vector> ivs((count + 1) * width);
+    std::vector<Vector> high(count * width);
 
-        // Write cache advances
-        write(stream, initialAdvances);
-        write(stream, maxAdvances);
+    Vector mult(0x6c078965);
+    auto init = [&mult](Vector *mt, u32 i) {
+        for (int w = 0; w < width; w++)
+        {
+            mt[w] = mult * (mt[w] ^ (mt[w] >> 30)) + Vector(i);
+        }
+    };
+
+    // Compares with the 0/1 results of additions so u32 can use the same code as the vectors
+    auto low = [&ivs](u32 k, int w) { return ((ivs[k * width + w] + Vector(30)) >> 5) ^ Vector(1); };
+    auto normalMatch = [&high, &low](u32 k, int w) {
+        auto hi = [&high, w](u32 k) { return high[k * width + w]; };
+        return hi(k) & hi(k + 2) & hi(k + 4) & (hi(k + 1) | hi(k + 3)) & (low(k + 5, w) | hi(k + 5));
+    };
+    auto roamerMatch = [&high](u32 k, int w) {
+        auto hi = [&high, w](u32 k) { return high[k * width + w]; };
+        return hi(k) & hi(k + 2) & hi(k + 3) & hi(k + 4) & (hi(k + 1) | hi(k + 5));
+    };
 
-        // Write seed sizes
-        for (int i = 0; i < entralink.size(); i++)
+    u64 seed = start;
+    for (; seed + block - 1 <= end; seed += block)
+    {
+        if (!searching)
         {
-            std::ranges::sort(entralink[i]);
-            write<u32>(stream, entralink[i].size());
+            return end + 1;
         }
 
-        for (int i = 0; i < results.size(); i++)
+        Vector mt[width];
+        for (int w = 0; w < width; w++)
         {
-            std::ranges::sort(results[i]);
-            write<u32>(stream, results[i].size());
+            u32 seeds[lanes];
+            std::iota(seeds, seeds + lanes, static_cast<u32>(seed + w * lanes));
+            std::memcpy(&mt[w], seeds, sizeof(Vector));
         }
 
-        for (int i = 0; i < roamer.size(); i++)
+        u32 i = 1;
+        for (; i <= initialAdvances; i++)
         {
-            std::ranges::sort(roamer[i]);
-            write<u32>(stream, roamer[i].size());
+            init(mt, i);
         }
 
-        // Write seeds
-        for (int i = 0; i < entralink.size(); i++)
+        for (u32 k = 0; k <= count; k++, i++)
         {
-            stream.write(reinterpret_cast<char *>(entralink[i].data()), entralink[i].size() * sizeof(u32));
+            for (int w = 0; w < width; w++)
+            {
+                ivs[k * width + w] = mt[w];
+            }
+            init(mt, i);
         }
 
-        for (int i = 0; i < results.size(); i++)
+        for (; i <= initialAdvances + 397; i++)
         {
-            stream.write(reinterpret_cast<char *>(results[i].data()), results[i].size() * sizeof(u32));
+            init(mt, i);
         }
 
-        for (int i = 0; i < roamer.size(); i++)
+        // Shuffle and temper the outputs in place. Each output only overwrites a word no later output needs.
+        for (u32 k = 0; k < count; k++, i++)
         {
-            stream.write(reinterpret_cast<char *>(roamer[i].data()), roamer[i].size() * sizeof(u32));
+            for (int w = 0; w < width; w++)
+            {
+                Vector y = MT::getIV(ivs[k * width + w], ivs[(k + 1) * width + w], mt[w]);
+                ivs[k * width + w] = y;
+                high[k * width + w] = (y + Vector(2)) >> 5;
+            }
+            init(mt, i);
         }
+
+        for (int w = 0; w < width; w++)
+        {
+            Vector any(0);
+            for (u32 j = 0; j <= maxAdvances + 4; j++)
+            {
+                any = any | normalMatch(j + 22, w);
+            }
+            for (u32 j = 0; j <= maxAdvances + 2; j++)
+            {
+                any = any | normalMatch(j, w);
+            }
+            for (u32 j = 0; j <= maxAdvances; j++)
+            {
+                any = any | roamerMatch(j + 1, w);
+            }
+
+            u32 matches[lanes];
+            std::memcpy(matches, &any, sizeof(Vector));
+
+            // Matches are rare enough to recheck the lanes that have one individually
+            for (int lane = 0; lane < lanes; lane++)
+            {
+                if (!matches[lane])
+                {
+                    continue;
+                }
+
+                std::vector<u8> values(count);
+                for (u32 k = 0; k < count; k++)
+                {
+                    u32 lanesIVs[lanes];
+                    std::memcpy(lanesIVs, &ivs[k * width + w], sizeof(Vector));
+                    values[k] = lanesIVs[lane];
+                }
+
+                u32 laneSeed = seed + w * lanes + lane;
+                for (u32 j = 0; j <= maxAdvances + 4; j++)
+                {
+                    if (keep(&values[j + 22]))
+                    {
+                        entralink[j].emplace_back(laneSeed);
+                    }
+
+                    if (j <= maxAdvances + 2 && keep(&values[j]))
+                    {
+                        normal[j].emplace_back(laneSeed);
+                    }
+
+                    if (j <= maxAdvances && keepRoamer(&values[j + 1]))
+                    {
+                        roamer[j].emplace_back(laneSeed);
+                    }
+                }
+            }
+        }
+
+        progress += block;
     }
+
+    return seed;
 }
 
-void IVCacheSearcher::search(u32 start, u32 end)
+void IVCacheSearcher::searchFull(u32 start, u32 end, std::vector<std::vector<u32>> &entralink, std::vector<std::vector<u32>> &normal,
+                                 std::vector<std::vector<u32>> &roamer)
 {
     for (u32 seed = start;; seed++)
     {
@@ -132,17 +507,13 @@ void IVCacheSearcher::search(u32 start, u32 end)
         RNGList<u8, MT, 32, gen> rngList(seed, initialAdvances);
         for (u32 i = 0; i <= maxAdvances + 4; i++, rngList.advanceState())
         {
+            u8 ivs[6];
+
             // Entralink
             rngList.advance(22);
-            u8 hp =  rngList.next();
-            u8 atk = rngList.next();
-            u8 def = rngList.next();
-            u8 spa = rngList.next();
-            u8 spd = rngList.next();
-            u8 spe = rngList.next();
-            if (hp >= 30 && def >= 30 && spd >= 30 && (atk >= 30 || spa >= 30) && (spe <= 1 || spe >= 30))
+            std::generate(std::begin(ivs), std::end(ivs), [&rngList] { return rngList.next(); });
+            if (keep(ivs))
             {
-                std::lock_guard<std::mutex> lock(mutex);
                 entralink[i].emplace_back(seed);
             }
 
@@ -150,18 +521,10 @@ void IVCacheSearcher::search(u32 start, u32 end)
             if (i <= maxAdvances + 2)
             {
                 rngList.resetState();
-
-                hp =  rngList.next();
-                atk = rngList.next();
-                def = rngList.next();
-                spa = rngList.next();
-                spd = rngList.next();
-                spe = rngList.next();
-
-                if (hp >= 30 && def >= 30 && spd >= 30 && (atk >= 30 || spa >= 30) && (spe <= 1 || spe >= 30))
+                std::generate(std::begin(ivs), std::end(ivs), [&rngList] { return rngList.next(); });
+                if (keep(ivs))
                 {
-                    std::lock_guard<std::mutex> lock(mutex);
-                    results[i].emplace_back(seed);
+                    normal[i].emplace_back(seed);
                 }
             }
 
@@ -170,17 +533,9 @@ void IVCacheSearcher::search(u32 start, u32 end)
             {
                 rngList.resetState();
                 rngList.advance(1);
-
-                hp =  rngList.next();
-                atk = rngList.next();
-                def = rngList.next();
-                spd = rngList.next();
-                spe = rngList.next();
-                spa = rngList.next();
-
-                if (hp >= 30 && def >= 30 && spd >= 30 && (atk >= 30 || spa >= 30) && spe >= 30)
+                std::generate(std::begin(ivs), std::end(ivs), [&rngList] { return rngList.next(); });
+                if (keepRoamer(ivs))
                 {
-                    std::lock_guard<std::mutex> lock(mutex);
                     roamer[i].emplace_back(seed);
                 }
             }
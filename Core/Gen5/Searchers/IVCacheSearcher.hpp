@@ -21,6 +21,10 @@
 #define IVCACHESEARCHER_HPP
 
 #include <Core/Parents/Searchers/SearcherBase.hpp>
+#include <Core/Util/Checkpoint.hpp>
+#include <Core/Util/Shard.hpp>
+#include <istream>
+#include <ostream>
 #include <string>
 
 /**
@@ -37,6 +41,15 @@ public:
      */
     IVCacheSearcher(u32 initialAdvances, u32 maxAdvances);
 
+    /**
+     * @brief Returns the work units covering every seed the search checks
+     *
+     * @param count Number of units
+     *
+     * @return Work units
+     */
+    static std::vector<WorkUnit> getUnits(u32 count);
+
     /**
      * @brief Starts the search
      *
@@ -46,6 +59,55 @@ public:
      */
     void startSearch(int threads);
 
+    /**
+     * @brief Starts the search over each of the \p units
+     *
+     * @param threads Numbers of threads to search with
+     * @param units Work units of seeds
+     */
+    void startSearch(int threads, const std::vector<WorkUnit> &units);
+
+    /**
+     * @brief Adds the seeds of a cache file written by another search over the same advances. Used to merge the results of
+     * sharded searches.
+     *
+     * @param file Path to read the cache from
+     *
+     * @return true Cache was read
+     * @return false Cache is missing or was made with different advances
+     */
+    bool readResults(std::string_view file);
+
+    /**
+     * @brief Adds the seeds of a cache read from the \p stream
+     *
+     * @param stream Binary stream to read from
+     *
+     * @return true Cache was read
+     * @return false Cache was made with different advances
+     */
+    bool readResults(std::istream &stream);
+
+    /**
+     * @brief Checkpoints the search to the \p file after each work unit. Starting the same search again skips the units the checkpoint
+     * completed and restores their seeds. A cancelled search keeps its checkpoint so it can be resumed.
+     *
+     * @param file Path of the checkpoint
+     */
+    void setCheckpoint(const std::string &file);
+
+    /**
+     * @brief Returns if writing the checkpoint failed. The units completed after the failure are not checkpointed, so resuming the
+     * search repeats them.
+     *
+     * @return true Checkpoint could not be written
+     * @return false Checkpoint was written or is disabled
+     */
+    bool getCheckpointFailed() const
+    {
+        return checkpointFailed;
+    }
+
     /**
      * @brief Writes cache results to file
      *
@@ -53,19 +115,63 @@ public:
      */
     void writeResults(std::string_view file);
 
+    /**
+     * @brief Writes cache results to the \p stream
+     *
+     * @param stream Binary stream to write to
+     */
+    void writeResults(std::ostream &stream);
+
 private:
+    Checkpoint checkpoint;
     std::vector<std::vector<u32>> entralink;
     std::vector<std::vector<u32>> roamer;
     u32 initialAdvances;
     u32 maxAdvances;
+    bool checkpointFailed;
 
     /**
      * @brief Searches between the \p start and \p end seeds
      *
      * @param start Start seed
      * @param end End seed
+     * @param entralink Entralink seeds found by the search
+     * @param normal Normal seeds found by the search
+     * @param roamer Roamer seeds found by the search
+     */
+    void search(u32 start, u32 end, std::vector<std::vector<u32>> &entralink, std::vector<std::vector<u32>> &normal,
+                std::vector<std::vector<u32>> &roamer);
+
+    /**
+     * @brief Searches blocks of consecutive seeds from \p start until fewer than a block of seeds remain before \p end.
+     * Each seed is a lane of one of the \p width vectors, which are computed together to hide the multiply latency.
+     *
+     * @tparam Vector Vector type to compute the seeds in
+     * @tparam width Number of vectors in a block
+     * @param start Start seed
+     * @param end End seed
+     * @param entralink Entralink seeds found by the search
+     * @param normal Normal seeds found by the search
+     * @param roamer Roamer seeds found by the search
+     *
+     * @return First seed that was not searched
+     */
+    template <class Vector, int width>
+    u64 searchBlocks(u64 start, u64 end, std::vector<std::vector<u32>> &entralink, std::vector<std::vector<u32>> &normal,
+                     std::vector<std::vector<u32>> &roamer);
+
+    /**
+     * @brief Searches between the \p start and \p end seeds one seed at a time with the full MT state. Used when the advances
+     * reach past the words of the first MT shuffle.
+     *
+     * @param start Start seed
+     * @param end End seed
+     * @param entralink Entralink seeds found by the search
+     * @param normal Normal seeds found by the search
+     * @param roamer Roamer seeds found by the search
      */
-    void search(u32 start, u32 end);
+    void searchFull(u32 start, u32 end, std::vector<std::vector<u32>> &entralink, std::vector<std::vector<u32>> &normal,
+                    std::vector<std::vector<u32>> &roamer);
 };
 
 #endif // IVCACHESEARCHER_HPP
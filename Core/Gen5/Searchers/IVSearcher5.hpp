@@ -21,12 +21,16 @@
 #define IVSEARCHER5_HPP
 
 #include <Core/Enum/Buttons.hpp>
+#include <Core/Gen5/IVSeedCache.hpp>
 #include <Core/Gen5/SHA1Cache.hpp>
 #include <Core/Gen5/Searchers/SearcherBase5.hpp>
+#include <bit>
 #include <fph/meta_fph_table.h>
 
 /**
- * @brief Parent searcher class for Static/Wild Gen 5 generators
+ * @brief Parent searcher class for Static/Wild Gen 5 generators.
+ * The generators only run for seeds whose IVs already passed the filter, so they calculate the initial advances themselves instead of
+ * getting them precomputed for the whole SHA1 hash.
  *
  * @tparam Generator Generator class to use
  * @tparam State State class to use
@@ -174,14 +178,12 @@ public:
      */
     IVSearcher5Fast(u32 initialAdvances, u32 maxAdvances, const fph::MetaFphMap<u64, std::array<u8, 6>> &ivCache,
                     const Generator &generator, const Profile5 &profile) :
-        SearcherBase5<Generator, State>(generator, profile), ivCache(ivCache), initialAdvances(initialAdvances), maxAdvances(maxAdvances)
+        SearcherBase5<Generator, State>(generator, profile), ivCache(ivCache, initialAdvances, maxAdvances)
     {
     }
 
 private:
-    fph::MetaFphMap<u64, std::array<u8, 6>> ivCache;
-    u32 initialAdvances;
-    u32 maxAdvances;
+    IVSeedCache ivCache;
 
     /**
      * @brief Searches between the \p start and \p end dates
@@ -215,27 +217,20 @@ private:
                             sha.setTime(time, this->profile.getDSType());
                             auto seeds = sha.hashSeed(alpha);
 
-                            for (u32 i = 0; i < seeds.size(); i++)
+                            std::array<std::span<const IVSeedCache::Entry>, std::tuple_size_v<decltype(seeds)>> entries;
+                            for (u32 hits = ivCache.find(seeds.data(), seeds.size(), entries.data()); hits; hits &= hits - 1)
                             {
-                                for (u64 j = initialAdvances; j <= (initialAdvances + maxAdvances); j++)
+                                u32 i = std::countr_zero(hits);
+                                auto states = this->generator.generate(seeds[i], { entries[i].begin(), entries[i].end() });
+                                if (!states.empty())
                                 {
-                                    const auto entry = ivCache.find((j << 32) | (seeds[i] >> 32));
-                                    if (entry == ivCache.end())
-                                    {
-                                        continue;
-                                    }
+                                    DateTime dt(date, time + i);
 
-                                    auto states = this->generator.generate(seeds[i], { { j, entry->second } });
-                                    if (!states.empty())
+                                    std::lock_guard<std::mutex> lock(this->mutex);
+                                    this->results.reserve(this->results.capacity() + states.size());
+                                    for (const auto &state : states)
                                     {
-                                        DateTime dt(date, time + i);
-
-                                        std::lock_guard<std::mutex> lock(this->mutex);
-                                        this->results.reserve(this->results.capacity() + states.size());
-                                        for (const auto &state : states)
-                                        {
-                                            this->results.emplace_back(dt, seeds[i], keypress.button, timer0, state);
-                                        }
+                                        this->results.emplace_back(dt, seeds[i], keypress.button, timer0, state);
                                     }
                                 }
                             }
@@ -269,27 +264,20 @@ private:
                             sha.setTime(time, this->profile.getDSType());
                             auto seeds = sha.hashSeed(alpha);
 
-                            for (u32 i = 0; i < seeds.size(); i++)
+                            std::array<std::span<const IVSeedCache::Entry>, std::tuple_size_v<decltype(seeds)>> entries;
+                            for (u32 hits = ivCache.find(seeds.data(), seeds.size(), entries.data()); hits; hits &= hits - 1)
                             {
-                                for (u64 j = initialAdvances; j <= (initialAdvances + maxAdvances); j++)
+                                u32 i = std::countr_zero(hits);
+                                auto states = this->generator.generate(seeds[i], { entries[i].begin(), entries[i].end() });
+                                if (!states.empty())
                                 {
-                                    const auto entry = ivCache.find((j << 32) | (seeds[i] >> 32));
-                                    if (entry == ivCache.end())
-                                    {
-                                        continue;
-                                    }
+                                    DateTime dt(date, time + i);
 
-                                    auto states = this->generator.generate(seeds[i], { { j, entry->second } });
-                                    if (!states.empty())
+                                    std::lock_guard<std::mutex> lock(this->mutex);
+                                    this->results.reserve(this->results.capacity() + states.size());
+                                    for (const auto &state : states)
                                     {
-                                        DateTime dt(date, time + i);
-
-                                        std::lock_guard<std::mutex> lock(this->mutex);
-                                        this->results.reserve(this->results.capacity() + states.size());
-                                        for (const auto &state : states)
-                                        {
-                                            this->results.emplace_back(dt, seeds[i], keypress.button, timer0, state);
-                                        }
+                                        this->results.emplace_back(dt, seeds[i], keypress.button, timer0, state);
                                     }
                                 }
                             }
@@ -326,17 +314,13 @@ public:
                          const fph::MetaFphMap<u64, std::array<u8, 6>> &ivCache, const Generator &generator, const Profile5 &profile) :
         SearcherBase5<Generator, State>(generator, profile),
         sha1Cache(sha1Cache),
-        ivCache(ivCache),
-        initialAdvances(initialAdvances),
-        maxAdvances(maxAdvances)
+        ivCache(ivCache, initialAdvances, maxAdvances)
     {
     }
 
 private:
     fph::MetaFphMap<u64, u64> sha1Cache;
-    fph::MetaFphMap<u64, std::array<u8, 6>> ivCache;
-    u32 initialAdvances;
-    u32 maxAdvances;
+    IVSeedCache ivCache;
 
     /**
      * @brief Searches between the \p start and \p end dates
@@ -372,25 +356,22 @@ private:
                         }
 
                         u64 seed = sha1Entry->second;
-                        for (u64 j = initialAdvances; j <= (initialAdvances + maxAdvances); j++)
+                        auto entries = ivCache.find(seed >> 32);
+                        if (entries.empty())
                         {
-                            const auto ivEntry = ivCache.find((j << 32) | (seed >> 32));
-                            if (ivEntry == ivCache.end())
-                            {
-                                continue;
-                            }
+                            continue;
+                        }
 
-                            auto states = this->generator.generate(seed, { { j, ivEntry->second } });
-                            if (!states.empty())
-                            {
-                                DateTime dt(date, time);
+                        auto states = this->generator.generate(seed, { entries.begin(), entries.end() });
+                        if (!states.empty())
+                        {
+                            DateTime dt(date, time);
 
-                                std::lock_guard<std::mutex> lock(this->mutex);
-                                this->results.reserve(this->results.capacity() + states.size());
-                                for (const auto &state : states)
-                                {
-                                    this->results.emplace_back(dt, seed, keypress.button, timer0, state);
-                                }
+                            std::lock_guard<std::mutex> lock(this->mutex);
+                            this->results.reserve(this->results.capacity() + states.size());
+                            for (const auto &state : states)
+                            {
+                                this->results.emplace_back(dt, seed, keypress.button, timer0, state);
                             }
                         }
                     }
@@ -25,6 +25,8 @@
 #include <Core/Gen5/IVCache.hpp>
 #include <Core/RNG/SHA1.hpp>
 #include <Core/Util/DateTime.hpp>
+#include <Core/Util/Shard.hpp>
+#include <cstring>
 #include <fstream>
 #include <thread>
 
@@ -34,8 +36,31 @@ static void write(std::ofstream &file, Type val)
     file.write(reinterpret_cast<char *>(&val), sizeof(val));
 }
 
+static void readSeeds(const std::string &data, size_t &offset, std::vector<SHA1Seed> &seeds)
+{
+    u64 size = 0;
+    if (offset + sizeof(size) <= data.size())
+    {
+        std::memcpy(&size, data.data() + offset, sizeof(size));
+        offset += sizeof(size);
+    }
+
+    size = std::min<u64>(size, (data.size() - offset) / sizeof(SHA1Seed));
+    size_t previous = seeds.size();
+    seeds.resize(previous + size);
+    std::memcpy(seeds.data() + previous, data.data() + offset, size * sizeof(SHA1Seed));
+    offset += size * sizeof(SHA1Seed);
+}
+
+static void writeSeeds(std::string &data, const std::vector<SHA1Seed> &seeds, size_t start)
+{
+    u64 size = seeds.size() - start;
+    data.append(reinterpret_cast<const char *>(&size), sizeof(size));
+    data.append(reinterpret_cast<const char *>(seeds.data() + start), size * sizeof(SHA1Seed));
+}
+
 SHA1CacheSearcher::SHA1CacheSearcher(const IVCache &ivCache, const Profile5 &profile, const Date &start, const Date &end) :
-    SearcherBase<SHA1Seed>(), profile(profile), keypresses(Keypresses::getKeypresses()), end(end), start(start), initialAdvances(ivCache.getInitialAdvances()), maxAdvances(ivCache.getMaxAdvances())
+    SearcherBase<SHA1Seed>(), profile(profile), keypresses(Keypresses::getKeypresses()), end(end), start(start), checkpointFailed(false), initialAdvances(ivCache.getInitialAdvances()), maxAdvances(ivCache.getMaxAdvances())
 {
     entralinkSeeds = ivCache.getSeeds(profile.getVersion(), CacheType::Entralink);
     normalSeeds = ivCache.getSeeds(profile.getVersion(), CacheType::Normal);
@@ -45,6 +70,7 @@ SHA1CacheSearcher::SHA1CacheSearcher(const IVCache &ivCache, const Profile5 &pro
 void SHA1CacheSearcher::startSearch(int threads)
 {
     this->searching = true;
+    checkpointFailed = false;
 
     auto days = start.daysTo(end) + 1;
     if (days < threads)
@@ -52,29 +78,91 @@ void SHA1CacheSearcher::startSearch(int threads)
         threads = days;
     }
 
+    // Checkpointed searches give each thread one day between checkpoints
+    auto units = Shard::split(start.getJD(), end.getJD(), checkpoint.enabled() ? (days + threads - 1) / threads : 1);
+
+    u64 key = Checkpoint::hash(profile.getMac(), profile.getVersion(), profile.getDSType(), profile.getLanguage(), profile.getTimer0Min(),
+                               profile.getTimer0Max(), profile.getGxStat(), profile.getVCount(), profile.getVFrame(), start, end,
+                               initialAdvances, maxAdvances, entralinkSeeds, normalSeeds, roamerSeeds);
+    if (checkpoint.open(key, units.size()))
+    {
+        // The checkpoint holds the seeds found by each completed unit
+        const std::string &data = checkpoint.getData();
+        for (size_t offset = 0; offset + sizeof(u64) <= data.size();)
+        {
+            readSeeds(data, offset, results);
+            readSeeds(data, offset, normalResults);
+            readSeeds(data, offset, roamerResults);
+        }
+    }
+
     auto *threadContainer = new std::thread[threads];
 
-    auto daysSplit = days / threads;
-    Date day = start;
-    for (int i = 0; i < threads; i++, day += daysSplit)
+    for (const auto &unit : units)
     {
-        if (i == threads - 1)
+        Date first(unit.start);
+        Date last(unit.end);
+        auto unitDays = first.daysTo(last) + 1;
+
+        if (checkpoint.isDone(unit.index))
+        {
+            progress += keypresses.size() * unitDays * (profile.getTimer0Max() - profile.getTimer0Min() + 1);
+            continue;
+        }
+
+        size_t entralinkStart = results.size();
+        size_t normalStart = normalResults.size();
+        size_t roamerStart = roamerResults.size();
+
+        int unitThreads = std::min<int>(threads, unitDays);
+        auto daysSplit = unitDays / unitThreads;
+        Date day = first;
+        for (int i = 0; i < unitThreads; i++, day += daysSplit)
+        {
+            if (i == unitThreads - 1)
+            {
+                threadContainer[i] = std::thread([=] { search(day, last); });
+            }
+            else
+            {
+                Date mid = day + (daysSplit - 1);
+                threadContainer[i] = std::thread([=] { search(day, mid); });
+            }
+        }
+
+        for (int i = 0; i < unitThreads; i++)
         {
-            threadContainer[i] = std::thread([=] { search(day, end); });
+            threadContainer[i].join();
         }
-        else
+
+        if (!searching)
         {
-            Date mid = day + (daysSplit - 1);
-            threadContainer[i] = std::thread([=] { search(day, mid); });
+            break;
+        }
+
+        // Records after a failed write can not be read back, so the rest of the search is not checkpointed
+        if (checkpoint.enabled() && !checkpointFailed)
+        {
+            std::string data;
+            writeSeeds(data, results, entralinkStart);
+            writeSeeds(data, normalResults, normalStart);
+            writeSeeds(data, roamerResults, roamerStart);
+            checkpointFailed = !checkpoint.write(unit.index, data);
         }
     }
 
-    for (int i = 0; i < threads; i++)
+    delete[] threadContainer;
+
+    // A cancelled search keeps its checkpoint so it can be resumed
+    if (searching)
     {
-        threadContainer[i].join();
+        checkpoint.remove();
     }
+}
 
-    delete[] threadContainer;
+void SHA1CacheSearcher::setCheckpoint(const std::string &file)
+{
+    checkpoint = Checkpoint(file);
 }
 
 void SHA1CacheSearcher::writeResults(std::string_view file)
@@ -24,6 +24,7 @@
 #include <Core/Gen5/Profile5.hpp>
 #include <Core/Gen5/SHA1Cache.hpp>
 #include <Core/Parents/Searchers/SearcherBase.hpp>
+#include <Core/Util/Checkpoint.hpp>
 #include <Core/Util/DateTime.hpp>
 
 class IVCache;
@@ -66,6 +67,26 @@ public:
      */
     void startSearch(int threads);
 
+    /**
+     * @brief Checkpoints the search to the \p file after each group of days. Starting the same search again skips the days the
+     * checkpoint completed and restores their seeds. A cancelled search keeps its checkpoint so it can be resumed.
+     *
+     * @param file Path of the checkpoint
+     */
+    void setCheckpoint(const std::string &file);
+
+    /**
+     * @brief Returns if writing the checkpoint failed. The units completed after the failure are not checkpointed, so resuming the
+     * search repeats them.
+     *
+     * @return true Checkpoint could not be written
+     * @return false Checkpoint was written or is disabled
+     */
+    bool getCheckpointFailed() const
+    {
+        return checkpointFailed;
+    }
+
     /**
      * @brief Writes cache results to file
      *
@@ -74,6 +95,7 @@ public:
     void writeResults(std::string_view file);
 
 private:
+    Checkpoint checkpoint;
     Profile5 profile;
     std::vector<Keypress> keypresses;
     std::vector<u32> entralinkSeeds;
@@ -83,6 +105,7 @@ private:
     std::vector<SHA1Seed> roamerResults;
     Date end;
     Date start;
+    bool checkpointFailed;
     u32 initialAdvances;
     u32 maxAdvances;
 
@@ -21,6 +21,10 @@
 #define SEARCHER5_HPP
 
 #include <Core/Gen5/Searchers/SearcherBase5.hpp>
+#include <Core/Gen5/States/PackedSearcherState5.hpp>
+#include <Core/Gen5/States/SearcherState5.hpp>
+#include <Core/Util/Utilities.hpp>
+#include <optional>
 
 /**
  * @brief Parent searcher class for most Gen 5 generators
@@ -37,12 +41,167 @@ public:
      *
      * @param generator State generator
      * @param profile Profile information
+     * @param packed Whether results are stored as \ref PackedSearcherState5 instead of full states
      */
-    Searcher5(const Generator &generator, const Profile5 &profile) : SearcherBase5<Generator, State>(generator, profile)
+    Searcher5(const Generator &generator, const Profile5 &profile, bool packed = false) :
+        SearcherBase5<Generator, State>(generator, profile), packed(packed)
     {
     }
 
+    /**
+     * @brief Returns the packed states of the running search
+     *
+     * @return Vector of packed states
+     */
+    std::vector<PackedSearcherState5> getPackedResults()
+    {
+        std::lock_guard<std::mutex> guard(this->mutex);
+        auto data = std::move(packedResults);
+        return data;
+    }
+
+    /**
+     * @brief Regenerates the full state of a packed result. Must be called on the searcher that produced the result.
+     *
+     * @param state Packed state
+     *
+     * @return Full state, or std::nullopt if the regenerated states do not contain the packed state
+     */
+    std::optional<SearcherState5<State>> rehydrate(const PackedSearcherState5 &state) const
+    {
+        u64 seed = state.getInitialSeed(this->profile);
+
+        std::vector<State> states;
+        if constexpr (requires(const Generator &generator) { generator.generatePrecomputed(0, 0); })
+        {
+            states = this->generator.generatePrecomputed(seed, Utilities5::initialAdvances(seed, this->profile));
+        }
+        else
+        {
+            states = this->generator.generate(seed);
+        }
+
+        if (state.getIndex() >= states.size())
+        {
+            return std::nullopt;
+        }
+
+        const State &result = states[state.getIndex()];
+        if constexpr (requires { result.getAdvances(); })
+        {
+            // A different profile or generator than the search used would regenerate other states
+            if (result.getAdvances() != state.getAdvances())
+            {
+                return std::nullopt;
+            }
+        }
+        return SearcherState5<State>(state.getDateTime(), seed, state.getButtons(), state.getTimer0(), result);
+    }
+
 private:
+    std::vector<PackedSearcherState5> packedResults;
+    bool packed;
+
+    /**
+     * @brief Stores the states generated from a seed as results
+     *
+     * @param dt Date/time
+     * @param seed Initial seed
+     * @param buttons Key presses
+     * @param timer0 Timer0
+     * @param states Generated states
+     */
+    void addResults(const DateTime &dt, u64 seed, Buttons buttons, u16 timer0, const std::vector<State> &states)
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (packed)
+        {
+            packedResults.reserve(packedResults.capacity() + states.size());
+            for (u32 i = 0; i < states.size(); i++)
+            {
+                u32 advances = 0;
+                if constexpr (requires(const State &state) { state.getAdvances(); })
+                {
+                    advances = states[i].getAdvances();
+                }
+                packedResults.emplace_back(dt, buttons, timer0, i, advances);
+            }
+        }
+        else
+        {
+            this->results.reserve(this->results.capacity() + states.size());
+            for (const auto &state : states)
+            {
+                this->results.emplace_back(dt, seed, buttons, timer0, state);
+            }
+        }
+    }
+
+    /**
+     * @brief Generates the states of each seed from a SHA1 hash.
+     * Generators that accept precomputed initial advances get them calculated for the whole hash at once. Generators that can reject
+     * a seed before needing the initial advances only get them calculated for the seeds they accept.
+     *
+     * @tparam size Number of seeds
+     * @param seeds PRNG states
+     *
+     * @return Vector of computed states for each seed
+     */
+    template <size_t size>
+    std::array<std::vector<State>, size> generate(const std::array<u64, size> &seeds) const
+    {
+        std::array<std::vector<State>, size> states;
+        if constexpr (requires(const Generator &generator) { generator.generatePrecomputed(0, 0); })
+        {
+            std::array<bool, size> accepted;
+            size_t count = size;
+            if constexpr (requires(const Generator &generator) { generator.acceptsSeed(0); })
+            {
+                count = 0;
+                for (size_t i = 0; i < size; i++)
+                {
+                    accepted[i] = this->generator.acceptsSeed(seeds[i]);
+                    count += accepted[i];
+                }
+            }
+            else
+            {
+                accepted.fill(true);
+            }
+
+            if (count == 1)
+            {
+                // A lone seed is cheaper to calculate by itself than the whole batch
+                for (size_t i = 0; i < size; i++)
+                {
+                    if (accepted[i])
+                    {
+                        states[i] = this->generator.generatePrecomputed(seeds[i], Utilities5::initialAdvances(seeds[i], this->profile));
+                    }
+                }
+            }
+            else if (count != 0)
+            {
+                auto advances = Utilities5::initialAdvances(seeds, this->profile);
+                for (size_t i = 0; i < size; i++)
+                {
+                    if (accepted[i])
+                    {
+                        states[i] = this->generator.generatePrecomputed(seeds[i], advances[i]);
+                    }
+                }
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < size; i++)
+            {
+                states[i] = this->generator.generate(seeds[i]);
+            }
+        }
+        return states;
+    }
+
     /**
      * @brief Searches between the \p start and \p end dates
      *
@@ -75,20 +234,13 @@ private:
 
                             sha.setTime(time, this->profile.getDSType());
                             auto seeds = sha.hashSeed(alpha);
+                            auto states = generate(seeds);
 
                             for (u32 i = 0; i < seeds.size(); i++)
                             {
-                                auto states = this->generator.generate(seeds[i]);
-                                if (!states.empty())
+                                if (!states[i].empty())
                                 {
-                                    DateTime dt(date, time + i);
-
-                                    std::lock_guard<std::mutex> lock(this->mutex);
-                                    this->results.reserve(this->results.capacity() + states.size());
-                                    for (const auto &state : states)
-                                    {
-                                        this->results.emplace_back(dt, seeds[i], keypress.button, timer0, state);
-                                    }
+                                    addResults(DateTime(date, time + i), seeds[i], keypress.button, timer0, states[i]);
                                 }
                             }
                         }
@@ -121,20 +273,13 @@ private:
 
                             sha.setTime(time, this->profile.getDSType());
                             auto seeds = sha.hashSeed(alpha);
+                            auto states = generate(seeds);
 
                             for (u32 i = 0; i < seeds.size(); i++)
                             {
-                                auto states = this->generator.generate(seeds[i]);
-                                if (!states.empty())
+                                if (!states[i].empty())
                                 {
-                                    DateTime dt(date, time + i);
-
-                                    std::lock_guard<std::mutex> lock(this->mutex);
-                                    this->results.reserve(this->results.capacity() + states.size());
-                                    for (const auto &state : states)
-                                    {
-                                        this->results.emplace_back(dt, seeds[i], keypress.button, timer0, state);
-                                    }
+                                    addResults(DateTime(date, time + i), seeds[i], keypress.button, timer0, states[i]);
                                 }
                             }
                         }
@@ -26,6 +26,7 @@
 #include <Core/Parents/Searchers/SearcherBase.hpp>
 #include <Core/RNG/SHA1.hpp>
 #include <Core/Util/DateTime.hpp>
+#include <Core/Util/Shard.hpp>
 #include <thread>
 
 class Date;
@@ -67,6 +68,23 @@ public:
         return keypresses.size() * (start.daysTo(end) + 1) * (profile.getTimer0Max() - profile.getTimer0Min() + 1);
     }
 
+    /**
+     * @brief Computes max progress
+     *
+     * @param units Work units of julian dates
+     *
+     * @return Max progress
+     */
+    u64 getMaxProgress(const std::vector<WorkUnit> &units) const
+    {
+        u64 max = 0;
+        for (const auto &unit : units)
+        {
+            max += getMaxProgress(Date(unit.start), Date(unit.end));
+        }
+        return max;
+    }
+
     /**
      * @brief Starts the search
      *
@@ -109,6 +127,24 @@ public:
         delete[] threadContainer;
     }
 
+    /**
+     * @brief Starts the search over each of the \p units in order
+     *
+     * @param threads Numbers of threads to search with
+     * @param units Work units of julian dates
+     */
+    void startSearch(int threads, const std::vector<WorkUnit> &units)
+    {
+        for (const auto &unit : units)
+        {
+            startSearch(threads, Date(unit.start), Date(unit.end));
+            if (this->cancelled())
+            {
+                break;
+            }
+        }
+    }
+
 protected:
     Generator generator;
     Profile5 profile;
@@ -0,0 +1,125 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef PACKEDSEARCHERSTATE5_HPP
+#define PACKEDSEARCHERSTATE5_HPP
+
+#include <Core/Global.hpp>
+#include <Core/Util/DateTime.hpp>
+
+class Profile5;
+enum class Buttons : u16;
+
+/**
+ * @brief Compact record of a Gen 5 search result. The initial seed is reproduced from the date/time, key presses and Timer0 and the
+ * state is regenerated from the seed, so only the position of the state in the generator output is kept.
+ */
+class PackedSearcherState5
+{
+public:
+    /**
+     * @brief Construct a new PackedSearcherState5 object
+     *
+     * @param dt Date/time
+     * @param buttons Key presses
+     * @param timer0 Timer0
+     * @param index Index of the state in the generator output of the seed
+     * @param advances Advances of the state
+     */
+    PackedSearcherState5(const DateTime &dt, Buttons buttons, u16 timer0, u32 index, u32 advances) :
+        seconds((dt.getDate().getJD() - epoch) * 86400 + dt.getTime().hour() * 3600 + dt.getTime().minute() * 60 + dt.getTime().second()),
+        index(index),
+        advances(advances),
+        buttons(static_cast<u16>(buttons)),
+        timer0(timer0)
+    {
+    }
+
+    /**
+     * @brief Returns the advances of the state
+     *
+     * @return State advances
+     */
+    u32 getAdvances() const
+    {
+        return advances;
+    }
+
+    /**
+     * @brief Returns the key presses of the state
+     *
+     * @return Key presses
+     */
+    Buttons getButtons() const
+    {
+        return static_cast<Buttons>(buttons);
+    }
+
+    /**
+     * @brief Returns the date/time of the state
+     *
+     * @return Date/time
+     */
+    DateTime getDateTime() const
+    {
+        return DateTime(epoch + seconds / 86400, seconds % 86400);
+    }
+
+    /**
+     * @brief Returns the index of the state in the generator output of the seed
+     *
+     * @return State index
+     */
+    u32 getIndex() const
+    {
+        return index;
+    }
+
+    /**
+     * @brief Recomputes the initial seed of the state
+     *
+     * @param profile Profile information the search was run with
+     *
+     * @return Initial seed
+     */
+    u64 getInitialSeed(const Profile5 &profile) const;
+
+    /**
+     * @brief Returns the Timer0 of the state
+     *
+     * @return Timer0
+     */
+    u16 getTimer0() const
+    {
+        return timer0;
+    }
+
+private:
+    static constexpr u32 epoch = 2451545; // 2000-01-01
+
+    u32 seconds;
+    u32 index;
+    u32 advances;
+    u16 buttons;
+    u16 timer0;
+};
+
+static_assert(sizeof(PackedSearcherState5) == 16);
+
+#endif // PACKEDSEARCHERSTATE5_HPP
@@ -47,7 +47,7 @@ bool UndergroundStateFilter::compareState(const UndergroundState &state) const
         return false;
     }
 
-    if (!natures[state.getNature()])
+    if (!((natures >> state.getNature()) & 1))
     {
         return false;
     }
@@ -77,14 +77,5 @@ bool UndergroundStateFilter::compareState(const UndergroundState &state) const
         return false;
     }
 
-    for (int i = 0; i < 6; i++)
-    {
-        u8 iv = state.getIV(i);
-        if (iv < ivMin[i] || iv > ivMax[i])
-        {
-            return false;
-        }
-    }
-
-    return true;
+    return compareIV(state.getIVs());
 }
@@ -25,6 +25,7 @@
 #include <Core/RNG/RNGList.hpp>
 #include <Core/RNG/Xoroshiro.hpp>
 #include <Core/RNG/Xorshift.hpp>
+#include <Core/Util/Parallel.hpp>
 #include <Core/Util/Utilities.hpp>
 
 static u32 gen(Xorshift &rng)
@@ -39,7 +40,7 @@ EggGenerator8::EggGenerator8(u32 initialAdvances, u32 maxAdvances, u32 offset, u
 {
 }
 
-std::vector<EggState8> EggGenerator8::generate(u64 seed0, u64 seed1) const
+std::vector<EggState8> EggGenerator8::generate(u64 seed0, u64 seed1, int threads) const
 {
     const PersonalInfo *base = PersonalLoader::getPersonal(profile.getVersion(), daycare.getEggSpecie());
     const PersonalInfo *male;
@@ -55,147 +56,149 @@ std::vector<EggState8> EggGenerator8::generate(u64 seed0, u64 seed1) const
         female = PersonalLoader::getPersonal(profile.getVersion(), 314);
     }
 
-    RNGList<u32, Xorshift, 2, gen> rngList(seed0, seed1, initialAdvances + offset);
+    return generateParallel<EggState8>(static_cast<u64>(maxAdvances) + 1, threads, [&](u64 start, u64 end) {
+        RNGList<u32, Xorshift, 2, gen> rngList(seed0, seed1, initialAdvances + offset + start);
 
-    u8 pidRolls = 0;
-    if (daycare.getMasuda())
-    {
-        pidRolls += 6;
-    }
-    if (shinyCharm)
-    {
-        pidRolls += 2;
-    }
+        u8 pidRolls = 0;
+        if (daycare.getMasuda())
+        {
+            pidRolls += 6;
+        }
+        if (shinyCharm)
+        {
+            pidRolls += 2;
+        }
 
-    // Intentionally ignoring power items
-    u8 inheritanceCount = 3;
-    if (daycare.getParentItem(0) == 8 || daycare.getParentItem(1) == 8)
-    {
-        inheritanceCount = 5;
-    }
+        // Intentionally ignoring power items
+        u8 inheritanceCount = 3;
+        if (daycare.getParentItem(0) == 8 || daycare.getParentItem(1) == 8)
+        {
+            inheritanceCount = 5;
+        }
 
-    std::vector<EggState8> states;
-    for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rngList.advanceState())
-    {
-        if (rngList.next(100) < compatability)
+        std::vector<EggState8> states;
+        for (u64 cnt = start; cnt < end; cnt++, rngList.advanceState())
         {
-            // Sign extend seed to signed 64bit
-            constexpr u32 SIGN_EXTEND_MASK = 0x80000000;
-            u64 seed = (static_cast<u64>(rngList.next()) ^ SIGN_EXTEND_MASK) - SIGN_EXTEND_MASK;
-
-            XoroshiroBDSP rng(seed);
-
-            // Nidoran
-            // Volbeat / Illumise
-            u8 gender;
-            const PersonalInfo *info = base;
-            if (daycare.getEggSpecie() == 29 || daycare.getEggSpecie() == 32 || daycare.getEggSpecie() == 313
-                || daycare.getEggSpecie() == 314)
+            if (rngList.next(100) < compatability)
             {
-                gender = rng.nextUInt(2);
-                info = gender ? female : male;
-            }
-            else
-            {
-                switch (base->getGender())
+                // Sign extend seed to signed 64bit
+                constexpr u32 SIGN_EXTEND_MASK = 0x80000000;
+                u64 seed = (static_cast<u64>(rngList.next()) ^ SIGN_EXTEND_MASK) - SIGN_EXTEND_MASK;
+
+                XoroshiroBDSP rng(seed);
+
+                // Nidoran
+                // Volbeat / Illumise
+                u8 gender;
+                const PersonalInfo *info = base;
+                if (daycare.getEggSpecie() == 29 || daycare.getEggSpecie() == 32 || daycare.getEggSpecie() == 313
+                    || daycare.getEggSpecie() == 314)
                 {
-                case 255:
-                    gender = 2;
-                    break;
-                case 254:
-                    gender = 1;
-                    break;
-                case 0:
-                    gender = 0;
-                    break;
-                default:
-                    gender = rng.nextUInt(252) + 1 < base->getGender();
-                    break;
+                    gender = rng.nextUInt(2);
+                    info = gender ? female : male;
+                }
+                else
+                {
+                    switch (base->getGender())
+                    {
+                    case 255:
+                        gender = 2;
+                        break;
+                    case 254:
+                        gender = 1;
+                        break;
+                    case 0:
+                        gender = 0;
+                        break;
+                    default:
+                        gender = rng.nextUInt(252) + 1 < base->getGender();
+                        break;
+                    }
                 }
-            }
-
-            u8 nature = rng.nextUInt(25);
-            if (daycare.getEverstoneCount() == 2)
-            {
-                nature = daycare.getParentNature(rng.nextUInt(2));
-            }
-            else if (daycare.getParentItem(0) == 1)
-            {
-                nature = daycare.getParentNature(0);
-            }
-            else if (daycare.getParentItem(1) == 1)
-            {
-                nature = daycare.getParentNature(1);
-            }
 
-            // If we have a ditto acting as the female, get the ability from the other parent (this will be slot 0)
-            u8 parentAbility = daycare.getParentAbility(daycare.getParentGender(1) == 3 ? 0 : 1);
-            u8 ability = rng.nextUInt(100);
-            if (parentAbility == 2)
-            {
-                ability = ability < 20 ? 0 : ability < 40 ? 1 : 2;
-            }
-            else if (parentAbility == 1)
-            {
-                ability = ability < 20 ? 0 : 1;
-            }
-            else
-            {
-                ability = ability < 80 ? 0 : 1;
-            }
+                u8 nature = rng.nextUInt(25);
+                if (daycare.getEverstoneCount() == 2)
+                {
+                    nature = daycare.getParentNature(rng.nextUInt(2));
+                }
+                else if (daycare.getParentItem(0) == 1)
+                {
+                    nature = daycare.getParentNature(0);
+                }
+                else if (daycare.getParentItem(1) == 1)
+                {
+                    nature = daycare.getParentNature(1);
+                }
 
-            // Determine inheritance
-            std::array<u8, 6> inheritance = { 0, 0, 0, 0, 0, 0 };
-            for (u8 i = 0; i < inheritanceCount;)
-            {
-                u8 index = rng.nextUInt(6);
-                if (inheritance[index] == 0)
+                // If we have a ditto acting as the female, get the ability from the other parent (this will be slot 0)
+                u8 parentAbility = daycare.getParentAbility(daycare.getParentGender(1) == 3 ? 0 : 1);
+                u8 ability = rng.nextUInt(100);
+                if (parentAbility == 2)
                 {
-                    inheritance[index] = rng.nextUInt(2) + 1;
-                    i++;
+                    ability = ability < 20 ? 0 : ability < 40 ? 1 : 2;
+                }
+                else if (parentAbility == 1)
+                {
+                    ability = ability < 20 ? 0 : 1;
+                }
+                else
+                {
+                    ability = ability < 80 ? 0 : 1;
                 }
-            }
 
-            // Assign IVs and inheritance
-            std::array<u8, 6> ivs;
-            for (u8 i = 0; i < 6; i++)
-            {
-                u8 iv = rng.nextUInt(32);
-                if (inheritance[i] == 1)
+                // Determine inheritance
+                std::array<u8, 6> inheritance = { 0, 0, 0, 0, 0, 0 };
+                for (u8 i = 0; i < inheritanceCount;)
                 {
-                    iv = daycare.getParentIV(0, i);
+                    u8 index = rng.nextUInt(6);
+                    if (inheritance[index] == 0)
+                    {
+                        inheritance[index] = rng.nextUInt(2) + 1;
+                        i++;
+                    }
                 }
-                else if (inheritance[i] == 2)
+
+                // Assign IVs and inheritance
+                std::array<u8, 6> ivs;
+                for (u8 i = 0; i < 6; i++)
                 {
-                    iv = daycare.getParentIV(1, i);
+                    u8 iv = rng.nextUInt(32);
+                    if (inheritance[i] == 1)
+                    {
+                        iv = daycare.getParentIV(0, i);
+                    }
+                    else if (inheritance[i] == 2)
+                    {
+                        iv = daycare.getParentIV(1, i);
+                    }
+                    ivs[i] = iv;
                 }
-                ivs[i] = iv;
-            }
 
-            u32 ec = rng.nextUInt(0xffffffff);
+                u32 ec = rng.nextUInt(0xffffffff);
 
-            // Assign PID if we have masuda or shiny charm
-            u32 pid = 0;
-            for (u8 roll = 0; roll < pidRolls; roll++)
-            {
-                pid = rng.nextUInt(0xffffffff);
-                if (Utilities::isShiny<false>(pid, tsv))
+                // Assign PID if we have masuda or shiny charm
+                u32 pid = 0;
+                for (u8 roll = 0; roll < pidRolls; roll++)
                 {
-                    break;
+                    pid = rng.nextUInt(0xffffffff);
+                    if (Utilities::isShiny<false>(pid, tsv))
+                    {
+                        break;
+                    }
                 }
-            }
 
-            // Ball handling check
-            // Uses a rand call, maybe add later
+                // Ball handling check
+                // Uses a rand call, maybe add later
 
-            EggState8 state(initialAdvances + cnt, ec, pid, ivs, ability, gender, 1, nature, Utilities::getShiny<false>(pid, tsv),
-                            inheritance, seed, info);
-            if (filter.compareState(static_cast<const State &>(state)))
-            {
-                states.emplace_back(state);
+                EggState8 state(initialAdvances + cnt, ec, pid, ivs, ability, gender, 1, nature, Utilities::getShiny<false>(pid, tsv),
+                                inheritance, seed, info);
+                if (filter.compareState(static_cast<const State &>(state)))
+                {
+                    states.emplace_back(state);
+                }
             }
         }
-    }
 
-    return states;
+        return states;
+    });
 }
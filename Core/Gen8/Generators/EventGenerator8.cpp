@@ -22,6 +22,7 @@
 #include <Core/Gen8/States/State8.hpp>
 #include <Core/RNG/RNGList.hpp>
 #include <Core/RNG/Xorshift.hpp>
+#include <Core/Util/Parallel.hpp>
 #include <Core/Util/Utilities.hpp>
 
 static u32 gen(Xorshift &rng)
@@ -39,110 +40,112 @@ EventGenerator8::EventGenerator8(u32 initialAdvances, u32 maxAdvances, u32 offse
     }
 }
 
-std::vector<State8> EventGenerator8::generate(u64 seed0, u64 seed1) const
+std::vector<State8> EventGenerator8::generate(u64 seed0, u64 seed1, int threads) const
 {
     const PersonalInfo *info = wb8.getInfo(profile.getVersion());
-    RNGList<u32, Xorshift, 32, gen> rngList(seed0, seed1, initialAdvances + offset);
+    return generateParallel<State8>(static_cast<u64>(maxAdvances) + 1, threads, [&](u64 start, u64 end) {
+        RNGList<u32, Xorshift, 32, gen> rngList(seed0, seed1, initialAdvances + offset + start);
 
-    std::vector<State8> states;
-    for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rngList.advanceState())
-    {
-        u32 ec = wb8.getEC() == 0 ? rngList.next() : wb8.getEC();
-
-        u32 pid;
-        u8 shiny;
-        switch (wb8.getShiny())
+        std::vector<State8> states;
+        for (u64 cnt = start; cnt < end; cnt++, rngList.advanceState())
         {
-        case 0:
-            pid = rngList.next();
-            if (Utilities::isShiny<false>(pid, tsv))
+            u32 ec = wb8.getEC() == 0 ? rngList.next() : wb8.getEC();
+
+            u32 pid;
+            u8 shiny;
+            switch (wb8.getShiny())
             {
-                pid ^= 0x10000000;
+            case 0:
+                pid = rngList.next();
+                if (Utilities::isShiny<false>(pid, tsv))
+                {
+                    pid ^= 0x10000000;
+                }
+                shiny = 0;
+                break;
+
+            case 1:
+            case 2:
+                pid = rngList.next();
+                if (Utilities::getShiny<false>(pid, tsv) != wb8.getShiny())
+                {
+                    u16 high = (pid & 0xFFFF) ^ tsv ^ (2 - wb8.getShiny());
+                    pid = (high << 16) | (pid & 0xFFFF);
+                }
+
+                shiny = wb8.getShiny();
+                break;
+
+            case 4:
+                pid = wb8.getPID();
+                shiny = Utilities::getShiny<false>(pid, tsv);
+                break;
             }
-            shiny = 0;
-            break;
 
-        case 1:
-        case 2:
-            pid = rngList.next();
-            if (Utilities::getShiny<false>(pid, tsv) != wb8.getShiny())
+            std::array<u8, 6> ivs = { 255, 255, 255, 255, 255, 255 };
+            for (u8 i = 0; i < wb8.getIVCount();)
             {
-                u16 high = (pid & 0xFFFF) ^ tsv ^ (2 - wb8.getShiny());
-                pid = (high << 16) | (pid & 0xFFFF);
+                u8 index = rngList.next(6);
+                if (ivs[index] == 255)
+                {
+                    ivs[index] = 31;
+                    i++;
+                }
             }
 
-            shiny = wb8.getShiny();
-            break;
-
-        case 4:
-            pid = wb8.getPID();
-            shiny = Utilities::getShiny<false>(pid, tsv);
-            break;
-        }
-
-        std::array<u8, 6> ivs = { 255, 255, 255, 255, 255, 255 };
-        for (u8 i = 0; i < wb8.getIVCount();)
-        {
-            u8 index = rngList.next(6);
-            if (ivs[index] == 255)
+            for (u8 &iv : ivs)
             {
-                ivs[index] = 31;
-                i++;
+                if (iv == 255)
+                {
+                    iv = rngList.next(32);
+                }
             }
-        }
 
-        for (u8 &iv : ivs)
-        {
-            if (iv == 255)
+            u8 ability;
+            switch (wb8.getAbility())
             {
-                iv = rngList.next(32);
+            case 0:
+            case 1:
+            case 2:
+                ability = wb8.getAbility();
+                break;
+            case 3:
+                ability = rngList.next(2);
+                break;
+            case 4:
+                ability = rngList.next(3);
+                break;
             }
-        }
 
-        u8 ability;
-        switch (wb8.getAbility())
-        {
-        case 0:
-        case 1:
-        case 2:
-            ability = wb8.getAbility();
-            break;
-        case 3:
-            ability = rngList.next(2);
-            break;
-        case 4:
-            ability = rngList.next(3);
-            break;
-        }
-
-        u8 gender;
-        switch (wb8.getGender())
-        {
-        // Force gender
-        case 0:
-        case 1:
-        case 2:
-            gender = wb8.getGender();
-            break;
-        default:
-            gender = rngList.next(252) + 1 < wb8.getGender();
-            break;
-        }
+            u8 gender;
+            switch (wb8.getGender())
+            {
+            // Force gender
+            case 0:
+            case 1:
+            case 2:
+                gender = wb8.getGender();
+                break;
+            default:
+                gender = rngList.next(252) + 1 < wb8.getGender();
+                break;
+            }
 
-        u8 nature = wb8.getNature() != 255 ? wb8.getNature() : rngList.next(25);
+            u8 nature = wb8.getNature() != 255 ? wb8.getNature() : rngList.next(25);
 
-        u8 height = rngList.next(129);
-        height += rngList.next(128);
+            u8 height = rngList.next(129);
+            height += rngList.next(128);
 
-        u8 weight = rngList.next(129);
-        weight += rngList.next(128);
+            u8 weight = rngList.next(129);
+            weight += rngList.next(128);
 
-        State8 state(initialAdvances + cnt, ec, pid, ivs, ability, gender, wb8.getLevel(), nature, shiny, height, weight, info);
-        if (filter.compareState(state))
-        {
-            states.emplace_back(state);
+            State8 state(initialAdvances + cnt, ec, pid, ivs, ability, gender, wb8.getLevel(), nature, shiny, height, weight, info);
+            if (filter.compareState(state))
+            {
+                states.emplace_back(state);
+            }
         }
-    }
 
-    return states;
+        return states;
+    });
 }
@@ -21,6 +21,7 @@
 #include <Core/Gen8/States/IDState8.hpp>
 #include <Core/RNG/RNGList.hpp>
 #include <Core/RNG/Xorshift.hpp>
+#include <Core/Util/Parallel.hpp>
 
 static u32 gen(Xorshift &rng)
 {
@@ -31,29 +32,31 @@ IDGenerator8::IDGenerator8(u32 initialAdvances, u32 maxAdvances, const IDFilter
 {
 }
 
-std::vector<IDState8> IDGenerator8::generate(u64 seed0, u64 seed1) const
+std::vector<IDState8> IDGenerator8::generate(u64 seed0, u64 seed1, int threads) const
 {
-    RNGList<u32, Xorshift, 2, gen> rngList(seed0, seed1, initialAdvances);
+    return generateParallel<IDState8>(maxAdvances, threads, [&](u64 start, u64 end) {
+        RNGList<u32, Xorshift, 2, gen> rngList(seed0, seed1, initialAdvances + start);
 
-    std::vector<IDState8> states;
-    for (u32 cnt = 0; cnt < maxAdvances; cnt++, rngList.advanceState())
-    {
-        u32 sidtid;
-        do
+        std::vector<IDState8> states;
+        for (u64 cnt = start; cnt < end; cnt++, rngList.advanceState())
         {
-            sidtid = rngList.next();
-        } while (sidtid == 0);
-
-        u16 tid = sidtid & 0xffff;
-        u16 sid = sidtid >> 16;
-        u32 displayTID = sidtid % 1000000;
-
-        IDState8 state(initialAdvances + cnt, tid, sid, displayTID);
-        if (filter.compareState(state))
-        {
-            states.emplace_back(state);
+            u32 sidtid;
+            do
+            {
+                sidtid = rngList.next();
+            } while (sidtid == 0);
+
+            u16 tid = sidtid & 0xffff;
+            u16 sid = sidtid >> 16;
+            u32 displayTID = sidtid % 1000000;
+
+            IDState8 state(initialAdvances + cnt, tid, sid, displayTID);
+            if (filter.compareState(state))
+            {
+                states.emplace_back(state);
+            }
         }
-    }
 
-    return states;
+        return states;
+    });
 }
@@ -24,159 +24,261 @@
 #include <Core/Parents/PersonalInfo.hpp>
 #include <Core/RNG/Xoroshiro.hpp>
 #include <Core/Util/Utilities.hpp>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <thread>
 
 constexpr u8 toxtricityAmpedNatures[] = { 3, 4, 2, 8, 9, 19, 22, 11, 13, 14, 0, 6, 24 };
 constexpr u8 toxtricityLowKeyNatures[] = { 1, 5, 7, 10, 12, 15, 16, 17, 18, 20, 21, 23 };
 
+constexpr int lanes = 8;
+
+static void step(u64 &s0, u64 &s1)
+{
+    s1 ^= s0;
+    s0 = std::rotl(s0, 24) ^ s1 ^ (s1 << 16);
+    s1 = std::rotl(s1, 37);
+}
+
 RaidGenerator::RaidGenerator(u32 initialAdvances, u32 maxAdvances, u32 offset, const Profile8 &profile, const StateFilter &filter) :
     Generator(initialAdvances, maxAdvances, offset, Method::None, profile, filter)
 {
 }
 
 std::vector<State8> RaidGenerator::generate(u64 seed, u8 level, const Raid &raid) const
+{
+    std::vector<State8> states;
+    generate(seed, level, raid, 0, static_cast<u64>(maxAdvances) + 1, states);
+    return states;
+}
+
+std::vector<std::vector<State8>> RaidGenerator::generate(const std::vector<RaidTarget> &targets, int threads) const
+{
+    constexpr u64 chunkSize = 0x10000;
+
+    u64 total = static_cast<u64>(maxAdvances) + 1;
+    u64 chunks = (total + chunkSize - 1) / chunkSize;
+    std::vector<std::vector<State8>> chunkStates(targets.size() * chunks);
+
+    threads = static_cast<int>(std::clamp<size_t>(chunkStates.size(), 1, std::max(threads, 1)));
+
+    std::atomic<size_t> next = 0;
+    auto *threadContainer = new std::thread[threads];
+    for (int i = 0; i < threads; i++)
+    {
+        threadContainer[i] = std::thread([&] {
+            for (size_t task; (task = next++) < chunkStates.size();)
+            {
+                const RaidTarget &target = targets[task / chunks];
+                u64 start = (task % chunks) * chunkSize;
+                generate(target.seed, target.level, target.raid, start, std::min(start + chunkSize, total), chunkStates[task]);
+            }
+        });
+    }
+
+    for (int i = 0; i < threads; i++)
+    {
+        threadContainer[i].join();
+    }
+
+    delete[] threadContainer;
+
+    std::vector<std::vector<State8>> states(targets.size());
+    for (size_t i = 0; i < chunkStates.size(); i++)
+    {
+        auto &target = states[i / chunks];
+        target.insert(target.end(), chunkStates[i].begin(), chunkStates[i].end());
+    }
+
+    return states;
+}
+
+void RaidGenerator::generate(u64 seed, u8 level, const Raid &raid, u64 start, u64 end, std::vector<State8> &states) const
 {
     const PersonalInfo *info = raid.getInfo();
-    seed += 0x82A2B175229D6A5B * (initialAdvances + offset);
+    seed += 0x82A2B175229D6A5B * (initialAdvances + offset + start);
 
-    std::vector<State8> states;
-    for (u32 cnt = 0; cnt <= maxAdvances; cnt++, seed += 0x82A2B175229D6A5B)
+    for (u64 cnt = start; cnt < end; cnt += lanes, seed += 0x82A2B175229D6A5B * lanes)
     {
-        Xoroshiro rng(seed);
+        // The first three outputs of consecutive seeds are independent, compute them side by side so they vectorize
+        std::array<u64, lanes> s0;
+        std::array<u64, lanes> s1;
+        std::array<u32, lanes> ecs;
+        std::array<u32, lanes> sidtids;
+        std::array<u32, lanes> pids;
+        for (int lane = 0; lane < lanes; lane++)
+        {
+            s0[lane] = seed + 0x82A2B175229D6A5B * lane;
+            s1[lane] = 0x82A2B175229D6A5B;
+        }
+
+        for (int lane = 0; lane < lanes; lane++)
+        {
+            ecs[lane] = s0[lane] + s1[lane];
+            step(s0[lane], s1[lane]);
+            sidtids[lane] = s0[lane] + s1[lane];
+            step(s0[lane], s1[lane]);
+            pids[lane] = s0[lane] + s1[lane];
+            step(s0[lane], s1[lane]);
+        }
 
-        u32 ec = rng.nextUInt<0xffffffff>();
-        u32 sidtid = rng.nextUInt<0xffffffff>();
-        u32 pid = rng.nextUInt<0xffffffff>();
-        u8 shiny;
-        if (raid.getShiny() == Shiny::Random) // Random shiny chance
+        for (int lane = 0; lane < lanes && cnt + lane < end; lane++)
         {
-            // Game uses a fake TID/SID to determine shiny or not
-            // PID is later modified using the actual TID/SID of trainer if necessary
-            shiny = Utilities::getShiny<false>(pid, (sidtid >> 16) ^ (sidtid & 0xffff));
-            if (shiny) // Force shiny
+            Xoroshiro rng(s0[lane], s1[lane]);
+            u32 ec = ecs[lane];
+            u32 sidtid = sidtids[lane];
+            u32 pid = pids[lane];
+
+            // Rejection sampling was hit, redo the lane serially
+            if (ec == 0xffffffff || sidtid == 0xffffffff || pid == 0xffffffff)
             {
-                if (Utilities::getShiny<false>(pid, tsv) != shiny)
+                rng = Xoroshiro(seed + 0x82A2B175229D6A5B * lane);
+                ec = rng.nextUInt<0xffffffff>();
+                sidtid = rng.nextUInt<0xffffffff>();
+                pid = rng.nextUInt<0xffffffff>();
+            }
+
+            u8 shiny;
+            if (raid.getShiny() == Shiny::Random) // Random shiny chance
+            {
+                // Game uses a fake TID/SID to determine shiny or not
+                // PID is later modified using the actual TID/SID of trainer if necessary
+                shiny = Utilities::getShiny<false>(pid, (sidtid >> 16) ^ (sidtid & 0xffff));
+                if (shiny) // Force shiny
                 {
-                    u16 high = (pid & 0xFFFF) ^ tsv ^ (2 - shiny);
-                    pid = (high << 16) | (pid & 0xFFFF);
+                    if (Utilities::getShiny<false>(pid, tsv) != shiny)
+                    {
+                        u16 high = (pid & 0xFFFF) ^ tsv ^ (2 - shiny);
+                        pid = (high << 16) | (pid & 0xFFFF);
+                    }
+                }
+                else // Force non shiny
+                {
+                    if (Utilities::isShiny<false>(pid, tsv))
+                    {
+                        pid ^= 0x10000000;
+                    }
                 }
             }
-            else // Force non shiny
+            else if (raid.getShiny() == Shiny::Never) // Force non-shiny
             {
+                shiny = 0;
                 if (Utilities::isShiny<false>(pid, tsv))
                 {
                     pid ^= 0x10000000;
                 }
             }
-        }
-        else if (raid.getShiny() == Shiny::Never) // Force non-shiny
-        {
-            shiny = 0;
-            if (Utilities::isShiny<false>(pid, tsv))
+            else // Force shiny
             {
-                pid ^= 0x10000000;
+                shiny = 2;
+                if (Utilities::getShiny<false>(pid, tsv) != shiny) // Check if PID is not normally square shiny
+                {
+                    // Force shiny (makes it square)
+                    u16 high = (pid & 0xffff) ^ tsv;
+                    pid = (high << 16) | (pid & 0xffff);
+                }
             }
-        }
-        else // Force shiny
-        {
-            shiny = 2;
-            if (Utilities::getShiny<false>(pid, tsv) != shiny) // Check if PID is not normally square shiny
+
+            if (!filter.compareShiny(shiny))
             {
-                // Force shiny (makes it square)
-                u16 high = (pid & 0xffff) ^ tsv;
-                pid = (high << 16) | (pid & 0xffff);
+                continue;
             }
-        }
 
-        // Set IVs that will be 31s
-        std::array<u8, 6> ivs = { 255, 255, 255, 255, 255, 255 };
-        for (u8 i = 0; i < raid.getIVCount();)
-        {
-            u8 index = rng.nextUInt<6>();
-            if (ivs[index] == 255)
+            // Set IVs that will be 31s
+            std::array<u8, 6> ivs = { 255, 255, 255, 255, 255, 255 };
+            for (u8 i = 0; i < raid.getIVCount();)
             {
-                ivs[index] = 31;
-                i++;
+                u8 index = rng.nextUInt<6>();
+                if (ivs[index] == 255)
+                {
+                    ivs[index] = 31;
+                    i++;
+                }
             }
-        }
 
-        // Fill rest of IVs with rand calls
-        for (u8 &iv : ivs)
-        {
-            if (iv == 255)
+            // Fill rest of IVs with rand calls
+            for (u8 &iv : ivs)
             {
-                iv = rng.nextUInt<32>();
+                if (iv == 255)
+                {
+                    iv = rng.nextUInt<32>();
+                }
             }
-        }
 
-        u8 ability;
-        if (raid.getAbility() == 4) // Allow hidden ability
-        {
-            ability = rng.nextUInt<3>();
-        }
-        else if (raid.getAbility() == 3) // No hidden ability
-        {
-            ability = rng.nextUInt<2>();
-        }
-        else // Locked ability
-        {
-            ability = raid.getAbility();
-        }
+            if (!filter.compareIV(ivs))
+            {
+                continue;
+            }
 
-        // Altform, doesn't seem to have a rand call for raids
+            u8 ability;
+            if (raid.getAbility() == 4) // Allow hidden ability
+            {
+                ability = rng.nextUInt<3>();
+            }
+            else if (raid.getAbility() == 3) // No hidden ability
+            {
+                ability = rng.nextUInt<2>();
+            }
+            else // Locked ability
+            {
+                ability = raid.getAbility();
+            }
 
-        u8 gender;
-        switch (raid.getGender())
-        {
-        case 0: // Random
-            switch (info->getGender())
+            // Altform, doesn't seem to have a rand call for raids
+
+            u8 gender;
+            switch (raid.getGender())
             {
-            case 255:
-                gender = 2;
-                break;
-            case 254:
-                gender = 1;
-                break;
-            case 0:
-                gender = 0;
-                break;
-            default:
-                gender = (rng.nextUInt<253>() + 1) < info->getGender();
+            case 0: // Random
+                switch (info->getGender())
+                {
+                case 255:
+                    gender = 2;
+                    break;
+                case 254:
+                    gender = 1;
+                    break;
+                case 0:
+                    gender = 0;
+                    break;
+                default:
+                    gender = (rng.nextUInt<253>() + 1) < info->getGender();
+                    break;
+                }
                 break;
+            default: // Male/Female/Genderless
+                gender = raid.getGender() - 1;
             }
-            break;
-        default: // Male/Female/Genderless
-            gender = raid.getGender() - 1;
-        }
 
-        u8 nature;
-        if (raid.getSpecie() != 849)
-        {
-            nature = rng.nextUInt<25>();
-        }
-        else
-        {
-            if (raid.getForm() == 0)
+            u8 nature;
+            if (raid.getSpecie() != 849)
             {
-                nature = toxtricityAmpedNatures[rng.nextUInt<13>()];
+                nature = rng.nextUInt<25>();
             }
             else
             {
-                nature = toxtricityLowKeyNatures[rng.nextUInt<12>()];
+                if (raid.getForm() == 0)
+                {
+                    nature = toxtricityAmpedNatures[rng.nextUInt<13>()];
+                }
+                else
+                {
+                    nature = toxtricityLowKeyNatures[rng.nextUInt<12>()];
+                }
             }
-        }
 
-        u8 height = rng.nextUInt<129>();
-        height += rng.nextUInt<128>();
+            u8 height = rng.nextUInt<129>();
+            height += rng.nextUInt<128>();
 
-        u8 weight = rng.nextUInt<129>();
-        weight += rng.nextUInt<128>();
+            u8 weight = rng.nextUInt<129>();
+            weight += rng.nextUInt<128>();
 
-        State8 state(initialAdvances + cnt, ec, pid, ivs, ability, gender, level, nature, shiny, height, weight, info);
-        if (filter.compareState(state))
-        {
-            states.emplace_back(state);
+            State8 state(initialAdvances + cnt + lane, ec, pid, ivs, ability, gender, level, nature, shiny, height, weight, info);
+            if (filter.compareState(state))
+            {
+                states.emplace_back(state);
+            }
         }
     }
-
-    return states;
 }
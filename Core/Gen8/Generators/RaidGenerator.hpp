@@ -21,12 +21,22 @@
 #define RAIDGENERATOR_HPP
 
 #include <Core/Gen8/Profile8.hpp>
+#include <Core/Gen8/Raid.hpp>
 #include <Core/Parents/Filters/StateFilter.hpp>
 #include <Core/Parents/Generators/Generator.hpp>
 
-class Raid;
 class State8;
 
+/**
+ * @brief Den seed and raid pokemon to generate states for
+ */
+struct RaidTarget
+{
+    u64 seed;
+    Raid raid;
+    u8 level;
+};
+
 /**
  * @brief Raid encounter generator for Gen8
  */
@@ -53,6 +63,29 @@ public:
      * @return Vector of computed states
      */
     std::vector<State8> generate(u64 seed, u8 level, const Raid &raid) const;
+
+    /**
+     * @brief Generates states for every target, splitting the advances of each target across \p threads
+     *
+     * @param targets Den seeds and raid pokemon
+     * @param threads Numbers of threads to generate with
+     *
+     * @return Vector of computed states for each target
+     */
+    std::vector<std::vector<State8>> generate(const std::vector<RaidTarget> &targets, int threads) const;
+
+private:
+    /**
+     * @brief Generates states for the \p raid between the \p start and \p end advances
+     *
+     * @param seed PRNG state
+     * @param level Raid level
+     * @param raid Pokemon template
+     * @param start First advance relative to the initial advances
+     * @param end Last advance (exclusive) relative to the initial advances
+     * @param states Vector to write results
+     */
+    void generate(u64 seed, u8 level, const Raid &raid, u64 start, u64 end, std::vector<State8> &states) const;
 };
 
 #endif // RAIDGENERATOR_HPP
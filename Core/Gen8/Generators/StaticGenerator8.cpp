@@ -25,6 +25,7 @@
 #include <Core/RNG/RNGList.hpp>
 #include <Core/RNG/Xoroshiro.hpp>
 #include <Core/RNG/Xorshift.hpp>
+#include <Core/Util/Parallel.hpp>
 #include <Core/Util/Utilities.hpp>
 
 static u32 gen(Xorshift &rng)
@@ -38,230 +39,236 @@ StaticGenerator8::StaticGenerator8(u32 initialAdvances, u32 maxAdvances, u32 off
 {
 }
 
-std::vector<State8> StaticGenerator8::generate(u64 seed0, u64 seed1) const
+std::vector<State8> StaticGenerator8::generate(u64 seed0, u64 seed1, int threads) const
 {
     if (staticTemplate.getRoamer())
     {
-        return generateRoamer(seed0, seed1);
+        return generateRoamer(seed0, seed1, threads);
     }
     else
     {
-        return generateNonRoamer(seed0, seed1);
+        return generateNonRoamer(seed0, seed1, threads);
     }
 }
 
-std::vector<State8> StaticGenerator8::generateNonRoamer(u64 seed0, u64 seed1) const
+std::vector<State8> StaticGenerator8::generateNonRoamer(u64 seed0, u64 seed1, int threads) const
 {
     const PersonalInfo *info = staticTemplate.getInfo();
-    RNGList<u32, Xorshift, 32, gen> rngList(seed0, seed1, initialAdvances + offset);
+    return generateParallel<State8>(static_cast<u64>(maxAdvances) + 1, threads, [&](u64 start, u64 end) {
+        RNGList<u32, Xorshift, 32, gen> rngList(seed0, seed1, initialAdvances + offset + start);
 
-    std::vector<State8> states;
-    for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rngList.advanceState())
-    {
-        u32 ec = rngList.next();
-        u32 sidtid = rngList.next();
-        u32 pid = rngList.next();
-
-        u8 shiny;
-        if (staticTemplate.getShiny() == Shiny::Never)
+        std::vector<State8> states;
+        for (u64 cnt = start; cnt < end; cnt++, rngList.advanceState())
         {
-            shiny = 0;
-            if (Utilities::isShiny<false>(pid, tsv))
+            u32 ec = rngList.next();
+            u32 sidtid = rngList.next();
+            u32 pid = rngList.next();
+
+            u8 shiny;
+            if (staticTemplate.getShiny() == Shiny::Never)
             {
-                pid ^= 0x10000000;
+                shiny = 0;
+                if (Utilities::isShiny<false>(pid, tsv))
+                {
+                    pid ^= 0x10000000;
+                }
             }
-        }
-        else
-        {
-            shiny = Utilities::getShiny<false>(pid, (sidtid >> 16) ^ (sidtid & 0xffff));
-            if (shiny) // Force shiny
+            else
             {
-                if (staticTemplate.getFateful())
+                shiny = Utilities::getShiny<false>(pid, (sidtid >> 16) ^ (sidtid & 0xffff));
+                if (shiny) // Force shiny
                 {
-                    shiny = 2;
-                }
+                    if (staticTemplate.getFateful())
+                    {
+                        shiny = 2;
+                    }
 
-                if (Utilities::getShiny<false>(pid, tsv) != shiny)
+                    if (Utilities::getShiny<false>(pid, tsv) != shiny)
+                    {
+                        u16 high = (pid & 0xFFFF) ^ tsv ^ (2 - shiny);
+                        pid = (high << 16) | (pid & 0xFFFF);
+                    }
+                }
+                else // Force non shiny
                 {
-                    u16 high = (pid & 0xFFFF) ^ tsv ^ (2 - shiny);
-                    pid = (high << 16) | (pid & 0xFFFF);
+                    if (Utilities::isShiny<false>(pid, tsv))
+                    {
+                        pid ^= 0x10000000;
+                    }
                 }
             }
-            else // Force non shiny
+
+            // Assign IVs set by template
+            std::array<u8, 6> ivs = { 255, 255, 255, 255, 255, 255 };
+            for (u8 i = 0; i < staticTemplate.getIVCount();)
             {
-                if (Utilities::isShiny<false>(pid, tsv))
+                u8 index = rngList.next(6);
+                if (ivs[index] == 255)
                 {
-                    pid ^= 0x10000000;
+                    ivs[index] = 31;
+                    i++;
                 }
             }
-        }
 
-        // Assign IVs set by template
-        std::array<u8, 6> ivs = { 255, 255, 255, 255, 255, 255 };
-        for (u8 i = 0; i < staticTemplate.getIVCount();)
-        {
-            u8 index = rngList.next(6);
-            if (ivs[index] == 255)
+            for (u8 &iv : ivs)
             {
-                ivs[index] = 31;
-                i++;
+                if (iv == 255)
+                {
+                    iv = rngList.next(32);
+                }
             }
-        }
 
-        for (u8 &iv : ivs)
-        {
-            if (iv == 255)
+            u8 ability;
+            switch (staticTemplate.getAbility())
             {
-                iv = rngList.next(32);
+            case 0:
+            case 1:
+                ability = staticTemplate.getAbility();
+                break;
+            case 2:
+                ability = 2;
+                rngList.next();
+                break;
+            default:
+                ability = rngList.next(2);
+                break;
             }
-        }
 
-        u8 ability;
-        switch (staticTemplate.getAbility())
-        {
-        case 0:
-        case 1:
-            ability = staticTemplate.getAbility();
-            break;
-        case 2:
-            ability = 2;
-            rngList.next();
-            break;
-        default:
-            ability = rngList.next(2);
-            break;
-        }
+            u8 gender;
+            switch (info->getGender())
+            {
+            case 255:
+                gender = 2;
+                break;
+            case 254:
+                gender = 1;
+                break;
+            case 0:
+                gender = 0;
+                break;
+            default:
+                if ((lead == Lead::CuteCharmF || lead == Lead::CuteCharmM) && rngList.next(3) > 0)
+                {
+                    gender = lead == Lead::CuteCharmF ? 0 : 1;
+                }
+                else
+                {
+                    gender = rngList.next(253) + 1 < info->getGender();
+                }
+                break;
+            }
 
-        u8 gender;
-        switch (info->getGender())
-        {
-        case 255:
-            gender = 2;
-            break;
-        case 254:
-            gender = 1;
-            break;
-        case 0:
-            gender = 0;
-            break;
-        default:
-            if ((lead == Lead::CuteCharmF || lead == Lead::CuteCharmM) && rngList.next(3) > 0)
+            u8 nature;
+            if (lead <= Lead::SynchronizeEnd)
             {
-                gender = lead == Lead::CuteCharmF ? 0 : 1;
+                nature = toInt(lead);
             }
             else
             {
-                gender = rngList.next(253) + 1 < info->getGender();
+                nature = rngList.next(25);
             }
-            break;
-        }
-
-        u8 nature;
-        if (lead <= Lead::SynchronizeEnd)
-        {
-            nature = toInt(lead);
-        }
-        else
-        {
-            nature = rngList.next(25);
-        }
 
-        u8 height = rngList.next(129);
-        height += rngList.next(128);
+            u8 height = rngList.next(129);
+            height += rngList.next(128);
 
-        u8 weight = rngList.next(129);
-        weight += rngList.next(128);
+            u8 weight = rngList.next(129);
+            weight += rngList.next(128);
 
-        State8 state(initialAdvances + cnt, ec, pid, ivs, ability, gender, staticTemplate.getLevel(), nature, shiny, height, weight, info);
-        if (filter.compareState(state))
-        {
-            states.emplace_back(state);
+            State8 state(initialAdvances + cnt, ec, pid, ivs, ability, gender, staticTemplate.getLevel(), nature, shiny, height, weight,
+                         info);
+            if (filter.compareState(state))
+            {
+                states.emplace_back(state);
+            }
         }
-    }
 
-    return states;
+        return states;
+    });
 }
 
-std::vector<State8> StaticGenerator8::generateRoamer(u64 seed0, u64 seed1) const
+std::vector<State8> StaticGenerator8::generateRoamer(u64 seed0, u64 seed1, int threads) const
 {
     // Going to ignore most of the parameters
     // Only roamers are Cresselia/Mesprit which have identical parameters
     u8 gender = staticTemplate.getSpecie() == 488 ? 1 : 2;
     const PersonalInfo *info = staticTemplate.getInfo();
 
-    Xorshift roamer(seed0, seed1, initialAdvances + offset);
+    return generateParallel<State8>(static_cast<u64>(maxAdvances) + 1, threads, [&](u64 start, u64 end) {
+        Xorshift roamer(seed0, seed1, initialAdvances + offset + start);
 
-    std::vector<State8> states;
-    for (u32 cnt = 0; cnt <= maxAdvances; cnt++)
-    {
-        u32 ec = roamer.next(0x80000000, 0x7fffffff);
-        XoroshiroBDSP rng(ec);
+        std::vector<State8> states;
+        for (u64 cnt = start; cnt < end; cnt++)
+        {
+            u32 ec = roamer.next(0x80000000, 0x7fffffff);
+            XoroshiroBDSP rng(ec);
 
-        u32 sidtid = rng.nextUInt(0xffffffff);
-        u32 pid = rng.nextUInt(0xffffffff);
+            u32 sidtid = rng.nextUInt(0xffffffff);
+            u32 pid = rng.nextUInt(0xffffffff);
 
-        u8 shiny = Utilities::getShiny<false>(pid, (sidtid >> 16) ^ (sidtid & 0xffff));
-        if (shiny) // Force shiny
-        {
-            if (Utilities::getShiny<false>(pid, tsv) != shiny)
+            u8 shiny = Utilities::getShiny<false>(pid, (sidtid >> 16) ^ (sidtid & 0xffff));
+            if (shiny) // Force shiny
             {
-                u16 high = (pid & 0xFFFF) ^ tsv ^ (2 - shiny);
-                pid = (high << 16) | (pid & 0xFFFF);
+                if (Utilities::getShiny<false>(pid, tsv) != shiny)
+                {
+                    u16 high = (pid & 0xFFFF) ^ tsv ^ (2 - shiny);
+                    pid = (high << 16) | (pid & 0xFFFF);
+                }
             }
-        }
-        else // Force non shiny
-        {
-            if (Utilities::isShiny<false>(pid, tsv))
+            else // Force non shiny
             {
-                pid ^= 0x10000000;
+                if (Utilities::isShiny<false>(pid, tsv))
+                {
+                    pid ^= 0x10000000;
+                }
             }
-        }
 
-        // Assign 3 31 IVs
-        std::array<u8, 6> ivs = { 255, 255, 255, 255, 255, 255 };
-        for (int i = 0; i < 3;)
-        {
-            u8 index = rng.nextUInt(6);
-            if (ivs[index] == 255)
+            // Assign 3 31 IVs
+            std::array<u8, 6> ivs = { 255, 255, 255, 255, 255, 255 };
+            for (int i = 0; i < 3;)
             {
-                ivs[index] = 31;
-                i++;
+                u8 index = rng.nextUInt(6);
+                if (ivs[index] == 255)
+                {
+                    ivs[index] = 31;
+                    i++;
+                }
             }
-        }
 
-        for (u8 &iv : ivs)
-        {
-            if (iv == 255)
+            for (u8 &iv : ivs)
             {
-                iv = rng.nextUInt(32);
+                if (iv == 255)
+                {
+                    iv = rng.nextUInt(32);
+                }
             }
-        }
 
-        // No HA possible for roamers
-        u8 ability = rng.nextUInt(2);
+            // No HA possible for roamers
+            u8 ability = rng.nextUInt(2);
 
-        u8 nature;
-        if (lead <= Lead::SynchronizeEnd)
-        {
-            nature = toInt(lead);
-        }
-        else
-        {
-            nature = rng.nextUInt(25);
-        }
+            u8 nature;
+            if (lead <= Lead::SynchronizeEnd)
+            {
+                nature = toInt(lead);
+            }
+            else
+            {
+                nature = rng.nextUInt(25);
+            }
 
-        u8 height = rng.nextUInt(129);
-        height += rng.nextUInt(128);
+            u8 height = rng.nextUInt(129);
+            height += rng.nextUInt(128);
 
-        u8 weight = rng.nextUInt(129);
-        weight += rng.nextUInt(128);
+            u8 weight = rng.nextUInt(129);
+            weight += rng.nextUInt(128);
 
-        State8 state(initialAdvances + cnt, ec, pid, ivs, ability, gender, staticTemplate.getLevel(), nature, shiny, height, weight, info);
-        if (filter.compareState(state))
-        {
-            states.emplace_back(state);
+            State8 state(initialAdvances + cnt, ec, pid, ivs, ability, gender, staticTemplate.getLevel(), nature, shiny, height, weight,
+                         info);
+            if (filter.compareState(state))
+            {
+                states.emplace_back(state);
+            }
         }
-    }
 
-    return states;
+        return states;
+    });
 }
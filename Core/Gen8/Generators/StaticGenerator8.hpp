@@ -52,10 +52,11 @@ public:
      *
      * @param seed0 Upper half of PRNG state
      * @param seed1 Lower half of PRNG state
+     * @param threads Number of threads to generate with
      *
      * @return Vector of computed states
      */
-    std::vector<State8> generate(u64 seed0, u64 seed1) const;
+    std::vector<State8> generate(u64 seed0, u64 seed1, int threads = 1) const;
 
 private:
     /**
@@ -63,20 +64,22 @@ private:
      *
      * @param seed0 Upper half of PRNG state
      * @param seed1 Lower half of PRNG state
+     * @param threads Number of threads to generate with
      *
      * @return Vector of computed states
      */
-    std::vector<State8> generateNonRoamer(u64 seed0, u64 seed1) const;
+    std::vector<State8> generateNonRoamer(u64 seed0, u64 seed1, int threads) const;
 
     /**
      * @brief Generates states for roamers
      *
      * @param seed0 Upper half of PRNG state
      * @param seed1 Lower half of PRNG state
+     * @param threads Number of threads to generate with
      *
      * @return Vector of computed states
      */
-    std::vector<State8> generateRoamer(u64 seed0, u64 seed1) const;
+    std::vector<State8> generateRoamer(u64 seed0, u64 seed1, int threads) const;
 };
 
 #endif // STATICGENERATOR8_HPP
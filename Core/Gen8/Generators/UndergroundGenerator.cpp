@@ -25,6 +25,7 @@
 #include <Core/Parents/PersonalLoader.hpp>
 #include <Core/RNG/RNGList.hpp>
 #include <Core/RNG/Xorshift.hpp>
+#include <Core/Util/Parallel.hpp>
 #include <Core/Util/Utilities.hpp>
 #include <algorithm>
 
@@ -243,149 +244,151 @@ UndergroundGenerator::UndergroundGenerator(u32 initialAdvances, u32 maxAdvances,
 {
 }
 
-std::vector<UndergroundState> UndergroundGenerator::generate(u64 seed0, u64 seed1) const
+std::vector<UndergroundState> UndergroundGenerator::generate(u64 seed0, u64 seed1, int threads) const
 {
-    RNGList<u32, Xorshift, 256> rngList(seed0, seed1, initialAdvances + offset);
-    const PersonalInfo *base = PersonalLoader::getPersonal(profile.getVersion());
-    const auto &levelInfo = levelInfoList[levelFlag];
-    u8 pidRolls = diglett ? 2 : 1;
-
-    auto createPokemon = [=, &rngList](u32 advances, u16 specie) {
-        u8 level;
-        if (lead == Lead::Pressure)
-        {
-            level = levelInfo.max;
-        }
-        else
-        {
-            u8 range = levelInfo.max - levelInfo.min + 1;
-            level = levelInfo.min + rngList.next(range);
-        }
-
-        u32 ec = rngList.next(rand);
-        u32 sidtid = rngList.next(rand);
-        u32 pid;
-        u8 shiny;
-        for (u8 j = 0; j < pidRolls; j++)
-        {
-            pid = rngList.next(rand);
+    return generateParallel<UndergroundState>(static_cast<u64>(maxAdvances) + 1, threads, [&](u64 start, u64 end) {
+        RNGList<u32, Xorshift, 256> rngList(seed0, seed1, initialAdvances + offset + start);
+        const PersonalInfo *base = PersonalLoader::getPersonal(profile.getVersion());
+        const auto &levelInfo = levelInfoList[levelFlag];
+        u8 pidRolls = diglett ? 2 : 1;
+
+        auto createPokemon = [=, &rngList](u32 advances, u16 specie) {
+            u8 level;
+            if (lead == Lead::Pressure)
+            {
+                level = levelInfo.max;
+            }
+            else
+            {
+                u8 range = levelInfo.max - levelInfo.min + 1;
+                level = levelInfo.min + rngList.next(range);
+            }
 
-            shiny = Utilities::getShiny<false>(pid, (sidtid >> 16) ^ (sidtid & 0xffff));
-            if (shiny) // Force shiny
+            u32 ec = rngList.next(rand);
+            u32 sidtid = rngList.next(rand);
+            u32 pid;
+            u8 shiny;
+            for (u8 j = 0; j < pidRolls; j++)
             {
-                if (Utilities::getShiny<false>(pid, tsv) != shiny)
+                pid = rngList.next(rand);
+
+                shiny = Utilities::getShiny<false>(pid, (sidtid >> 16) ^ (sidtid & 0xffff));
+                if (shiny) // Force shiny
                 {
-                    u16 high = (pid & 0xFFFF) ^ tsv ^ (2 - shiny);
-                    pid = (high << 16) | (pid & 0xFFFF);
+                    if (Utilities::getShiny<false>(pid, tsv) != shiny)
+                    {
+                        u16 high = (pid & 0xFFFF) ^ tsv ^ (2 - shiny);
+                        pid = (high << 16) | (pid & 0xFFFF);
+                    }
+                    break;
                 }
-                break;
-            }
-            else // Force non
-            {
-                if (Utilities::isShiny<false>(pid, tsv))
+                else // Force non
                 {
-                    pid ^= 0x10000000;
+                    if (Utilities::isShiny<false>(pid, tsv))
+                    {
+                        pid ^= 0x10000000;
+                    }
                 }
             }
-        }
 
-        std::array<u8, 6> ivs;
-        std::ranges::generate(ivs, [&rngList] { return rngList.next(rand) % 32; });
+            std::array<u8, 6> ivs;
+            std::ranges::generate(ivs, [&rngList] { return rngList.next(rand) % 32; });
 
-        u8 ability = rngList.next(rand) % 2;
+            u8 ability = rngList.next(rand) % 2;
 
-        const PersonalInfo *info = &base[specie];
+            const PersonalInfo *info = &base[specie];
 
-        u8 gender;
-        switch (info->getGender())
-        {
-        case 255:
-            gender = 2;
-            break;
-        case 254:
-            gender = 1;
-            break;
-        case 0:
-            gender = 0;
-            break;
-        default:
-            if ((lead == Lead::CuteCharmF || lead == Lead::CuteCharmM) && rngList.next(100) < 67)
+            u8 gender;
+            switch (info->getGender())
+            {
+            case 255:
+                gender = 2;
+                break;
+            case 254:
+                gender = 1;
+                break;
+            case 0:
+                gender = 0;
+                break;
+            default:
+                if ((lead == Lead::CuteCharmF || lead == Lead::CuteCharmM) && rngList.next(100) < 67)
+                {
+                    gender = lead == Lead::CuteCharmF ? 0 : 1;
+                }
+                else
+                {
+                    gender = (rngList.next(rand) % 253) + 1 < info->getGender();
+                }
+            }
+
+            u8 nature;
+            if (lead <= Lead::SynchronizeEnd)
             {
-                gender = lead == Lead::CuteCharmF ? 0 : 1;
+                nature = toInt(lead);
             }
             else
             {
-                gender = (rngList.next(rand) % 253) + 1 < info->getGender();
+                nature = rngList.next(rand) % 25;
             }
-        }
 
-        u8 nature;
-        if (lead <= Lead::SynchronizeEnd)
-        {
-            nature = toInt(lead);
-        }
-        else
-        {
-            nature = rngList.next(rand) % 25;
-        }
-
-        u8 height = rngList.next(rand) % 129;
-        height += rngList.next(rand) % 128;
+            u8 height = rngList.next(rand) % 129;
+            height += rngList.next(rand) % 128;
 
-        u8 weight = rngList.next(rand) % 129;
-        weight += rngList.next(rand) % 128;
+            u8 weight = rngList.next(rand) % 129;
+            weight += rngList.next(rand) % 128;
 
-        u16 item = getItem(rngList.next(100), lead, info);
+            u16 item = getItem(rngList.next(100), lead, info);
 
-        u16 eggMove = 0;
-        auto eggMoves = std::lower_bound(eggMoveList.begin(), eggMoveList.end(), info->getHatchSpecie(),
-                                         [](const EggMoveList &move, u16 specie) { return move.specie < specie; });
-        if (eggMoves != eggMoveList.end() && eggMoves->specie == info->getHatchSpecie())
-        {
-            eggMove = eggMoves->moves[rngList.next(eggMoves->count)];
-        }
+            u16 eggMove = 0;
+            auto eggMoves = std::lower_bound(eggMoveList.begin(), eggMoveList.end(), info->getHatchSpecie(),
+                                             [](const EggMoveList &move, u16 specie) { return move.specie < specie; });
+            if (eggMoves != eggMoveList.end() && eggMoves->specie == info->getHatchSpecie())
+            {
+                eggMove = eggMoves->moves[rngList.next(eggMoves->count)];
+            }
 
-        return UndergroundState(initialAdvances + advances, ec, pid, ivs, ability, gender, level, nature, shiny, height, weight, eggMove,
-                                item, specie, info);
-    };
+            return UndergroundState(initialAdvances + advances, ec, pid, ivs, ability, gender, level, nature, shiny, height, weight,
+                                    eggMove, item, specie, info);
+        };
 
-    std::vector<UndergroundState> states;
-    for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rngList.advanceState())
-    {
-        u8 spawnCount = area.getMin();
+        std::vector<UndergroundState> states;
+        for (u64 cnt = start; cnt < end; cnt++, rngList.advanceState())
+        {
+            u8 spawnCount = area.getMin();
 
-        u16 specialPokemon = area.getSpecialPokemon(rngList);
+            u16 specialPokemon = area.getSpecialPokemon(rngList);
 
-        if (rngList.next(100) >= 50)
-        {
-            spawnCount = area.getMax();
-        }
+            if (rngList.next(100) >= 50)
+            {
+                spawnCount = area.getMax();
+            }
 
-        if (specialPokemon != 0)
-        {
-            spawnCount -= 1;
-        }
+            if (specialPokemon != 0)
+            {
+                spawnCount -= 1;
+            }
 
-        auto slots = area.getSlots(rngList, spawnCount);
-        for (u8 i = 0; i < spawnCount; i++)
-        {
-            u16 pokemon = area.getPokemon(rngList, slots[i]);
-            UndergroundState state = createPokemon(cnt, pokemon);
-            if (filter.compareState(state))
+            auto slots = area.getSlots(rngList, spawnCount);
+            for (u8 i = 0; i < spawnCount; i++)
             {
-                states.emplace_back(state);
+                u16 pokemon = area.getPokemon(rngList, slots[i]);
+                UndergroundState state = createPokemon(cnt, pokemon);
+                if (filter.compareState(state))
+                {
+                    states.emplace_back(state);
+                }
             }
-        }
 
-        if (specialPokemon != 0)
-        {
-            UndergroundState state = createPokemon(cnt, specialPokemon);
-            if (filter.compareState(state))
+            if (specialPokemon != 0)
             {
-                states.emplace_back(state);
+                UndergroundState state = createPokemon(cnt, specialPokemon);
+                if (filter.compareState(state))
+                {
+                    states.emplace_back(state);
+                }
             }
         }
-    }
 
-    return states;
+        return states;
+    });
 }
@@ -52,10 +52,11 @@ public:
      *
      * @param seed0 Upper half of PRNG state
      * @param seed1 Lower half of PRNG state
+     * @param threads Number of threads to generate with
      *
      * @return Vector of computed states
      */
-    std::vector<UndergroundState> generate(u64 seed0, u64 seed1) const;
+    std::vector<UndergroundState> generate(u64 seed0, u64 seed1, int threads = 1) const;
 
 private:
     bool diglett;
@@ -26,6 +26,7 @@
 #include <Core/RNG/RNGList.hpp>
 #include <Core/RNG/Xorshift.hpp>
 #include <Core/Util/EncounterSlot.hpp>
+#include <Core/Util/Parallel.hpp>
 #include <Core/Util/Utilities.hpp>
 #include <algorithm>
 
@@ -64,250 +65,255 @@ WildGenerator8::WildGenerator8(u32 initialAdvances, u32 maxAdvances, u32 offset,
 {
 }
 
-std::vector<WildState8> WildGenerator8::generate(u64 seed0, u64 seed1, u8 index) const
+std::vector<WildState8> WildGenerator8::generate(u64 seed0, u64 seed1, u8 index, int threads) const
 {
     switch (method)
     {
     case Method::None:
-        return generateWild(seed0, seed1);
+        return generateWild(seed0, seed1, threads);
     case Method::HoneyTree:
-        return generateHoneyTree(seed0, seed1, index);
+        return generateHoneyTree(seed0, seed1, index, threads);
     default:
         return std::vector<WildState8>();
     }
 }
 
-std::vector<WildState8> WildGenerator8::generateWild(u64 seed0, u64 seed1) const
+std::vector<WildState8> WildGenerator8::generateWild(u64 seed0, u64 seed1, int threads) const
 {
-    RNGList<u32, Xorshift, 128> rngList(seed0, seed1, initialAdvances + offset);
+    return generateParallel<WildState8>(static_cast<u64>(maxAdvances) + 1, threads, [&](u64 start, u64 end) {
+        RNGList<u32, Xorshift, 128> rngList(seed0, seed1, initialAdvances + offset + start);
 
-    bool encounterForce = lead >= Lead::MagnetPull && lead <= Lead::StormDrain;
-    auto modifiedSlots = area.getSlots(lead);
-    bool feebas = area.feebasLocation(profile.getVersion()) && feebasTile;
+        bool encounterForce = lead >= Lead::MagnetPull && lead <= Lead::StormDrain;
+        auto modifiedSlots = area.getSlots(lead);
+        bool feebas = area.feebasLocation(profile.getVersion()) && feebasTile;
+        const auto &slotTable = EncounterSlot::bdspTable(area.getEncounter());
 
-    std::vector<WildState8> states;
-    for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rngList.advanceState())
-    {
-        u8 encounterSlot;
-        if (feebas && rngList.next(2))
-        {
-            encounterSlot = 5;
-            rngList.advance(encounterForce ? 2 : 1);
-        }
-        else if (encounterForce && rngList.next(2) == 0 && !modifiedSlots.empty())
-        {
-            encounterSlot = modifiedSlots[rngList.next(modifiedSlots.count)];
-        }
-        else
+        std::vector<WildState8> states;
+        for (u64 cnt = start; cnt < end; cnt++, rngList.advanceState())
         {
-            encounterSlot = EncounterSlot::bdspSlot(rngList.next(100), area.getEncounter());
-        }
+            u8 encounterSlot;
+            if (feebas && rngList.next(2))
+            {
+                encounterSlot = 5;
+                rngList.advance(encounterForce ? 2 : 1);
+            }
+            else if (encounterForce && rngList.next(2) == 0 && !modifiedSlots.empty())
+            {
+                encounterSlot = modifiedSlots[rngList.next(modifiedSlots.count)];
+            }
+            else
+            {
+                encounterSlot = slotTable[rngList.next(100)];
+            }
 
-        if (!filter.compareEncounterSlot(encounterSlot))
-        {
-            continue;
-        }
+            if (!filter.compareEncounterSlot(encounterSlot))
+            {
+                continue;
+            }
 
-        u8 level;
-        if (area.getEncounter() == Encounter::Grass)
-        {
-            level = area.calculateLevel<false>(encounterSlot, rngList, lead == Lead::Pressure);
-        }
-        else
-        {
-            level = area.calculateLevel<true>(encounterSlot, rngList, lead == Lead::Pressure);
-        }
+            u8 level;
+            if (area.getEncounter() == Encounter::Grass)
+            {
+                level = area.calculateLevel<false>(encounterSlot, rngList, lead == Lead::Pressure);
+            }
+            else
+            {
+                level = area.calculateLevel<true>(encounterSlot, rngList, lead == Lead::Pressure);
+            }
 
-        const Slot &slot = area.getPokemon(encounterSlot);
-        const PersonalInfo *info = slot.getInfo();
+            const Slot &slot = area.getPokemon(encounterSlot);
+            const PersonalInfo *info = slot.getInfo();
 
-        bool cuteCharm = false;
-        if ((lead == Lead::CuteCharmF || lead == Lead::CuteCharmM) && !info->getFixedGender())
-        {
-            cuteCharm = rngList.next(3) != 0;
-        }
+            bool cuteCharm = false;
+            if ((lead == Lead::CuteCharmF || lead == Lead::CuteCharmM) && !info->getFixedGender())
+            {
+                cuteCharm = rngList.next(3) != 0;
+            }
 
-        u8 form = 0;
-        if (slot.getSpecie() == 201)
-        {
-            form = area.unownForm(rngList.next());
-        }
+            u8 form = 0;
+            if (slot.getSpecie() == 201)
+            {
+                form = area.unownForm(rngList.next());
+            }
 
-        rngList.advance(84);
+            rngList.advance(84);
 
-        u32 ec = rngList.next(rand);
-        u32 sidtid = rngList.next(rand);
-        u32 pid = rngList.next(rand);
+            u32 ec = rngList.next(rand);
+            u32 sidtid = rngList.next(rand);
+            u32 pid = rngList.next(rand);
 
-        u8 shiny = Utilities::getShiny<false>(pid, (sidtid >> 16) ^ (sidtid & 0xffff));
-        if (shiny) // Force shiny
-        {
-            if (Utilities::getShiny<false>(pid, tsv) != shiny)
+            u8 shiny = Utilities::getShiny<false>(pid, (sidtid >> 16) ^ (sidtid & 0xffff));
+            if (shiny) // Force shiny
             {
-                u16 high = (pid & 0xFFFF) ^ tsv ^ (2 - shiny);
-                pid = (high << 16) | (pid & 0xFFFF);
+                if (Utilities::getShiny<false>(pid, tsv) != shiny)
+                {
+                    u16 high = (pid & 0xFFFF) ^ tsv ^ (2 - shiny);
+                    pid = (high << 16) | (pid & 0xFFFF);
+                }
             }
-        }
-        else
-        {
-            if (Utilities::isShiny<false>(pid, tsv)) // Force non shiny
+            else
             {
-                pid ^= 0x10000000;
+                if (Utilities::isShiny<false>(pid, tsv)) // Force non shiny
+                {
+                    pid ^= 0x10000000;
+                }
             }
-        }
 
-        std::array<u8, 6> ivs;
-        std::ranges::generate(ivs, [&rngList] { return rngList.next(rand) % 32; });
+            std::array<u8, 6> ivs;
+            std::ranges::generate(ivs, [&rngList] { return rngList.next(rand) % 32; });
 
-        u8 ability = rngList.next(rand) % 2;
+            u8 ability = rngList.next(rand) % 2;
 
-        u8 gender;
-        switch (info->getGender())
-        {
-        case 255:
-            gender = 2;
-            break;
-        case 254:
-            gender = 1;
-            break;
-        case 0:
-            gender = 0;
-            break;
-        default:
-            if (cuteCharm)
+            u8 gender;
+            switch (info->getGender())
+            {
+            case 255:
+                gender = 2;
+                break;
+            case 254:
+                gender = 1;
+                break;
+            case 0:
+                gender = 0;
+                break;
+            default:
+                if (cuteCharm)
+                {
+                    gender = lead == Lead::CuteCharmF ? 0 : 1;
+                }
+                else
+                {
+                    gender = (rngList.next(rand) % 253) + 1 < info->getGender();
+                }
+                break;
+            }
+
+            u8 nature;
+            if (lead <= Lead::SynchronizeEnd)
             {
-                gender = lead == Lead::CuteCharmF ? 0 : 1;
+                nature = toInt(lead);
             }
             else
             {
-                gender = (rngList.next(rand) % 253) + 1 < info->getGender();
+                nature = rngList.next(rand) % 25;
             }
-            break;
-        }
-
-        u8 nature;
-        if (lead <= Lead::SynchronizeEnd)
-        {
-            nature = toInt(lead);
-        }
-        else
-        {
-            nature = rngList.next(rand) % 25;
-        }
 
-        u8 height = rngList.next(rand) % 129;
-        height += rngList.next(rand) % 128;
+            u8 height = rngList.next(rand) % 129;
+            height += rngList.next(rand) % 128;
 
-        u8 weight = rngList.next(rand) % 129;
-        weight += rngList.next(rand) % 128;
+            u8 weight = rngList.next(rand) % 129;
+            weight += rngList.next(rand) % 128;
 
-        u16 item = getItem(rngList.next(100), lead, info);
+            u16 item = getItem(rngList.next(100), lead, info);
 
-        WildState8 state(initialAdvances + cnt, ec, pid, ivs, ability, gender, level, nature, shiny, encounterSlot, item, slot.getSpecie(),
-                         form, height, weight, info);
-        if (filter.compareState(state))
-        {
-            states.emplace_back(state);
+            WildState8 state(initialAdvances + cnt, ec, pid, ivs, ability, gender, level, nature, shiny, encounterSlot, item,
+                             slot.getSpecie(), form, height, weight, info);
+            if (filter.compareState(state))
+            {
+                states.emplace_back(state);
+            }
         }
-    }
 
-    return states;
+        return states;
+    });
 }
 
-std::vector<WildState8> WildGenerator8::generateHoneyTree(u64 seed0, u64 seed1, u8 index) const
+std::vector<WildState8> WildGenerator8::generateHoneyTree(u64 seed0, u64 seed1, u8 index, int threads) const
 {
-    RNGList<u32, Xorshift, 128> rngList(seed0, seed1, initialAdvances + offset);
+    return generateParallel<WildState8>(static_cast<u64>(maxAdvances) + 1, threads, [&](u64 start, u64 end) {
+        RNGList<u32, Xorshift, 128> rngList(seed0, seed1, initialAdvances + offset + start);
 
-    std::vector<WildState8> states;
-    for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rngList.advanceState())
-    {
-        const Slot &slot = area.getPokemon(index);
+        std::vector<WildState8> states;
+        for (u64 cnt = start; cnt < end; cnt++, rngList.advanceState())
+        {
+            const Slot &slot = area.getPokemon(index);
 
-        u8 level = area.calculateLevel<true>(index, rngList, false);
+            u8 level = area.calculateLevel<true>(index, rngList, false);
 
-        const PersonalInfo *info = slot.getInfo();
+            const PersonalInfo *info = slot.getInfo();
 
-        bool cuteCharm = false;
-        if ((lead == Lead::CuteCharmF || lead == Lead::CuteCharmM) && !info->getFixedGender())
-        {
-            cuteCharm = rngList.next(3) != 0;
-        }
+            bool cuteCharm = false;
+            if ((lead == Lead::CuteCharmF || lead == Lead::CuteCharmM) && !info->getFixedGender())
+            {
+                cuteCharm = rngList.next(3) != 0;
+            }
 
-        rngList.advance(84);
+            rngList.advance(84);
 
-        u32 ec = rngList.next(rand);
-        u32 sidtid = rngList.next(rand);
-        u32 pid = rngList.next(rand);
+            u32 ec = rngList.next(rand);
+            u32 sidtid = rngList.next(rand);
+            u32 pid = rngList.next(rand);
 
-        u8 shiny = Utilities::getShiny<false>(pid, (sidtid >> 16) ^ (sidtid & 0xffff));
-        if (shiny) // Force shiny
-        {
-            if (Utilities::getShiny<false>(pid, tsv) != shiny)
+            u8 shiny = Utilities::getShiny<false>(pid, (sidtid >> 16) ^ (sidtid & 0xffff));
+            if (shiny) // Force shiny
             {
-                u16 high = (pid & 0xFFFF) ^ tsv ^ (2 - shiny);
-                pid = (high << 16) | (pid & 0xFFFF);
+                if (Utilities::getShiny<false>(pid, tsv) != shiny)
+                {
+                    u16 high = (pid & 0xFFFF) ^ tsv ^ (2 - shiny);
+                    pid = (high << 16) | (pid & 0xFFFF);
+                }
             }
-        }
-        else
-        {
-            if (Utilities::isShiny<false>(pid, tsv)) // Force non shiny
+            else
             {
-                pid ^= 0x10000000;
+                if (Utilities::isShiny<false>(pid, tsv)) // Force non shiny
+                {
+                    pid ^= 0x10000000;
+                }
             }
-        }
 
-        std::array<u8, 6> ivs;
-        std::ranges::generate(ivs, [&rngList] { return rngList.next(rand) % 32; });
+            std::array<u8, 6> ivs;
+            std::ranges::generate(ivs, [&rngList] { return rngList.next(rand) % 32; });
 
-        u8 ability = rngList.next(rand) % 2;
+            u8 ability = rngList.next(rand) % 2;
 
-        u8 gender;
-        switch (info->getGender())
-        {
-        case 255:
-            gender = 2;
-            break;
-        case 254:
-            gender = 1;
-            break;
-        case 0:
-            gender = 0;
-            break;
-        default:
-            if (cuteCharm)
+            u8 gender;
+            switch (info->getGender())
             {
-                gender = lead == Lead::CuteCharmF ? 0 : 1;
+            case 255:
+                gender = 2;
+                break;
+            case 254:
+                gender = 1;
+                break;
+            case 0:
+                gender = 0;
+                break;
+            default:
+                if (cuteCharm)
+                {
+                    gender = lead == Lead::CuteCharmF ? 0 : 1;
+                }
+                else
+                {
+                    gender = (rngList.next(rand) % 253) + 1 < info->getGender();
+                }
+                break;
+            }
+
+            u8 nature;
+            if (lead <= Lead::SynchronizeEnd)
+            {
+                nature = toInt(lead);
             }
             else
             {
-                gender = (rngList.next(rand) % 253) + 1 < info->getGender();
+                nature = rngList.next(rand) % 25;
             }
-            break;
-        }
 
-        u8 nature;
-        if (lead <= Lead::SynchronizeEnd)
-        {
-            nature = toInt(lead);
-        }
-        else
-        {
-            nature = rngList.next(rand) % 25;
-        }
+            u8 height = rngList.next(rand) % 129;
+            height += rngList.next(rand) % 128;
 
-        u8 height = rngList.next(rand) % 129;
-        height += rngList.next(rand) % 128;
+            u8 weight = rngList.next(rand) % 129;
+            weight += rngList.next(rand) % 128;
 
-        u8 weight = rngList.next(rand) % 129;
-        weight += rngList.next(rand) % 128;
-
-        WildState8 state(initialAdvances + cnt, ec, pid, ivs, ability, gender, level, nature, shiny, index, info->getItem(0),
-                         slot.getSpecie(), 0, height, weight, info);
-        if (filter.compareState(state))
-        {
-            states.emplace_back(state);
+            WildState8 state(initialAdvances + cnt, ec, pid, ivs, ability, gender, level, nature, shiny, index, info->getItem(0),
+                             slot.getSpecie(), 0, height, weight, info);
+            if (filter.compareState(state))
+            {
+                states.emplace_back(state);
+            }
         }
-    }
 
-    return states;
+        return states;
+    });
 }
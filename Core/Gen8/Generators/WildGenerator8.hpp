@@ -55,20 +55,22 @@ public:
      * @param seed0 Upper half of PRNG state
      * @param seed1 Lower half of PRNG state
      * @param index Honey Tree slot index
+     * @param threads Number of threads to generate with
      *
      * @return Vector of computed states
      */
-    std::vector<WildState8> generate(u64 seed0, u64 seed1, u8 index) const;
+    std::vector<WildState8> generate(u64 seed0, u64 seed1, u8 index, int threads = 1) const;
 
     /**
      * @brief Generates states via Wild
      *
      * @param seed0 Upper half of PRNG state
      * @param seed1 Lower half of PRNG state
+     * @param threads Number of threads to generate with
      *
      * @return Vector of computed states
      */
-    std::vector<WildState8> generateWild(u64 seed0, u64 seed1) const;
+    std::vector<WildState8> generateWild(u64 seed0, u64 seed1, int threads = 1) const;
 
     /**
      * @brief Generates states via Honey Tree
@@ -76,10 +78,11 @@ public:
      * @param seed0 Upper half of PRNG state
      * @param seed1 Lower half of PRNG state
      * @param index Honey Tree slot index
+     * @param threads Number of threads to generate with
      *
      * @return Vector of computed states
      */
-    std::vector<WildState8> generateHoneyTree(u64 seed0, u64 seed1, u8 index) const;
+    std::vector<WildState8> generateHoneyTree(u64 seed0, u64 seed1, u8 index, int threads = 1) const;
 
 private:
     bool feebasTile;
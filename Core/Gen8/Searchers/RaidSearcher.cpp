@@ -0,0 +1,315 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "RaidSearcher.hpp"
+#include <Core/RNG/Xoroshiro.hpp>
+#include <algorithm>
+#include <bit>
+#include <thread>
+
+constexpr u64 XOROSHIRO_CONSTANT = 0x82A2B175229D6A5B;
+
+/**
+ * @brief Bit of the PRNG state as an affine function of the upper 32 bits of the seed
+ */
+struct Form
+{
+    u32 mask;
+    u8 value;
+};
+
+/**
+ * @brief Linear system over the upper 32 bits of the seed in row echelon form. Row c has its lowest set bit at c.
+ */
+struct System
+{
+    std::array<u32, 32> rows;
+    u32 rhs;
+    u32 used;
+
+    /**
+     * @brief Substitutes the known variables into the \p mask and \p value
+     *
+     * @return true Result no longer depends on a free variable
+     * @return false Result depends on a free variable
+     */
+    bool reduce(u32 &mask, u8 &value) const
+    {
+        while (mask)
+        {
+            int column = std::countr_zero(mask);
+            if (!((used >> column) & 1))
+            {
+                return false;
+            }
+            mask ^= rows[column];
+            value ^= (rhs >> column) & 1;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Adds the equation \p mask = \p value
+     *
+     * @return true System is still consistent
+     * @return false System is contradictory
+     */
+    bool add(u32 mask, u8 value)
+    {
+        if (reduce(mask, value))
+        {
+            return value == 0;
+        }
+
+        int column = std::countr_zero(mask);
+        rows[column] = mask;
+        rhs |= static_cast<u32>(value) << column;
+        used |= 1u << column;
+        return true;
+    }
+};
+
+/**
+ * @brief Checks if the \p state is the observed raid pokemon
+ *
+ * @param observation Observed raid pokemon
+ * @param state Generated state
+ *
+ * @return true State matches the observation
+ * @return false State does not match the observation
+ */
+static bool matches(const RaidObservation &observation, const State8 &state)
+{
+    if (state.getAdvances() != observation.advances || state.getEC() != observation.ec || state.getPID() != observation.pid
+        || (observation.nature != 255 && state.getNature() != observation.nature))
+    {
+        return false;
+    }
+
+    for (int i = 0; i < 6; i++)
+    {
+        if (observation.ivs[i] != 255 && state.getIV(i) != observation.ivs[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void step(u64 &s0, u64 &s1)
+{
+    s1 ^= s0;
+    s0 = std::rotl(s0, 24) ^ s1 ^ (s1 << 16);
+    s1 = std::rotl(s1, 37);
+}
+
+/**
+ * @brief Solves the PID bits from the lowest up. Bit i of the sum is a linear equation once the carry into it is known, and the carry
+ * out of it only needs a guess when both addends are equal.
+ */
+static void solve(System system, const std::array<Form, 16> &s0, const std::array<Form, 16> &s1, u16 pid, int bit, u8 carry,
+                  std::vector<u32> &results)
+{
+    if (bit == 16)
+    {
+        u32 free = ~system.used;
+        u32 assignment = 0;
+        do
+        {
+            u32 high = assignment;
+            for (int column = 31; column >= 0; column--)
+            {
+                if ((system.used >> column) & 1)
+                {
+                    high |= (((system.rhs >> column) & 1) ^ (std::popcount(system.rows[column] & high) & 1)) << column;
+                }
+            }
+            results.emplace_back(high);
+            assignment = (assignment - free) & free;
+        } while (assignment);
+        return;
+    }
+
+    u8 sum = (pid >> bit) & 1;
+    if (!system.add(s0[bit].mask ^ s1[bit].mask, sum ^ carry ^ s0[bit].value ^ s1[bit].value))
+    {
+        return;
+    }
+
+    if (sum ^ carry)
+    {
+        solve(system, s0, s1, pid, bit + 1, carry, results);
+        return;
+    }
+
+    // Both addends are equal, so the carry out is their value
+    u32 mask = s0[bit].mask;
+    u8 value = s0[bit].value;
+    if (system.reduce(mask, value))
+    {
+        solve(system, s0, s1, pid, bit + 1, value, results);
+    }
+    else
+    {
+        for (u8 guess = 0; guess < 2; guess++)
+        {
+            System branch = system;
+            branch.add(mask, guess ^ value);
+            solve(branch, s0, s1, pid, bit + 1, guess, results);
+        }
+    }
+}
+
+RaidSearcher::RaidSearcher(const std::vector<RaidObservation> &observations, u8 level, const Raid &raid, const RaidGenerator &generator) :
+    SearcherBase(), generator(generator), observations(observations), raid(raid), level(level)
+{
+    if (observations.empty())
+    {
+        return;
+    }
+
+    const RaidObservation &first = observations[0];
+    u32 low = first.ec - static_cast<u32>(XOROSHIRO_CONSTANT) * (first.advances + 1);
+    for (const auto &observation : observations)
+    {
+        if (observation.ec - static_cast<u32>(XOROSHIRO_CONSTANT) * (observation.advances + 1) != low)
+        {
+            return;
+        }
+    }
+
+    // Low half of the seed at the first observation. The PID comes from the state after two steps.
+    u32 base = first.ec - static_cast<u32>(XOROSHIRO_CONSTANT);
+    auto state = [base](u32 high) {
+        u64 s0 = (static_cast<u64>(high) << 32) | base;
+        u64 s1 = XOROSHIRO_CONSTANT;
+        step(s0, s1);
+        step(s0, s1);
+        return std::array<u64, 2> { s0, s1 };
+    };
+
+    std::array<Form, 16> s0;
+    std::array<Form, 16> s1;
+    auto constant = state(0);
+    for (int bit = 0; bit < 16; bit++)
+    {
+        s0[bit] = { 0, static_cast<u8>((constant[0] >> bit) & 1) };
+        s1[bit] = { 0, static_cast<u8>((constant[1] >> bit) & 1) };
+    }
+
+    for (int i = 0; i < 32; i++)
+    {
+        auto basis = state(1u << i);
+        for (int bit = 0; bit < 16; bit++)
+        {
+            s0[bit].mask |= static_cast<u32>(((basis[0] ^ constant[0]) >> bit) & 1) << i;
+            s1[bit].mask |= static_cast<u32>(((basis[1] ^ constant[1]) >> bit) & 1) << i;
+        }
+    }
+
+    std::vector<u32> highs;
+    solve(System {}, s0, s1, first.pid & 0xffff, 0, 0, highs);
+
+    candidates.reserve(highs.size());
+    for (u32 high : highs)
+    {
+        u64 seed = (static_cast<u64>(high) << 32) | base;
+        candidates.emplace_back(seed - XOROSHIRO_CONSTANT * first.advances);
+    }
+}
+
+void RaidSearcher::startSearch(int threads)
+{
+    searching = true;
+
+    if (candidates.empty())
+    {
+        return;
+    }
+
+    threads = static_cast<int>(std::clamp<size_t>(candidates.size(), 1, std::max(threads, 1)));
+
+    auto *threadContainer = new std::thread[threads];
+
+    size_t split = candidates.size() / threads;
+    size_t start = 0;
+    for (int i = 0; i < threads; i++, start += split)
+    {
+        size_t end = i == threads - 1 ? candidates.size() : start + split;
+        threadContainer[i] = std::thread([=] { search(start, end); });
+    }
+
+    for (int i = 0; i < threads; i++)
+    {
+        threadContainer[i].join();
+    }
+
+    delete[] threadContainer;
+}
+
+void RaidSearcher::search(size_t start, size_t end)
+{
+    for (size_t i = start; i < end; i++, progress++)
+    {
+        if (!searching)
+        {
+            return;
+        }
+
+        u64 seed = candidates[i];
+
+        // Cheap check of the other observations before running the generator
+        bool valid = true;
+        for (size_t j = 1; j < observations.size() && valid; j++)
+        {
+            Xoroshiro rng(seed + XOROSHIRO_CONSTANT * observations[j].advances);
+            rng.next();
+            rng.next();
+            valid = (rng.next() & 0xffff) == (observations[j].pid & 0xffff);
+        }
+
+        if (!valid)
+        {
+            continue;
+        }
+
+        auto states = generator.generate(seed, level, raid);
+
+        // Only keep the states that are one of the observations
+        std::vector<State8> targets;
+        for (const auto &observation : observations)
+        {
+            auto it = std::ranges::find_if(states, [&observation](const State8 &state) { return matches(observation, state); });
+            if (it == states.end())
+            {
+                break;
+            }
+            targets.emplace_back(*it);
+        }
+
+        if (targets.size() == observations.size())
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (const auto &state : targets)
+            {
+                results.emplace_back(seed, XOROSHIRO_CONSTANT, state);
+            }
+        }
+    }
+}
@@ -0,0 +1,94 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef RAIDSEARCHER_HPP
+#define RAIDSEARCHER_HPP
+
+#include <Core/Gen8/Generators/RaidGenerator.hpp>
+#include <Core/Gen8/Raid.hpp>
+#include <Core/Gen8/States/SearcherState8.hpp>
+#include <Core/Gen8/States/State8.hpp>
+#include <Core/Parents/Searchers/SearcherBase.hpp>
+
+/**
+ * @brief Observed raid pokemon. IVs and nature of 255 are unknown and not compared.
+ */
+struct RaidObservation
+{
+    u32 advances;
+    u32 ec;
+    u32 pid;
+    std::array<u8, 6> ivs = { 255, 255, 255, 255, 255, 255 };
+    u8 nature = 255;
+};
+
+/**
+ * @brief Den seed searcher for SwSh raids.
+ *
+ * The EC is the low half of the first output which directly gives the lower 32 bits of the den seed. The low 16 bits of the PID are
+ * never altered by shiny locking, so they are solved bit by bit for the upper 32 bits over GF(2) while guessing the addition carries.
+ * Every remaining candidate is validated through the RaidGenerator against the EC, PID, IVs and nature of each observation.
+ */
+class RaidSearcher final : public SearcherBase<SearcherState8<State8>>
+{
+public:
+    /**
+     * @brief Construct a new RaidSearcher object
+     *
+     * @param observations Observed raid pokemon. Advances are relative to the den seed being searched for
+     * @param level Raid level
+     * @param raid Raid template
+     * @param generator State generator. Expected to start from advance 0 and to cover the advances of every observation
+     */
+    RaidSearcher(const std::vector<RaidObservation> &observations, u8 level, const Raid &raid, const RaidGenerator &generator);
+
+    /**
+     * @brief Computes max progress
+     *
+     * @return Max progress
+     */
+    u64 getMaxProgress() const
+    {
+        return candidates.size();
+    }
+
+    /**
+     * @brief Starts the search
+     *
+     * @param threads Numbers of threads to search with
+     */
+    void startSearch(int threads);
+
+private:
+    RaidGenerator generator;
+    std::vector<RaidObservation> observations;
+    std::vector<u64> candidates;
+    Raid raid;
+    u8 level;
+
+    /**
+     * @brief Validates the candidate seeds between \p start and \p end
+     *
+     * @param start Start index
+     * @param end End index
+     */
+    void search(size_t start, size_t end);
+};
+
+#endif // RAIDSEARCHER_HPP
@@ -0,0 +1,135 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SEARCHER8_HPP
+#define SEARCHER8_HPP
+
+#include <Core/Gen8/States/SearcherState8.hpp>
+#include <Core/Parents/Searchers/SearcherBase.hpp>
+#include <Core/RNG/XorshiftReverse.hpp>
+#include <algorithm>
+#include <thread>
+#include <tuple>
+
+/**
+ * @brief Searcher class for the Xorshift based Gen 8 generators.
+ * Recovers every PRNG state that agrees with the observations and runs the generator from each of them.
+ *
+ * @tparam Generator Generator class to use
+ * @tparam State State class to use
+ * @tparam Args Additional arguments passed to the generator after the seeds
+ */
+template <class Generator, class State, class... Args>
+class Searcher8 : public SearcherBase<SearcherState8<State>>
+{
+public:
+    /**
+     * @brief Construct a new Searcher8 object
+     *
+     * @param observations Known output bits of the PRNG
+     * @param generator State generator
+     * @param args Additional generator arguments
+     */
+    Searcher8(const std::vector<XorshiftObservation> &observations, const Generator &generator, Args... args) :
+        SearcherBase<SearcherState8<State>>(), generator(generator), reverse(observations), args(args...)
+    {
+    }
+
+    /**
+     * @brief Computes max progress
+     *
+     * @return Max progress
+     */
+    u64 getMaxProgress() const
+    {
+        return reverse.getSolutionCount();
+    }
+
+    /**
+     * @brief Starts the search
+     *
+     * @param threads Numbers of threads to search with
+     */
+    void startSearch(int threads)
+    {
+        this->searching = true;
+
+        u64 count = reverse.getSolutionCount();
+        if (count == 0)
+        {
+            return;
+        }
+
+        threads = static_cast<int>(std::clamp<u64>(count, 1, std::max(threads, 1)));
+
+        auto *threadContainer = new std::thread[threads];
+
+        u64 split = count / threads;
+        u64 start = 0;
+        for (int i = 0; i < threads; i++, start += split)
+        {
+            u64 end = i == threads - 1 ? count : start + split;
+            threadContainer[i] = std::thread([=] { search(start, end); });
+        }
+
+        for (int i = 0; i < threads; i++)
+        {
+            threadContainer[i].join();
+        }
+
+        delete[] threadContainer;
+    }
+
+private:
+    Generator generator;
+    XorshiftReverse reverse;
+    std::tuple<Args...> args;
+
+    /**
+     * @brief Searches between the \p start and \p end solution indexes
+     *
+     * @param start Start index
+     * @param end End index
+     */
+    void search(u64 start, u64 end)
+    {
+        for (u64 i = start; i < end; i++)
+        {
+            if (!this->searching)
+            {
+                return;
+            }
+
+            auto seeds = reverse.getSolution(i);
+            auto states = std::apply([&](auto... extra) { return generator.generate(seeds[0], seeds[1], extra...); }, args);
+            if (!states.empty())
+            {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                this->results.reserve(this->results.capacity() + states.size());
+                for (const auto &state : states)
+                {
+                    this->results.emplace_back(seeds[0], seeds[1], state);
+                }
+            }
+            this->progress++;
+        }
+    }
+};
+
+#endif // SEARCHER8_HPP
@@ -0,0 +1,81 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SEARCHERSTATE8_HPP
+#define SEARCHERSTATE8_HPP
+
+#include <Core/Global.hpp>
+
+/**
+ * @brief Provides the recovered PRNG state that hits a state in Gen 8
+ *
+ * @tparam StateType Interal state type
+ */
+template <class StateType>
+class SearcherState8
+{
+public:
+    /**
+     * @brief Construct a new SearcherState8 object
+     *
+     * @param seed0 Upper half of PRNG state
+     * @param seed1 Lower half of PRNG state
+     * @param state Internal state
+     */
+    SearcherState8(u64 seed0, u64 seed1, const StateType &state) : seed0(seed0), seed1(seed1), state(state)
+    {
+    }
+
+    /**
+     * @brief Returns the upper half of the PRNG state
+     *
+     * @return Upper half of PRNG state
+     */
+    u64 getSeed0() const
+    {
+        return seed0;
+    }
+
+    /**
+     * @brief Returns the lower half of the PRNG state
+     *
+     * @return Lower half of PRNG state
+     */
+    u64 getSeed1() const
+    {
+        return seed1;
+    }
+
+    /**
+     * @brief Returns the interal state
+     *
+     * @return Internal state
+     */
+    const StateType &getState() const
+    {
+        return state;
+    }
+
+private:
+    u64 seed0;
+    u64 seed1;
+    StateType state;
+};
+
+#endif // SEARCHERSTATE8_HPP
@@ -0,0 +1,48 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef FILTERMASK_HPP
+#define FILTERMASK_HPP
+
+#include <Core/Global.hpp>
+#include <array>
+#include <cstddef>
+
+/**
+ * @brief Compiles a table of flags into a bitmask
+ *
+ * @tparam size Number of table entries
+ * @param table Which values are kept
+ *
+ * @return Bitmask with bit i set when entry i is kept
+ */
+template <size_t size>
+constexpr u32 compileMask(const std::array<bool, size> &table)
+{
+    static_assert(size <= 32, "Table does not fit in the mask");
+
+    u32 mask = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        mask |= static_cast<u32>(table[i]) << i;
+    }
+    return mask;
+}
+
+#endif // FILTERMASK_HPP
@@ -19,6 +19,7 @@
 
 #include "IDFilter.hpp"
 #include <Core/Gen8/States/IDState8.hpp>
+#include <Core/Util/Checkpoint.hpp>
 #include <algorithm>
 
 IDFilter::IDFilter(const std::vector<u16> &tidFilter, const std::vector<u16> &sidFilter,
@@ -85,3 +86,8 @@ bool IDFilter::compareState(const IDState8 &state) const
 
     return true;
 }
+
+u64 IDFilter::hash() const
+{
+    return Checkpoint::hash(displayFilter, tidSIDFilter, tidTSVFilter, sidFilter, tidFilter, tsvFilter);
+}
@@ -66,6 +66,13 @@ public:
      */
     bool compareState(const IDState8 &state) const;
 
+    /**
+     * @brief Computes a hash of the filter values
+     *
+     * @return Filter hash
+     */
+    u64 hash() const;
+
 protected:
     std::vector<u32> displayFilter;
     std::vector<std::pair<u16, u16>> tidSIDFilter;
@@ -18,20 +18,116 @@
  */
 
 #include "StateFilter.hpp"
-#include <algorithm>
-#include <Core/Parents/States/WildState.hpp>
 #include <Core/Gen8/States/State8.hpp>
 #include <Core/Gen8/States/WildState8.hpp>
+#include <Core/Parents/Filters/FilterMask.hpp>
+#include <Core/Parents/States/StateBatch.hpp>
+#include <Core/Parents/States/WildState.hpp>
+#include <Core/RNG/SIMD.hpp>
 #include <algorithm>
+#include <cstring>
+
+constexpr u64 top = 0x8080808080808080;
+
+/**
+ * @brief Packs IVs or IV bounds one per byte. Values are clamped below 0x80 which keeps every IV on the same side of the bound.
+ *
+ * @param ivs Values to pack
+ *
+ * @return Packed values
+ */
+static u64 packIVs(const std::array<u8, 6> &ivs)
+{
+    std::array<u8, 8> bytes = {};
+    for (int i = 0; i < 6; i++)
+    {
+        bytes[i] = std::min<u8>(ivs[i], 0x7f);
+    }
+
+    u64 packed;
+    std::memcpy(&packed, bytes.data(), sizeof(packed));
+    return packed;
+}
+
+/**
+ * @brief Checks all packed IVs against the packed bounds at once. With the top bit of each byte set beforehand a subtraction only
+ * clears it when the byte borrows, that is when the IV is below the minimum or above the maximum.
+ *
+ * @param ivs Packed IVs
+ * @param low Packed minimum IVs
+ * @param high Packed maximum IVs
+ *
+ * @return true IVs are inside the bounds
+ * @return false IVs are not inside the bounds
+ */
+static bool compareIVs(u64 ivs, u64 low, u64 high)
+{
+    return (((ivs | top) - low) & ((high | top) - ivs) & top) == top;
+}
+
+/**
+ * @brief Clears the keep flag of every row whose \p column value is outside of [\p min, \p max]
+ *
+ * @param keep Keep flag of each row, 0xff when kept
+ * @param column Column values
+ * @param min Minimum value
+ * @param max Maximum value
+ */
+static void keepRange(std::vector<u8> &keep, const std::vector<u8> &column, u8 min, u8 max)
+{
+    size_t i = 0;
+#if defined(SIMD_X86)
+    __m128i low = _mm_set1_epi8(static_cast<char>(min));
+    __m128i high = _mm_set1_epi8(static_cast<char>(max));
+    for (; i + 16 <= column.size(); i += 16)
+    {
+        __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(column.data() + i));
+        __m128i inside = _mm_and_si128(_mm_cmpeq_epi8(_mm_max_epu8(value, low), value), _mm_cmpeq_epi8(_mm_min_epu8(value, high), value));
+        __m128i flags = _mm_loadu_si128(reinterpret_cast<const __m128i *>(keep.data() + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(keep.data() + i), _mm_and_si128(flags, inside));
+    }
+#elif defined(SIMD_ARM)
+    uint8x16_t low = vdupq_n_u8(min);
+    uint8x16_t high = vdupq_n_u8(max);
+    for (; i + 16 <= column.size(); i += 16)
+    {
+        uint8x16_t value = vld1q_u8(column.data() + i);
+        uint8x16_t inside = vandq_u8(vcgeq_u8(value, low), vcleq_u8(value, high));
+        vst1q_u8(keep.data() + i, vandq_u8(vld1q_u8(keep.data() + i), inside));
+    }
+#endif
+
+    for (; i < column.size(); i++)
+    {
+        keep[i] &= (column[i] >= min && column[i] <= max) ? 0xff : 0;
+    }
+}
+
+/**
+ * @brief Clears the keep flag of every row whose \p column value is not set in the \p mask
+ *
+ * @param keep Keep flag of each row, 0xff when kept
+ * @param column Column values
+ * @param mask Which values are kept
+ */
+static void keepMask(std::vector<u8> &keep, const std::vector<u8> &column, u32 mask)
+{
+    for (size_t i = 0; i < column.size(); i++)
+    {
+        keep[i] &= static_cast<u8>(-((mask >> column[i]) & 1));
+    }
+}
 
 StateFilter::StateFilter(u8 gender, u8 ability, u8 shiny, u8 levelMin, u8 levelMax, u8 heightMin, u8 heightMax, u8 weightMin, u8 weightMax, bool skip,
                          const std::array<u8, 6> &ivMin, const std::array<u8, 6> &ivMax, const std::array<bool, 25> &natures,
                          const std::array<bool, 16> &powers) :
-    skip(skip),
-    natures(natures),
-    powers(powers),
     ivMax(ivMax),
     ivMin(ivMin),
+    ivHigh(packIVs(ivMax)),
+    ivLow(packIVs(ivMin)),
+    natures(compileMask(natures)),
+    powers(compileMask(powers)),
+    skip(skip),
     ability(ability),
     gender(gender),
     heightMax(heightMax),
@@ -56,31 +152,17 @@ bool StateFilter::compareGender(u8 gender) const
 
 bool StateFilter::compareHiddenPower(u8 hiddenPower) const
 {
-    return skip || powers[hiddenPower];
+    return skip || ((powers >> hiddenPower) & 1);
 }
 
 bool StateFilter::compareIV(const std::array<u8, 6> &ivs) const
 {
-    if (skip)
-    {
-        return true;
-    }
-
-    for (int i = 0; i < 6; i++)
-    {
-        u8 iv = ivs[i];
-        if (iv < ivMin[i] || iv > ivMax[i])
-        {
-            return false;
-        }
-    }
-
-    return true;
+    return skip || compareIVs(packIVs(ivs), ivLow, ivHigh);
 }
 
 bool StateFilter::compareNature(u8 nature) const
 {
-    return skip || natures[nature];
+    return skip || ((natures >> nature) & 1);
 }
 
 bool StateFilter::compareShiny(u8 shiny) const
@@ -100,7 +182,7 @@ bool StateFilter::compareState(const SearcherState &state) const
         return false;
     }
 
-    if (!powers[state.getHiddenPower()])
+    if (!((powers >> state.getHiddenPower()) & 1))
     {
         return false;
     }
@@ -130,12 +212,12 @@ bool StateFilter::compareState(const State &state) const
         return false;
     }
 
-    if (!powers[state.getHiddenPower()])
+    if (!((powers >> state.getHiddenPower()) & 1))
     {
         return false;
     }
 
-    if (!natures[state.getNature()])
+    if (!((natures >> state.getNature()) & 1))
     {
         return false;
     }
@@ -150,49 +232,170 @@ bool StateFilter::compareState(const State &state) const
         return false;
     }
 
-    for (int i = 0; i < 6; i++)
+    return compareIVs(packIVs(state.getIVs()), ivLow, ivHigh);
+}
+
+bool StateFilter::compareState(const State8 &state) const
+{
+    if (!compareState(static_cast<const State &>(state)))
     {
-        u8 iv = state.getIV(i);
-        if (iv < ivMin[i] || iv > ivMax[i])
+        return false;
+    }
+
+    if (state.getHeight() < heightMin || state.getHeight() > heightMax)
+    {
+        return false;
+    }
+
+    if (state.getWeight() < weightMin || state.getWeight() > weightMax)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+void StateFilter::compareStates(const StateBatch &batch, std::vector<u32> &rows) const
+{
+    rows.clear();
+
+    std::vector<u8> keep(batch.size(), 0xff);
+    if (!skip)
+    {
+        if (ability != 255)
         {
-            return false;
+            keepRange(keep, batch.ability, ability, ability);
+        }
+
+        if (gender != 255)
+        {
+            keepRange(keep, batch.gender, gender, gender);
+        }
+
+        if (powers != 0xffff)
+        {
+            constexpr u8 order[6] = { 0, 1, 2, 5, 3, 4 };
+
+            std::vector<u8> hiddenPowers(batch.size(), 0);
+            for (int i = 0; i < 6; i++)
+            {
+                const auto &column = batch.ivs[order[i]];
+                for (size_t row = 0; row < batch.size(); row++)
+                {
+                    hiddenPowers[row] |= (column[row] & 1) << i;
+                }
+            }
+
+            for (u8 &hiddenPower : hiddenPowers)
+            {
+                hiddenPower = hiddenPower * 15 / 63;
+            }
+            keepMask(keep, hiddenPowers, powers);
+        }
+
+        if (natures != 0x1ffffff)
+        {
+            keepMask(keep, batch.nature, natures);
+        }
+
+        if (shiny != 255)
+        {
+            for (size_t row = 0; row < batch.size(); row++)
+            {
+                keep[row] &= (shiny & batch.shiny[row]) ? 0xff : 0;
+            }
+        }
+
+        keepRange(keep, batch.level, levelMin, levelMax);
+
+        for (int i = 0; i < 6; i++)
+        {
+            keepRange(keep, batch.ivs[i], ivMin[i], ivMax[i]);
         }
     }
 
-    return true;
+    for (size_t row = 0; row < keep.size(); row++)
+    {
+        if (keep[row])
+        {
+            rows.emplace_back(row);
+        }
+    }
 }
 
-bool StateFilter::compareState(const State8 &state) const
+bool StateFilter::contains(const StateFilter &filter) const
 {
-    if (!compareState(static_cast<const State &>(state)))
+    if (skip)
+    {
+        return true;
+    }
+
+    if (filter.skip)
     {
         return false;
     }
 
-    if (state.getHeight() < heightMin || state.getHeight() > heightMax)
+    if (ability != 255 && ability != filter.ability)
     {
         return false;
     }
 
-    if (state.getWeight() < weightMin || state.getWeight() > weightMax)
+    if (gender != 255 && gender != filter.gender)
+    {
+        return false;
+    }
+
+    if (shiny != 255 && (filter.shiny & ~shiny))
+    {
+        return false;
+    }
+
+    if ((filter.natures & ~natures) || (filter.powers & ~powers))
     {
         return false;
     }
 
+    if (filter.levelMin < levelMin || filter.levelMax > levelMax || filter.heightMin < heightMin || filter.heightMax > heightMax
+        || filter.weightMin < weightMin || filter.weightMax > weightMax)
+    {
+        return false;
+    }
+
+    for (int i = 0; i < 6; i++)
+    {
+        if (filter.ivMin[i] < ivMin[i] || filter.ivMax[i] > ivMax[i])
+        {
+            return false;
+        }
+    }
+
     return true;
 }
 
+StateFilter StateFilter::relaxed() const
+{
+    StateFilter filter(*this);
+    if (!skip)
+    {
+        filter.ability = 255;
+        filter.gender = 255;
+        filter.natures = 0x1ffffff;
+        filter.powers = 0xffff;
+    }
+    return filter;
+}
+
 WildStateFilter::WildStateFilter(u8 gender, u8 ability, u8 shiny, u8 levelMin, u8 levelMax, u8 heightMin, u8 heightMax, u8 weightMin, u8 weightMax, bool skip,
                                  const std::array<u8, 6> &ivMin, const std::array<u8, 6> &ivMax, const std::array<bool, 25> &natures,
                                  const std::array<bool, 16> &powers, const std::array<bool, 13> &encounterSlots) :
     StateFilter(gender, ability, shiny, levelMin, levelMax, heightMin, heightMax, weightMin, weightMax, skip, ivMin, ivMax, natures, powers),
-    encounterSlots(encounterSlots)
+    encounterSlots(compileMask(encounterSlots))
 {
 }
 
 bool WildStateFilter::compareEncounterSlot(u8 encounterSlot) const
 {
-    return skip || (encounterSlot < encounterSlots.size() && encounterSlots[encounterSlot]);
+    return skip || (encounterSlot < 16 && ((encounterSlots >> encounterSlot) & 1));
 }
 
 bool WildStateFilter::compareState(const WildGeneratorState &state) const
@@ -212,7 +415,7 @@ bool WildStateFilter::compareState(const WildGeneratorState &state) const
         return false;
     }
 
-    if (!powers[state.getHiddenPower()])
+    if (!((powers >> state.getHiddenPower()) & 1))
     {
         return false;
     }
@@ -227,16 +430,7 @@ bool WildStateFilter::compareState(const WildGeneratorState &state) const
         return false;
     }
 
-    for (int i = 0; i < 6; i++)
-    {
-        u8 iv = state.getIV(i);
-        if (iv < ivMin[i] || iv > ivMax[i])
-        {
-            return false;
-        }
-    }
-
-    return true;
+    return compareIVs(packIVs(state.getIVs()), ivLow, ivHigh);
 }
 
 bool WildStateFilter::compareState(const WildSearcherState &state) const
@@ -251,7 +445,7 @@ bool WildStateFilter::compareState(const WildSearcherState &state) const
         return false;
     }
 
-    if (!powers[state.getHiddenPower()])
+    if (!((powers >> state.getHiddenPower()) & 1))
     {
         return false;
     }
@@ -295,6 +489,11 @@ bool WildStateFilter::compareState(const WildState8 &state) const
     return true;
 }
 
+bool WildStateFilter::contains(const WildStateFilter &filter) const
+{
+    return StateFilter::contains(filter) && (skip || !(filter.encounterSlots & ~encounterSlots));
+}
+
 bool WildStateFilter::hasFilters() const
 {
     if (skip || ability != 255 || gender != 255 || shiny != 255)
@@ -310,29 +509,5 @@ bool WildStateFilter::hasFilters() const
         }
     }
 
-    for (bool nature : natures)
-    {
-        if (!nature)
-        {
-            return true;
-        }
-    }
-
-    for (bool power : powers)
-    {
-        if (!power)
-        {
-            return true;
-        }
-    }
-
-    for (bool encounterSlot : encounterSlots)
-    {
-        if (!encounterSlot)
-        {
-            return true;
-        }
-    }
-
-    return false;
+    return natures != 0x1ffffff || powers != 0xffff || encounterSlots != 0x1fff;
 }
@@ -22,17 +22,22 @@
 
 #include <Core/Global.hpp>
 #include <array>
+#include <vector>
 
 class SearcherState;
 class State;
 class State8;
+struct StateBatch;
 class WildGeneratorState;
 class WildSearcherState;
 class WildState;
 class WildState8;
 
 /**
- * @brief Provides ways to determine if the given \ref State meets the given criteria
+ * @brief Provides ways to determine if the given \ref State meets the given criteria.
+ *
+ * The nature, hidden power and encounter slot tables are compiled into bitmasks and the IV bounds are packed one per byte, so the six
+ * IVs of a state are checked with a single word compare.
  */
 class StateFilter
 {
@@ -153,12 +158,42 @@ public:
      */
     bool compareState(const State8 &state) const;
 
+    /**
+     * @brief Determines which rows of the \p batch meet the filter criteria. Gives the same result as comparing the state of each row.
+     *
+     * @param batch States to compare
+     * @param rows Vector to write the indexes of the rows that pass the filter to
+     */
+    void compareStates(const StateBatch &batch, std::vector<u32> &rows) const;
+
+    /**
+     * @brief Determines if every state that passes the \p filter also passes this filter. Results searched with this filter can then be
+     * narrowed down to the \p filter without searching again.
+     *
+     * @param filter Filter to compare
+     *
+     * @return true Filter is contained in this filter
+     * @return false Filter is not contained in this filter
+     */
+    bool contains(const StateFilter &filter) const;
+
+    /**
+     * @brief Returns a copy of the filter that accepts any ability, gender, hidden power and nature. The IV, level and shiny bounds
+     * decide how many results a search keeps, so they are left as is. Results searched with the relaxed filter can be filtered again
+     * for any of the relaxed settings without searching again.
+     *
+     * @return Relaxed filter
+     */
+    StateFilter relaxed() const;
+
 protected:
-    bool skip;
-    std::array<bool, 25> natures;
-    std::array<bool, 16> powers;
     std::array<u8, 6> ivMax;
     std::array<u8, 6> ivMin;
+    u64 ivHigh;
+    u64 ivLow;
+    u32 natures;
+    u16 powers;
+    bool skip;
     u8 ability;
     u8 gender;
     u8 heightMax;
@@ -254,6 +289,16 @@ public:
      */
     bool compareState(const WildState8 &state) const;
 
+    /**
+     * @brief Determines if every state that passes the \p filter also passes this filter
+     *
+     * @param filter Filter to compare
+     *
+     * @return true Filter is contained in this filter
+     * @return false Filter is not contained in this filter
+     */
+    bool contains(const WildStateFilter &filter) const;
+
     /**
      * @brief Determines if any filters are active
      *
@@ -263,7 +308,7 @@ public:
     bool hasFilters() const;
 
 protected:
-    std::array<bool, 13> encounterSlots;
+    u16 encounterSlots;
 };
 
 #endif // STATEFILTER_HPP
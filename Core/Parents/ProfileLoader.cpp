@@ -33,6 +33,7 @@
 using json = nlohmann::json;
 
 static std::filesystem::path path;
+static bool validated;
 
 /**
  * @brief Reads provided profiles file
@@ -64,6 +65,53 @@ static void writeJson(const json &j)
     write.close();
 }
 
+/**
+ * @brief Clears the IV/SHA cache paths of Gen 5 profiles whose cache files no longer exist
+ */
+static void validateCaches()
+{
+    if (validated)
+    {
+        return;
+    }
+    validated = true;
+
+    json j = readJson();
+    auto &gen5 = j["gen5"];
+    bool flag = false;
+    for (auto &profile : gen5)
+    {
+        std::string ivCache = profile.value("ivCache", "");
+        std::string shaCache = profile.value("shaCache", "");
+
+        // If the IV Cache isn't valid then automatically invalidate the SHA cache
+        if (!ivCache.empty() && !std::filesystem::exists(ivCache))
+        {
+            profile["ivCache"] = "";
+            profile["shaCache"] = "";
+            flag = true;
+        }
+
+        if (!shaCache.empty() && !std::filesystem::exists(shaCache))
+        {
+            profile["shaCache"] = "";
+            flag = true;
+        }
+
+        // This edge case shouldn't be possible by UI flow and would require a user to manually edit the profiles file
+        if (ivCache.empty() && !shaCache.empty())
+        {
+            profile["shaCache"] = "";
+            flag = true;
+        }
+    }
+
+    if (flag)
+    {
+        writeJson(j);
+    }
+}
+
 namespace ProfileLoader
 {
     bool init(const std::wstring &location)
@@ -77,44 +125,9 @@ namespace ProfileLoader
             json << "{}";
             json.close();
         }
-        else
-        {
-            // Validate IV/SHA cache files still exist
-            json j = readJson();
-            auto &gen5 = j["gen5"];
-            bool flag = false;
-            for (auto &profile : gen5)
-            {
-                std::string ivCache = profile.value("ivCache", "");
-                std::string shaCache = profile.value("shaCache", "");
-
-                // If the IV Cache isn't valid then automatically invalidate the SHA cache
-                if (!ivCache.empty() && !std::filesystem::exists(ivCache))
-                {
-                    profile["ivCache"] = "";
-                    profile["shaCache"] = "";
-                    flag = true;
-                }
 
-                if (!shaCache.empty() && !std::filesystem::exists(shaCache))
-                {
-                    profile["shaCache"] = "";
-                    flag = true;
-                }
-
-                // This edge case shouldn't be possible by UI flow and would require a user to manually edit the profiles file
-                if (ivCache.empty() && !shaCache.empty())
-                {
-                    profile["shaCache"] = "";
-                    flag = true;
-                }
-            }
-
-            if (flag)
-            {
-                writeJson(j);
-            }
-        }
+        // Cache files are only checked once Gen 5 profiles are needed
+        validated = false;
 
         return exists;
     }
@@ -168,6 +181,23 @@ namespace ProfileLoader3
         writeJson(j);
     }
 
+    std::optional<Profile3> getProfile(const std::string &data)
+    {
+        json j = json::parse(data, nullptr, false);
+        if (!j.is_object())
+        {
+            return std::nullopt;
+        }
+
+        try
+        {
+            return getProfile(j);
+        } catch (const std::exception &)
+        {
+            return std::nullopt;
+        }
+    }
+
     std::vector<Profile3> getProfiles(Game version)
     {
         json j = readJson();
@@ -259,6 +289,23 @@ namespace ProfileLoader4
         }
     }
 
+    std::optional<Profile4> getProfile(const std::string &data)
+    {
+        json j = json::parse(data, nullptr, false);
+        if (!j.is_object())
+        {
+            return std::nullopt;
+        }
+
+        try
+        {
+            return getProfile(j);
+        } catch (const std::exception &)
+        {
+            return std::nullopt;
+        }
+    }
+
     std::vector<Profile4> getProfiles(Game version)
     {
         json j = readJson();
@@ -403,8 +450,27 @@ namespace ProfileLoader5
         writeJson(j);
     }
 
+    std::optional<Profile5> getProfile(const std::string &data)
+    {
+        json j = json::parse(data, nullptr, false);
+        if (!j.is_object())
+        {
+            return std::nullopt;
+        }
+
+        try
+        {
+            return getProfile(j);
+        } catch (const std::exception &)
+        {
+            return std::nullopt;
+        }
+    }
+
     std::vector<Profile5> getProfiles(Game version)
     {
+        validateCaches();
+
         json j = readJson();
         const auto &gen5 = j["gen5"];
         return gen5 | std::views::filter([version](const json &j) { return (j.value("version", Game::Black) & version) != Game::None; })
@@ -499,6 +565,23 @@ namespace ProfileLoader8
         writeJson(j);
     }
 
+    std::optional<Profile8> getProfile(const std::string &data)
+    {
+        json j = json::parse(data, nullptr, false);
+        if (!j.is_object())
+        {
+            return std::nullopt;
+        }
+
+        try
+        {
+            return getProfile(j);
+        } catch (const std::exception &)
+        {
+            return std::nullopt;
+        }
+    }
+
     std::vector<Profile8> getProfiles(Game version)
     {
         json j = readJson();
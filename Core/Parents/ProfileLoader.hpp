@@ -21,6 +21,7 @@
 #define PROFILELOADER_HPP
 
 #include <Core/Global.hpp>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -33,7 +34,8 @@ enum class Game : u32;
 namespace ProfileLoader
 {
     /**
-     * @brief Initializes the ProfileLoader with the location to read/write profiles from
+     * @brief Initializes the ProfileLoader with the location to read/write profiles from.
+     * The IV/SHA caches of Gen 5 profiles are validated the first time Gen 5 profiles are read.
      *
      * @param location Location of profiles json file
      *
@@ -52,6 +54,15 @@ namespace ProfileLoader3
      */
     void addProfile(const Profile3 &profile);
 
+    /**
+     * @brief Reads a profile from JSON text in the format of the stored json file
+     *
+     * @param data JSON text of a single profile
+     *
+     * @return Converted profile, or std::nullopt if \p data is not a valid profile
+     */
+    std::optional<Profile3> getProfile(const std::string &data);
+
     /**
      * @brief Reads profiles from stored json file
      *
@@ -86,6 +97,15 @@ namespace ProfileLoader4
      */
     void addProfile(const Profile4 &profile);
 
+    /**
+     * @brief Reads a profile from JSON text in the format of the stored json file
+     *
+     * @param data JSON text of a single profile
+     *
+     * @return Converted profile, or std::nullopt if \p data is not a valid profile
+     */
+    std::optional<Profile4> getProfile(const std::string &data);
+
     /**
      * @brief Reads profiles from stored json file
      *
@@ -120,6 +140,15 @@ namespace ProfileLoader5
      */
     void addProfile(const Profile5 &profile);
 
+    /**
+     * @brief Reads a profile from JSON text in the format of the stored json file
+     *
+     * @param data JSON text of a single profile
+     *
+     * @return Converted profile, or std::nullopt if \p data is not a valid profile
+     */
+    std::optional<Profile5> getProfile(const std::string &data);
+
     /**
      * @brief Reads profiles from stored json file
      *
@@ -154,6 +183,15 @@ namespace ProfileLoader8
      */
     void addProfile(const Profile8 &profile);
 
+    /**
+     * @brief Reads a profile from JSON text in the format of the stored json file
+     *
+     * @param data JSON text of a single profile
+     *
+     * @return Converted profile, or std::nullopt if \p data is not a valid profile
+     */
+    std::optional<Profile8> getProfile(const std::string &data);
+
     /**
      * @brief Reads profiles from stored json file
      *
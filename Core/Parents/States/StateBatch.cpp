@@ -0,0 +1,57 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "StateBatch.hpp"
+
+StateBatch::StateBatch(size_t size)
+{
+    resize(size);
+}
+
+GeneratorState StateBatch::getState(size_t row, const PersonalInfo *info, Lead lead) const
+{
+    std::array<u8, 6> rowIVs = { ivs[0][row], ivs[1][row], ivs[2][row], ivs[3][row], ivs[4][row], ivs[5][row] };
+    return GeneratorState(advances[row], ec[row], pid[row], rowIVs, ability[row], gender[row], level[row], nature[row], shiny[row], info,
+                          lead);
+}
+
+void StateBatch::getStates(const std::vector<u32> &rows, const PersonalInfo *info, std::vector<GeneratorState> &states, Lead lead) const
+{
+    states.reserve(states.size() + rows.size());
+    for (u32 row : rows)
+    {
+        states.emplace_back(getState(row, info, lead));
+    }
+}
+
+void StateBatch::resize(size_t size)
+{
+    advances.resize(size);
+    ec.resize(size);
+    pid.resize(size);
+    for (auto &column : ivs)
+    {
+        column.resize(size);
+    }
+    ability.resize(size);
+    gender.resize(size);
+    level.resize(size);
+    nature.resize(size);
+    shiny.resize(size);
+}
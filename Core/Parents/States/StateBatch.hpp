@@ -0,0 +1,97 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef STATEBATCH_HPP
+#define STATEBATCH_HPP
+
+#include <Core/Parents/States/State.hpp>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Stores a batch of generated states column by column (struct of arrays).
+ * Generators fill each column for every row of the batch and filters evaluate a column at a time.
+ * Full states, including stats and characteristic, are only built for the rows that are kept.
+ */
+struct StateBatch
+{
+    /**
+     * @brief Number of rows generators fill before filtering them
+     */
+    static constexpr u32 capacity = 4096;
+
+    std::vector<u32> advances;
+    std::vector<u32> ec;
+    std::vector<u32> pid;
+    std::array<std::vector<u8>, 6> ivs;
+    std::vector<u8> ability;
+    std::vector<u8> gender;
+    std::vector<u8> level;
+    std::vector<u8> nature;
+    std::vector<u8> shiny;
+
+    /**
+     * @brief Construct a new StateBatch object
+     *
+     * @param size Number of rows
+     */
+    explicit StateBatch(size_t size = 0);
+
+    /**
+     * @brief Returns the state of the \p row
+     *
+     * @param row Row index
+     * @param info Pokemon information
+     * @param lead Encounter lead
+     *
+     * @return Generator state
+     */
+    GeneratorState getState(size_t row, const PersonalInfo *info, Lead lead = Lead::None) const;
+
+    /**
+     * @brief Adds the state of each of the \p rows to the \p states
+     *
+     * @param rows Row indexes
+     * @param info Pokemon information
+     * @param states Vector to add the states to
+     * @param lead Encounter lead
+     */
+    void getStates(const std::vector<u32> &rows, const PersonalInfo *info, std::vector<GeneratorState> &states,
+                   Lead lead = Lead::None) const;
+
+    /**
+     * @brief Changes the number of rows of every column
+     *
+     * @param size Number of rows
+     */
+    void resize(size_t size);
+
+    /**
+     * @brief Returns the number of rows
+     *
+     * @return Number of rows
+     */
+    size_t size() const
+    {
+        return pid.size();
+    }
+};
+
+#endif // STATEBATCH_HPP
@@ -0,0 +1,96 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "StateCandidates.hpp"
+#include <Core/Parents/Filters/StateFilter.hpp>
+#include <thread>
+
+void StateCandidates::clear()
+{
+    batches.clear();
+    count = 0;
+}
+
+std::vector<int> StateCandidates::filter(const StateFilter &filter, int threads, size_t first) const
+{
+    size_t begin = std::min(first / StateBatch::capacity, batches.size());
+    threads = static_cast<int>(std::clamp<size_t>(batches.size() - begin, 1, std::max(threads, 1)));
+
+    auto compare = [&](size_t start, size_t end, std::vector<int> &result) {
+        std::vector<u32> rows;
+        for (size_t i = start; i < end; i++)
+        {
+            filter.compareStates(batches[i], rows);
+            for (u32 row : rows)
+            {
+                size_t index = i * StateBatch::capacity + row;
+                if (index >= first)
+                {
+                    result.emplace_back(static_cast<int>(index));
+                }
+            }
+        }
+    };
+
+    if (threads == 1)
+    {
+        std::vector<int> result;
+        compare(begin, batches.size(), result);
+        return result;
+    }
+
+    auto *results = new std::vector<int>[threads];
+    auto *threadContainer = new std::thread[threads];
+    for (int i = 0; i < threads; i++)
+    {
+        size_t start = begin + (batches.size() - begin) * i / threads;
+        size_t end = begin + (batches.size() - begin) * (i + 1) / threads;
+        threadContainer[i] = std::thread([=, &compare] { compare(start, end, results[i]); });
+    }
+
+    std::vector<int> result;
+    for (int i = 0; i < threads; i++)
+    {
+        threadContainer[i].join();
+        result.insert(result.end(), results[i].begin(), results[i].end());
+    }
+
+    delete[] threadContainer;
+    delete[] results;
+
+    return result;
+}
+
+void StateCandidates::setRow(StateBatch &batch, size_t row, const State &state)
+{
+    batch.ec[row] = state.getEC();
+    batch.pid[row] = state.getPID();
+
+    auto ivs = state.getIVs();
+    for (int i = 0; i < 6; i++)
+    {
+        batch.ivs[i][row] = ivs[i];
+    }
+
+    batch.ability[row] = state.getAbility();
+    batch.gender[row] = state.getGender();
+    batch.level[row] = state.getLevel();
+    batch.nature[row] = state.getNature();
+    batch.shiny[row] = state.getShiny();
+}
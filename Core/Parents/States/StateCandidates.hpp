@@ -0,0 +1,110 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef STATECANDIDATES_HPP
+#define STATECANDIDATES_HPP
+
+#include <Core/Parents/States/StateBatch.hpp>
+#include <algorithm>
+
+class StateFilter;
+
+/**
+ * @brief Keeps the filtered settings of the results of a search in \ref StateBatch columns. The search is run once with a relaxed
+ * filter and each later filter is applied to the stored rows instead of searching again.
+ */
+class StateCandidates
+{
+public:
+    /**
+     * @brief Adds the states of the \p items after the existing rows
+     *
+     * @tparam Item State class, or searcher result class that holds a state
+     * @param items Items to add
+     */
+    template <class Item>
+    void append(const std::vector<Item> &items)
+    {
+        for (size_t i = 0; i < items.size();)
+        {
+            if (batches.empty() || batches.back().size() == StateBatch::capacity)
+            {
+                batches.emplace_back();
+            }
+
+            StateBatch &batch = batches.back();
+            size_t row = batch.size();
+            size_t end = row + std::min<size_t>(StateBatch::capacity - row, items.size() - i);
+            batch.resize(end);
+            for (; row < end; row++, i++)
+            {
+                if constexpr (requires(const Item &item) { item.getState(); })
+                {
+                    setRow(batch, row, items[i].getState());
+                }
+                else
+                {
+                    setRow(batch, row, items[i]);
+                }
+            }
+        }
+        count += items.size();
+    }
+
+    /**
+     * @brief Removes every row
+     */
+    void clear();
+
+    /**
+     * @brief Determines which rows from \p first onwards meet the \p filter criteria. The batches are split across \p threads threads.
+     *
+     * @param filter Filter to compare
+     * @param threads Number of threads
+     * @param first First row to compare
+     *
+     * @return Indexes of the rows that pass the filter in order
+     */
+    std::vector<int> filter(const StateFilter &filter, int threads, size_t first = 0) const;
+
+    /**
+     * @brief Returns the number of rows
+     *
+     * @return Number of rows
+     */
+    size_t size() const
+    {
+        return count;
+    }
+
+private:
+    std::vector<StateBatch> batches;
+    size_t count = 0;
+
+    /**
+     * @brief Copies the filtered settings of the \p state into the \p row of the \p batch
+     *
+     * @param batch Batch to write to
+     * @param row Row index
+     * @param state State to copy
+     */
+    static void setRow(StateBatch &batch, size_t row, const State &state);
+};
+
+#endif // STATECANDIDATES_HPP
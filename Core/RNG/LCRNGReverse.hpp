@@ -20,9 +20,9 @@
 #ifndef LCRNGREVERSE_HPP
 #define LCRNGREVERSE_HPP
 
-#include <Core/Global.hpp>
-
-enum class Method : u8;
+#include <Core/Enum/Method.hpp>
+#include <Core/RNG/LCRNG.hpp>
+#include <array>
 
 template <int size>
 struct RecoverySeeds
@@ -38,6 +38,11 @@ struct RecoverySeeds
     {
         return seeds[i];
     }
+
+    u32 operator[](int i) const
+    {
+        return seeds[i];
+    }
 };
 
 /**
@@ -76,6 +81,108 @@ namespace LCRNGReverse
      */
     RecoverySeeds<6> recoverPokeRNGIV(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, Method method);
 
+    /**
+     * @brief Number of (spa, spd, spe) combinations in a row before scanning the row beats the lattice recovery
+     */
+    constexpr u32 ROW_SCAN_THRESHOLD = 2048;
+
+    /**
+     * @brief Recovers origin seeds for every (spa, spd, spe) in the range for a fixed (hp, atk, def)
+     * The 2^16 lower bits of the first IV call are walked once and each seed is checked against the range.
+     * Seeds are reported in pairs with the same ordering as the lattice recoveries.
+     *
+     * @tparam mult Multiplier to get from the first IV call to the second
+     * @tparam add Adder to get from the first IV call to the second
+     * @tparam secondNormal Whether the normal seed of a pair is the one with the upper bit clear on the second IV call
+     * @tparam Callback Function type that receives the recovered seeds
+     * @param hp HP iv
+     * @param atk Atk iv
+     * @param def Def iv
+     * @param min Minimum IVs
+     * @param max Maximum IVs
+     * @param callback Called with the IVs and the seed pair for every recovered seed
+     */
+    template <u32 mult, u32 add, bool secondNormal, class Callback>
+    void scanIVRow(u8 hp, u8 atk, u8 def, const std::array<u8, 6> &min, const std::array<u8, 6> &max, Callback &&callback)
+    {
+        auto mask = [](u8 low, u8 high) { return static_cast<u32>((0xffffffffULL << low) & (0xffffffffULL >> (31 - high))); };
+        u32 speMask = mask(min[5], max[5]);
+        u32 spaMask = mask(min[3], max[3]);
+        u32 spdMask = mask(min[4], max[4]);
+
+        u32 first = static_cast<u32>(hp | (atk << 5) | (def << 10)) << 16;
+        u32 next = first * mult + add;
+        for (u32 lbits = 0; lbits < 0x10000; lbits++, next += mult)
+        {
+            u8 spe = (next >> 16) & 31;
+            u8 spa = (next >> 21) & 31;
+            u8 spd = (next >> 26) & 31;
+            if ((speMask >> spe) & (spaMask >> spa) & (spdMask >> spd) & 1)
+            {
+                u32 seed = first | lbits;
+                if (secondNormal && (next & 0x80000000))
+                {
+                    seed ^= 0x80000000;
+                }
+
+                RecoverySeeds<6> seeds;
+                seeds[seeds.count++] = seed;
+                seeds[seeds.count++] = seed ^ 0x80000000;
+                callback(std::array<u8, 6> { hp, atk, def, spa, spd, spe }, seeds);
+            }
+        }
+    }
+
+    /**
+     * @brief Recovers origin seeds for every (spa, spd, spe) in the range for a fixed (hp, atk, def)
+     * Large ranges scan the row once while small ranges run the lattice recovery per IV combination.
+     * Seeds are grouped per IV combination only when the lattice recovery is used.
+     *
+     * @tparam Callback Function type that receives the recovered seeds
+     * @param hp HP iv
+     * @param atk Atk iv
+     * @param def Def iv
+     * @param min Minimum IVs
+     * @param max Maximum IVs
+     * @param method Encounter method
+     * @param callback Called with the IVs and recovered seeds, never called with zero seeds
+     */
+    template <class Callback>
+    void recoverPokeRNGIVRow(u8 hp, u8 atk, u8 def, const std::array<u8, 6> &min, const std::array<u8, 6> &max, Method method,
+                             Callback &&callback)
+    {
+        u32 combinations = (max[3] - min[3] + 1) * (max[4] - min[4] + 1) * (max[5] - min[5] + 1);
+        if (combinations >= ROW_SCAN_THRESHOLD)
+        {
+            if (method == Method::Method4)
+            {
+                constexpr u32 mult = PokeRNG::getMult() * PokeRNG::getMult();
+                constexpr u32 add = PokeRNG::getAdd() * (PokeRNG::getMult() + 1);
+                scanIVRow<mult, add, true>(hp, atk, def, min, max, callback);
+            }
+            else
+            {
+                scanIVRow<PokeRNG::getMult(), PokeRNG::getAdd(), false>(hp, atk, def, min, max, callback);
+            }
+            return;
+        }
+
+        for (u8 spa = min[3]; spa <= max[3]; spa++)
+        {
+            for (u8 spd = min[4]; spd <= max[4]; spd++)
+            {
+                for (u8 spe = min[5]; spe <= max[5]; spe++)
+                {
+                    auto seeds = recoverPokeRNGIV(hp, atk, def, spa, spd, spe, method);
+                    if (seeds.count != 0)
+                    {
+                        callback(std::array<u8, 6> { hp, atk, def, spa, spd, spe }, seeds);
+                    }
+                }
+            }
+        }
+    }
+
     /**
      * @brief Recovers origin seeds for two 16 bit calls
      *
@@ -101,6 +208,45 @@ namespace LCRNGReverse
      */
     RecoverySeeds<6> recoverXDRNGIV(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe);
 
+    /**
+     * @brief Recovers origin seeds for every (spa, spd, spe) in the range for a fixed (hp, atk, def)
+     * Large ranges scan the row once while small ranges run the lattice recovery per IV combination.
+     * Seeds are grouped per IV combination only when the lattice recovery is used.
+     *
+     * @tparam Callback Function type that receives the recovered seeds
+     * @param hp HP iv
+     * @param atk Atk iv
+     * @param def Def iv
+     * @param min Minimum IVs
+     * @param max Maximum IVs
+     * @param callback Called with the IVs and recovered seeds, never called with zero seeds
+     */
+    template <class Callback>
+    void recoverXDRNGIVRow(u8 hp, u8 atk, u8 def, const std::array<u8, 6> &min, const std::array<u8, 6> &max, Callback &&callback)
+    {
+        u32 combinations = (max[3] - min[3] + 1) * (max[4] - min[4] + 1) * (max[5] - min[5] + 1);
+        if (combinations >= ROW_SCAN_THRESHOLD)
+        {
+            scanIVRow<XDRNG::getMult(), XDRNG::getAdd(), true>(hp, atk, def, min, max, callback);
+            return;
+        }
+
+        for (u8 spa = min[3]; spa <= max[3]; spa++)
+        {
+            for (u8 spd = min[4]; spd <= max[4]; spd++)
+            {
+                for (u8 spe = min[5]; spe <= max[5]; spe++)
+                {
+                    auto seeds = recoverXDRNGIV(hp, atk, def, spa, spd, spe);
+                    if (seeds.count != 0)
+                    {
+                        callback(std::array<u8, 6> { hp, atk, def, spa, spd, spe }, seeds);
+                    }
+                }
+            }
+        }
+    }
+
     /**
      * @brief Recovers origin seeds for two 16 bit calls
      *
@@ -18,6 +18,7 @@
  */
 
 #include "MT.hpp"
+#include <algorithm>
 #include <cstring>
 
 constexpr u8 jumpTable[9][2493] = {
@@ -75,6 +76,22 @@ u32 MT::next()
     return y;
 }
 
+std::vector<MT> MT::split(u32 count, u32 length) const
+{
+    std::vector<MT> streams;
+    streams.reserve(count);
+    if (count != 0)
+    {
+        streams.emplace_back(*this);
+        for (u32 i = 1; i < count; i++)
+        {
+            streams.emplace_back(streams.back());
+            streams.back().jump(length);
+        }
+    }
+    return streams;
+}
+
 u16 MT::nextUShort()
 {
     return next() >> 16;
@@ -107,11 +124,21 @@ void MT::addState(const MT *other)
 
 void MT::jump(u32 advances)
 {
-    // Since this is only called by the constructor we need to reset index to 0 so we can shuffle 1 at a time
+    // Jumps that stay inside the current block only need to move the index
+    u64 target = static_cast<u64>(index) + advances;
+    if (target < 624)
+    {
+        index = target;
+        return;
+    }
+
+    // Otherwise step the state until it holds the 624 words before the target and shuffle in the target block
+    // Reset index to 0 so we can shuffle 1 at a time
+    u64 steps = target - 624;
     index = 0;
 
-    u32 high = advances >> 23;
-    u32 low = advances & 0x7fffff;
+    u32 high = steps >> 23;
+    u32 low = steps & 0x7fffff;
 
     // Advance by amount unsupported by the jump tables
     // First shuffle by an amount of times divisible by 624 to utilize SIMD logic
@@ -150,7 +177,11 @@ void MT::jump(u32 advances)
         }
     }
 
+    // Rotate the oldest word to the front so the state lines up with shuffle
+    u32 *ptr = &state[0].uint32[0];
+    std::rotate(ptr, ptr + index, ptr + 624);
     shuffle();
+    index = 0;
 }
 
 void MT::nextState()
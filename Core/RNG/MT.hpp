@@ -22,6 +22,7 @@
 
 #include <Core/Global.hpp>
 #include <Core/RNG/SIMD.hpp>
+#include <vector>
 
 /**
  * @brief Provides random numbers via the Mersenne Twister algorithm.
@@ -51,6 +52,14 @@ public:
      */
     void advance(u32 advances);
 
+    /**
+     * @brief Jumps the RNG by \p advances amount from its current state
+     * Uses a precomputed jump table to complete in O(log n)
+     *
+     * @param advances Number of advances
+     */
+    void jump(u32 advances);
+
     /**
      * @brief Gets the next 32bit PRNG state
      *
@@ -65,6 +74,42 @@ public:
      */
     u16 nextUShort();
 
+    /**
+     * @brief Splits the RNG stream into \p count consecutive substreams of \p length advances.
+     * Substream i starts i * \p length advances after the current state, so each can be consumed on its own thread and
+     * the results concatenated in order.
+     *
+     * @param count Number of substreams
+     * @param length Number of advances in each substream
+     *
+     * @return Vector of substreams
+     */
+    std::vector<MT> split(u32 count, u32 length) const;
+
+    /**
+     * @brief Computes the IV of an output from the words of the initial state it is shuffled from, without building the whole state.
+     * Works on single seeds and on SIMD vectors of seeds.
+     *
+     * @tparam Vector u32 or SIMD vector of u32 lanes
+     * @param current Word at the index of the output
+     * @param next Word after the index of the output
+     * @param far Word 397 after the index of the output
+     *
+     * @return Top 5 bits of the output
+     */
+    template <class Vector>
+    static Vector getIV(const Vector &current, const Vector &next, const Vector &far)
+    {
+        Vector y = (current & Vector(0x80000000)) | (next & Vector(0x7fffffff));
+        y = far ^ (y >> 1) ^ ((y & Vector(1)) * Vector(0x9908b0df));
+
+        // Only the top 5 bits are used, skip the last temper step
+        y = y ^ (y >> 11);
+        y = y ^ ((y << 7) & Vector(0x9d2c5680));
+        y = y ^ ((y << 15) & Vector(0xe8000000));
+        return y >> 27;
+    }
+
 private:
     vuint128 state[156];
     u16 index;
@@ -79,15 +124,6 @@ private:
      */
     void addState(const MT *other);
 
-    /**
-     * @brief Jumps the RNG by \p advances amount
-     * Uses a precomputed jump table to complete in O()
-     * With how the table is primarily shuffled all in one go this should only be called by a constructor
-     *
-     * @param advances Number of advances
-     */
-    void jump(u32 advances);
-
     /**
      * @brief Generates the next MT state after 1 state has been consumed
      */
@@ -18,6 +18,17 @@
  */
 
 #include "SFMT.hpp"
+#include <algorithm>
+#include <cstring>
+
+constexpr u8 jumpTable[9][2496] = {
+#include "SFMTJump.txt"
+};
+
+SFMT::SFMT() : index(0)
+{
+    std::memset(state, 0, sizeof(state));
+}
 
 SFMT::SFMT(u32 seed) : index(624)
 {
@@ -41,9 +52,14 @@ SFMT::SFMT(u32 seed) : index(624)
     ptr[0] ^= ~inner & 1;
 }
 
+SFMT::SFMT(u32 seed, u32 advances) : SFMT(seed)
+{
+    jump(advances);
+}
+
 void SFMT::advance(u32 advances)
 {
-    u64 advance = (advances * 2) + index;
+    u64 advance = (static_cast<u64>(advances) * 2) + index;
     while (advance >= 624)
     {
         shuffle();
@@ -78,6 +94,89 @@ u32 SFMT::nextUInt()
     return ptr[index++];
 }
 
+void SFMT::addState(const SFMT *other)
+{
+    for (int i = 0; i < 156; i++)
+    {
+        state[i] = state[i] ^ other->state[(other->index + i) % 156];
+    }
+}
+
+void SFMT::jump(u32 advances)
+{
+    // Each state word holds two 64bit advances
+    // Since this is only called by the constructor we need to reset index to 0 so we can step 1 word at a time
+    u32 steps = advances / 2;
+    index = 0;
+
+    u32 high = steps >> 22;
+    u32 low = steps & 0x3fffff;
+
+    // Advance by amount unsupported by the jump tables
+    // First shuffle by an amount of times divisible by 156 to utilize SIMD logic
+    if (low)
+    {
+        u32 num = low % 156;
+        for (u32 i = 0; i < low / 156; i++)
+        {
+            shuffle();
+        }
+
+        // Advance 1 by 1 for remaining amount. This will be less than 156
+        for (u32 i = 0; i < num; i++)
+        {
+            nextState();
+        }
+    }
+
+    for (int i = 0; high; i++, high >>= 1)
+    {
+        if (high & 1)
+        {
+            SFMT temp;
+
+            for (int j = 0; j < 2496; j++)
+            {
+                u8 val = jumpTable[i][j];
+                for (int bit = 0; bit < 8; bit++)
+                {
+                    if (val & (1 << bit))
+                    {
+                        temp.addState(this);
+                    }
+                    nextState();
+                }
+            }
+
+            *this = temp;
+        }
+    }
+
+    // Rotate the oldest word to the front so the state lines up with shuffle
+    std::rotate(state, state + index, state + 156);
+    shuffle();
+    index = (advances & 1) * 2;
+}
+
+void SFMT::nextState()
+{
+    vuint128 mask(0xdfffffef, 0xddfecb7f, 0xbffaffff, 0xbffffff6);
+
+    vuint128 a = state[index];
+    vuint128 b = state[(index + 122) % 156];
+    vuint128 c = state[(index + 154) % 156];
+    vuint128 d = state[(index + 155) % 156];
+
+    vuint128 x = v128_shl<1>(a);
+    vuint128 y = v128_shr<1>(c);
+
+    vuint128 b1 = (b >> 11) & mask;
+    vuint128 d1 = d << 18;
+
+    state[index] = a ^ x ^ b1 ^ y ^ d1;
+    index = (index + 1) % 156;
+}
+
 void SFMT::shuffle()
 {
     vuint128 c = state[154];
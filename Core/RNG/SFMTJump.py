@@ -0,0 +1,114 @@
+"""
+Generates SFMTJump.txt, the jump polynomials used by SFMT::jump.
+
+The minimal polynomial of the SFMT state transition is recovered with Berlekamp-Massey from one output bit of each
+generated 128-bit word. Table i holds the coefficients of x^(2^(22 + i)) mod that polynomial, where x is a single
+128-bit word step (two 64-bit advances). Coefficient k is stored in byte k / 8, bit k % 8.
+"""
+
+import sys
+
+MASK32 = 0xFFFFFFFF
+MASK128 = (1 << 128) - 1
+SL1 = 18
+SR1 = 11
+MSK = [0xDFFFFFEF, 0xDDFECB7F, 0xBFFAFFFF, 0xBFFFFFF6]
+PARITY = [0x00000001, 0x00000000, 0x00000000, 0x13C9E684]
+JUMP_TABLES = 9
+JUMP_SHIFT = 22
+
+
+def lanes(value):
+    return [(value >> (32 * i)) & MASK32 for i in range(4)]
+
+
+def join(values):
+    return sum(v << (32 * i) for i, v in enumerate(values))
+
+
+def recursion(a, b, c, d):
+    x = (a << 8) & MASK128
+    y = c >> 8
+    b1 = join([(lane >> SR1) & m for lane, m in zip(lanes(b), MSK)])
+    d1 = join([(lane << SL1) & MASK32 for lane in lanes(d)])
+    return a ^ x ^ b1 ^ y ^ d1
+
+
+def init(seed):
+    state = [seed]
+    for i in range(1, 624):
+        seed = (0x6C078965 * (seed ^ (seed >> 30)) + i) & MASK32
+        state.append(seed)
+
+    inner = 0
+    for i in range(4):
+        inner ^= state[i] & PARITY[i]
+    inner = bin(inner).count("1") & 1
+    if inner == 0:
+        state[0] ^= 1
+
+    return [join(state[i:i + 4]) for i in range(0, 624, 4)]
+
+
+def words(seed, count):
+    state = init(seed)
+    for n in range(count):
+        word = recursion(state[n], state[n + 122], state[n + 154], state[n + 155])
+        state.append(word)
+    return state[156:]
+
+
+def berlekamp_massey(bits):
+    connection, previous = 1, 1
+    length, shift = 0, 1
+    window = 0
+    for n, bit in enumerate(bits):
+        discrepancy = bit ^ (((connection >> 1) & window).bit_count() & 1)
+        if discrepancy:
+            temp = connection
+            connection ^= previous << shift
+            if 2 * length <= n:
+                length = n + 1 - length
+                previous = temp
+                shift = 1
+            else:
+                shift += 1
+        else:
+            shift += 1
+        window = (window << 1) | bit
+
+    # Reverse the connection polynomial into the characteristic polynomial
+    return int(format(connection, "b").zfill(length + 1)[::-1], 2), length
+
+
+def square_mod(value, modulus, degree):
+    value = int("0".join(format(value, "b")), 2)
+    while value.bit_length() - 1 >= degree:
+        value ^= modulus << (value.bit_length() - 1 - degree)
+    return value
+
+
+def main(path):
+    bits = [word & 1 for word in words(1234, 2 * 156 * 128 + 1000)]
+    poly, degree = berlekamp_massey(bits)
+
+    jump = 2  # x
+    for _ in range(JUMP_SHIFT):
+        jump = square_mod(jump, poly, degree)
+
+    size = (degree + 7) // 8
+    tables = []
+    for _ in range(JUMP_TABLES):
+        data = jump.to_bytes(size, "little")
+        tables.append("{" + ",".join(str(b) for b in data) + "}")
+        jump = square_mod(jump, poly, degree)
+
+    with open(path, "w") as f:
+        f.write(",\n".join(tables))
+        f.write("\n")
+
+    print(f"Polynomial degree {degree}, {size} bytes per table")
+
+
+if __name__ == "__main__":
+    main(sys.argv[1])
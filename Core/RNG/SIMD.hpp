@@ -146,6 +146,32 @@ union alignas(16) vuint128 {
         return ret;
     }
 
+    /**
+     * @brief Computes the lower 32bits of the multiplication of each 32bit number pair in the vector
+     *
+     * @param y Second operand
+     *
+     * @return Computed multiplication vector
+     */
+    inline vuint128 operator*(vuint128 y) const
+    {
+        vuint128 ret;
+#if defined(SIMD_X86)
+        // SSE2 only has a 32x32->64 multiply of the even lanes, so multiply the even and odd lanes separately and interleave them
+        __m128i even = _mm_mul_epu32(uint128, y.uint128);
+        __m128i odd = _mm_mul_epu32(_mm_srli_epi64(uint128, 32), _mm_srli_epi64(y.uint128, 32));
+        ret.uint128 = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+#elif defined(SIMD_ARM)
+        ret.uint128 = vmulq_u32(uint128, y.uint128);
+#else
+        for (int i = 0; i < 4; i++)
+        {
+            ret.uint32[i] = uint32[i] * y.uint32[i];
+        }
+#endif
+        return ret;
+    }
+
     /**
      * @brief Computes the bitwise left shift of each 32bit number pair in the vector
      *
@@ -708,6 +734,20 @@ union alignas(32) vuint256 {
         return ret;
     }
 
+    /**
+     * @brief Computes the lower 32bits of the multiplication of each 32bit number pair in the vector
+     *
+     * @param y Second operand
+     *
+     * @return Computed multiplication vector
+     */
+    inline vuint256 operator*(vuint256 y) const
+    {
+        vuint256 ret;
+        ret.uint256 = _mm256_mullo_epi32(uint256, y.uint256);
+        return ret;
+    }
+
     /**
      * @brief Computes the bitwise left shift of each 32bit number pair in the vector
      *
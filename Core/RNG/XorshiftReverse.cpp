@@ -0,0 +1,177 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "XorshiftReverse.hpp"
+#include <Core/RNG/Xorshift.hpp>
+#include <algorithm>
+#include <bit>
+
+/**
+ * @brief Single row of the linear system. Column c maps to bit (c % 32) of state word (c / 32).
+ */
+struct Equation
+{
+    u64 low;
+    u64 high;
+    u8 value;
+
+    int lowest() const
+    {
+        return low ? std::countr_zero(low) : high ? 64 + std::countr_zero(high) : -1;
+    }
+
+    bool test(int column) const
+    {
+        return ((column < 64 ? low : high) >> (column & 63)) & 1;
+    }
+
+    Equation &operator^=(const Equation &other)
+    {
+        low ^= other.low;
+        high ^= other.high;
+        value ^= other.value;
+        return *this;
+    }
+};
+
+static Xorshift fromWords(const std::array<u32, 4> &words)
+{
+    return Xorshift((static_cast<u64>(words[0]) << 32) | words[1], (static_cast<u64>(words[2]) << 32) | words[3]);
+}
+
+XorshiftReverse::XorshiftReverse(const std::vector<XorshiftObservation> &observations) : particular {}, consistent(true)
+{
+    std::vector<XorshiftObservation> sorted = observations;
+    std::sort(sorted.begin(), sorted.end(),
+              [](const XorshiftObservation &a, const XorshiftObservation &b) { return a.advance < b.advance; });
+
+    // Output bit j of basis state b is the coefficient of state bit b in the equation for output bit j
+    std::vector<Xorshift> basis;
+    basis.reserve(128);
+    for (int b = 0; b < 128; b++)
+    {
+        std::array<u32, 4> words = {};
+        words[b >> 5] = 1u << (b & 31);
+        basis.emplace_back(fromWords(words));
+    }
+
+    std::array<Equation, 128> pivots;
+    std::array<bool, 128> used = {};
+    std::array<u32, 128> outputs;
+    u32 advance = 0;
+    for (const auto &observation : sorted)
+    {
+        if (observation.advance >= advance)
+        {
+            for (int b = 0; b < 128; b++)
+            {
+                basis[b].jump(observation.advance - advance);
+                outputs[b] = basis[b].next();
+            }
+            advance = observation.advance + 1;
+        }
+
+        for (u32 mask = observation.mask; mask; mask &= mask - 1)
+        {
+            int bit = std::countr_zero(mask);
+
+            Equation equation = { 0, 0, static_cast<u8>((observation.value >> bit) & 1) };
+            for (int b = 0; b < 128; b++)
+            {
+                if ((outputs[b] >> bit) & 1)
+                {
+                    (b < 64 ? equation.low : equation.high) |= 1ull << (b & 63);
+                }
+            }
+
+            int column;
+            while ((column = equation.lowest()) != -1 && used[column])
+            {
+                equation ^= pivots[column];
+            }
+
+            if (column == -1)
+            {
+                if (equation.value)
+                {
+                    consistent = false;
+                    return;
+                }
+            }
+            else
+            {
+                pivots[column] = equation;
+                used[column] = true;
+            }
+        }
+    }
+
+    // Reduce so every pivot row only references its own pivot column and free columns
+    for (int column = 0; column < 128; column++)
+    {
+        if (used[column])
+        {
+            for (int row = 0; row < 128; row++)
+            {
+                if (row != column && used[row] && pivots[row].test(column))
+                {
+                    pivots[row] ^= pivots[column];
+                }
+            }
+        }
+    }
+
+    for (int column = 0; column < 128; column++)
+    {
+        if (used[column])
+        {
+            particular[column >> 5] |= static_cast<u32>(pivots[column].value) << (column & 31);
+        }
+        else
+        {
+            std::array<u32, 4> vector = {};
+            vector[column >> 5] |= 1u << (column & 31);
+            for (int row = 0; row < 128; row++)
+            {
+                if (used[row] && pivots[row].test(column))
+                {
+                    vector[row >> 5] |= 1u << (row & 31);
+                }
+            }
+            kernel.emplace_back(vector);
+        }
+    }
+}
+
+std::array<u64, 2> XorshiftReverse::getSolution(u64 index) const
+{
+    std::array<u32, 4> words = particular;
+    for (size_t i = 0; index; index >>= 1, i++)
+    {
+        if (index & 1)
+        {
+            for (int j = 0; j < 4; j++)
+            {
+                words[j] ^= kernel[i][j];
+            }
+        }
+    }
+
+    return { (static_cast<u64>(words[0]) << 32) | words[1], (static_cast<u64>(words[2]) << 32) | words[3] };
+}
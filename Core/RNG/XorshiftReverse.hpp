@@ -0,0 +1,89 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef XORSHIFTREVERSE_HPP
+#define XORSHIFTREVERSE_HPP
+
+#include <Core/Global.hpp>
+#include <array>
+#include <vector>
+
+/**
+ * @brief Known bits of a single Xorshift output
+ */
+struct XorshiftObservation
+{
+    u32 advance;
+    u32 mask;
+    u32 value;
+};
+
+/**
+ * @brief Provides a way to compute origin Xorshift states given partial knowledge of its outputs.
+ *
+ * Every output bit of Xorshift is a linear function of the 128 bit state over GF(2). Each known bit is turned into an equation and
+ * the resulting system is solved by Gaussian elimination. Any state bits left undetermined are enumerated by index.
+ */
+class XorshiftReverse
+{
+public:
+    /**
+     * @brief Construct a new XorshiftReverse object
+     *
+     * @param observations Known output bits
+     */
+    XorshiftReverse(const std::vector<XorshiftObservation> &observations);
+
+    /**
+     * @brief Returns the number of state bits that are not determined by the observations
+     *
+     * @return Number of free bits
+     */
+    int getFreeBits() const
+    {
+        return static_cast<int>(kernel.size());
+    }
+
+    /**
+     * @brief Returns the \p index solution of the system
+     *
+     * @param index Solution index
+     *
+     * @return Seed pair that can be directly passed to Xorshift
+     */
+    std::array<u64, 2> getSolution(u64 index) const;
+
+    /**
+     * @brief Returns the number of states that agree with the observations.
+     * Returns 0 when the observations are contradictory or leave more than 24 bits undetermined.
+     *
+     * @return Number of solutions
+     */
+    u64 getSolutionCount() const
+    {
+        return consistent && kernel.size() <= 24 ? 1ull << kernel.size() : 0;
+    }
+
+private:
+    std::vector<std::array<u32, 4>> kernel;
+    std::array<u32, 4> particular;
+    bool consistent;
+};
+
+#endif // XORSHIFTREVERSE_HPP
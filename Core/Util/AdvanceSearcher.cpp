@@ -18,6 +18,52 @@
  */
 
 #include "AdvanceSearcher.hpp"
+#include <algorithm>
+#include <array>
+#include <thread>
+
+namespace
+{
+    /**
+     * @brief Searches for matches starting in the rows [\p start, \p end).
+     * The automaton tracks the first 64 positions of the sequence and any remaining positions are checked directly.
+     *
+     * @param values Value of each row
+     * @param sequence Allowed values for each search position
+     * @param masks Bitmask of sequence positions that accept each value
+     * @param start First starting row
+     * @param end One past the last starting row
+     * @param matches Vector to store matching starting rows in
+     */
+    void searchRange(std::span<const u8> values, const AdvanceSearcher::Sequence &sequence, const std::array<u64, 256> &masks,
+                     size_t start, size_t end, std::vector<size_t> &matches)
+    {
+        size_t length = std::min<size_t>(sequence.size(), 64);
+        u64 accept = 1ULL << (length - 1);
+        size_t last = std::min(end + length - 1, values.size());
+
+        u64 state = 0;
+        for (size_t i = start; i < last; i++)
+        {
+            state = ((state << 1) | 1) & masks[values[i]];
+            if (state & accept)
+            {
+                size_t row = i + 1 - length;
+                bool match = true;
+                for (size_t j = length; j < sequence.size() && match; j++)
+                {
+                    u8 value = values[row + j];
+                    match = value >= sequence[j].first && value < sequence[j].second;
+                }
+
+                if (match)
+                {
+                    matches.emplace_back(row);
+                }
+            }
+        }
+    }
+}
 
 namespace AdvanceSearcher
 {
@@ -108,29 +154,45 @@ namespace AdvanceSearcher
         return sequence;
     }
 
-    std::vector<size_t> findMatches(size_t rowCount, const Sequence &sequence, const ValueGetter &getter)
+    std::vector<size_t> findMatches(std::span<const u8> values, const Sequence &sequence, int threads)
     {
         std::vector<size_t> matches;
-        if (sequence.empty())
+        if (sequence.empty() || sequence.size() > values.size())
         {
             return matches;
         }
 
-        for (size_t i = 0; i + sequence.size() <= rowCount; i++)
+        std::array<u64, 256> masks {};
+        for (size_t i = 0; i < std::min<size_t>(sequence.size(), 64); i++)
         {
-            bool match = true;
-            for (size_t j = 0; j < sequence.size() && match; j++)
+            for (u16 value = sequence[i].first; value < sequence[i].second; value++)
             {
-                u8 value = getter(i + j);
-                match = value >= sequence[j].first && value < sequence[j].second;
+                masks[value] |= 1ULL << i;
             }
+        }
 
-            if (match)
-            {
-                matches.emplace_back(i);
-            }
+        // Each thread searches a block of starting rows, reading past the end of its block to finish matches that begin inside it
+        size_t starts = values.size() - sequence.size() + 1;
+        threads = static_cast<int>(std::clamp<size_t>(threads, 1, starts));
+
+        auto *results = new std::vector<size_t>[threads];
+        auto *threadContainer = new std::thread[threads];
+        for (int i = 0; i < threads; i++)
+        {
+            size_t start = starts * i / threads;
+            size_t end = starts * (i + 1) / threads;
+            threadContainer[i] = std::thread([=, &sequence, &masks] { searchRange(values, sequence, masks, start, end, results[i]); });
         }
 
+        for (int i = 0; i < threads; i++)
+        {
+            threadContainer[i].join();
+            matches.insert(matches.end(), results[i].begin(), results[i].end());
+        }
+
+        delete[] threadContainer;
+        delete[] results;
+
         return matches;
     }
 }
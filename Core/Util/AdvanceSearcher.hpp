@@ -21,7 +21,7 @@
 #define ADVANCESEARCHER_HPP
 
 #include <Core/Global.hpp>
-#include <functional>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -29,7 +29,6 @@ namespace AdvanceSearcher
 {
     using Range = std::pair<u8, u8>;
     using Sequence = std::vector<Range>;
-    using ValueGetter = std::function<u8(size_t)>;
 
     enum class ChatotToken : u8
     {
@@ -93,15 +92,16 @@ namespace AdvanceSearcher
     Sequence getNeedleSequence(const std::vector<u8> &tokens);
 
     /**
-     * @brief Searches a row sequence for matching advances
+     * @brief Searches a row sequence for matching advances.
+     * Uses a Shift-And automaton so each row is visited once regardless of the sequence length.
      *
-     * @param rowCount Number of rows to search
+     * @param values Value of each row
      * @param sequence Allowed values for each search position
-     * @param getter Retrieves the value for a given row
+     * @param threads Number of threads to search with
      *
      * @return Matching starting rows
      */
-    std::vector<size_t> findMatches(size_t rowCount, const Sequence &sequence, const ValueGetter &getter);
+    std::vector<size_t> findMatches(std::span<const u8> values, const Sequence &sequence, int threads = 1);
 }
 
 #endif // ADVANCESEARCHER_HPP
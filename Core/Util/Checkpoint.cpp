@@ -0,0 +1,253 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "Checkpoint.hpp"
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+constexpr u32 magic = 0x4b434650; // "PFCK"
+
+/**
+ * @brief Flushes the \p file and waits for its contents to reach the disk
+ *
+ * @param file File to sync
+ *
+ * @return true File was synced
+ * @return false File could not be synced
+ */
+static bool syncFile(FILE *file)
+{
+    if (std::fflush(file) != 0)
+    {
+        return false;
+    }
+#ifdef _WIN32
+    return _commit(_fileno(file)) == 0;
+#else
+    return fsync(fileno(file)) == 0;
+#endif
+}
+
+/**
+ * @brief Waits for the directory entries of the \p directory to reach the disk. Windows has no equivalent, so this does nothing there.
+ *
+ * @param directory Directory to sync
+ */
+static void syncDirectory(const std::filesystem::path &directory)
+{
+#ifndef _WIN32
+    int fd = ::open(directory.empty() ? "." : directory.c_str(), O_RDONLY);
+    if (fd >= 0)
+    {
+        fsync(fd);
+        close(fd);
+    }
+#endif
+}
+
+/**
+ * @brief Appends the \p value to the \p contents
+ *
+ * @tparam Type Value type
+ * @param contents Contents to append to
+ * @param value Value to append
+ */
+template <class Type>
+static void appendValue(std::string &contents, Type value)
+{
+    contents.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+/**
+ * @brief Reads a value from the \p contents at the \p offset and moves the offset past it
+ *
+ * @tparam Type Value type
+ * @param contents Contents to read from
+ * @param offset Offset to read at
+ * @param value Value to store the result in
+ *
+ * @return true Value was read
+ * @return false Contents end before the value
+ */
+template <class Type>
+static bool readValue(const std::string &contents, size_t &offset, Type &value)
+{
+    if (contents.size() - offset < sizeof(value))
+    {
+        return false;
+    }
+    std::memcpy(&value, contents.data() + offset, sizeof(value));
+    offset += sizeof(value);
+    return true;
+}
+
+Checkpoint::Checkpoint(const std::string &file) : file(file), key(0)
+{
+}
+
+bool Checkpoint::isDone(u32 unit) const
+{
+    return unit < done.size() && done[unit];
+}
+
+bool Checkpoint::open(u64 key, u32 units)
+{
+    this->key = key;
+    done.assign(units, 0);
+    data.clear();
+
+    if (!enabled())
+    {
+        return false;
+    }
+
+    std::ifstream stream(file, std::ios_base::in | std::ios_base::binary);
+    std::string contents((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    stream.close();
+
+    size_t offset = 0;
+    u32 fileMagic, fileUnits;
+    u64 fileKey, checksum;
+    if (!readValue(contents, offset, fileMagic) || !readValue(contents, offset, fileKey) || !readValue(contents, offset, fileUnits)
+        || !readValue(contents, offset, checksum) || checksum != hash(fileMagic, fileKey, fileUnits) || fileMagic != magic || fileKey != key
+        || fileUnits != units)
+    {
+        // Start a new checkpoint with only the header, records are appended as units complete
+        std::string header;
+        appendValue(header, magic);
+        appendValue(header, key);
+        appendValue(header, units);
+        appendValue(header, hash(magic, key, units));
+        writeFile(file, header);
+        return false;
+    }
+
+    // A record cut short by a crash and anything after it is dropped
+    size_t valid = offset;
+    for (;;)
+    {
+        u32 unit;
+        u64 size;
+        size_t start = offset;
+        if (!readValue(contents, offset, unit) || !readValue(contents, offset, size) || unit >= units || contents.size() - offset < size)
+        {
+            break;
+        }
+
+        std::string_view record(contents.data() + start, offset - start + size);
+        offset += size;
+        if (!readValue(contents, offset, checksum) || checksum != hash(key, record))
+        {
+            break;
+        }
+
+        done[unit] = 1;
+        data.append(record.substr(sizeof(unit) + sizeof(size)));
+        valid = offset;
+    }
+
+    if (valid != contents.size())
+    {
+        std::error_code error;
+        std::filesystem::resize_file(file, valid, error);
+    }
+
+    return true;
+}
+
+void Checkpoint::remove()
+{
+    if (enabled())
+    {
+        std::error_code error;
+        std::filesystem::remove(file, error);
+    }
+}
+
+bool Checkpoint::write(u32 unit, const std::string &data)
+{
+    if (unit < done.size())
+    {
+        done[unit] = 1;
+    }
+
+    if (!enabled())
+    {
+        return false;
+    }
+
+    std::string record;
+    appendValue(record, unit);
+    appendValue<u64>(record, data.size());
+    record.append(data);
+    appendValue(record, hash(key, std::string_view(record)));
+
+    FILE *stream = std::fopen(file.data(), "ab");
+    if (!stream)
+    {
+        return false;
+    }
+
+    bool written = std::fwrite(record.data(), 1, record.size(), stream) == record.size() && syncFile(stream);
+    return std::fclose(stream) == 0 && written;
+}
+
+bool Checkpoint::writeFile(const std::string &file, const std::string &contents)
+{
+    std::string temp = file + ".tmp";
+    FILE *stream = std::fopen(temp.data(), "wb");
+    if (!stream)
+    {
+        return false;
+    }
+
+    bool written = std::fwrite(contents.data(), 1, contents.size(), stream) == contents.size() && syncFile(stream);
+    if (std::fclose(stream) != 0 || !written)
+    {
+        return false;
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temp, file, error);
+    if (error)
+    {
+        return false;
+    }
+
+    syncDirectory(std::filesystem::path(file).parent_path());
+    return true;
+}
+
+void Checkpoint::hashBytes(u64 &value, const void *bytes, size_t size)
+{
+    const auto *data = static_cast<const u8 *>(bytes);
+    for (size_t i = 0; i < size; i++)
+    {
+        value = (value ^ data[i]) * 0x100000001b3;
+    }
+}
@@ -0,0 +1,191 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef CHECKPOINT_HPP
+#define CHECKPOINT_HPP
+
+#include <Core/Global.hpp>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Records the completed work units of a long running search and the results they produced, so a cancelled or crashed search
+ * can resume where it left off.
+ *
+ * The file starts with a header identifying the search and each completed unit appends one record of its own results, so the cost
+ * of a checkpoint does not grow with the results found so far. Every record ends with a checksum and is synced to disk, so a crash
+ * while appending only loses the record being written.
+ */
+class Checkpoint
+{
+public:
+    /**
+     * @brief Construct a new Checkpoint object
+     *
+     * @param file Path of the checkpoint, empty to disable checkpoints
+     */
+    Checkpoint(const std::string &file = "");
+
+    /**
+     * @brief Computes a key identifying the search parameters. Vectors hash their contents.
+     *
+     * @tparam Args Trivially copyable types or vectors of them
+     * @param args Search parameters
+     *
+     * @return Key
+     */
+    template <class... Args>
+    static u64 hash(const Args &...args)
+    {
+        u64 value = 0xcbf29ce484222325;
+        (hashValue(value, args), ...);
+        return value;
+    }
+
+    /**
+     * @brief Returns if checkpoints are enabled
+     *
+     * @return true Checkpoints are enabled
+     * @return false Checkpoints are disabled
+     */
+    bool enabled() const
+    {
+        return !file.empty();
+    }
+
+    /**
+     * @brief Returns the results of every unit stored by the resumed checkpoint, in the order the units were written
+     *
+     * @return Results
+     */
+    const std::string &getData() const
+    {
+        return data;
+    }
+
+    /**
+     * @brief Determines if the \p unit was completed
+     *
+     * @param unit Unit index
+     *
+     * @return true Unit is complete
+     * @return false Unit is not complete
+     */
+    bool isDone(u32 unit) const;
+
+    /**
+     * @brief Starts a search with \p units work units. An existing checkpoint is resumed if it was made for the same \p key, otherwise
+     * it is replaced by an empty one.
+     *
+     * @param key Key of the search parameters
+     * @param units Number of work units
+     *
+     * @return true Existing checkpoint was resumed
+     * @return false Search starts from the beginning
+     */
+    bool open(u64 key, u32 units);
+
+    /**
+     * @brief Removes the checkpoint file once the search is complete
+     */
+    void remove();
+
+    /**
+     * @brief Marks the \p unit as complete and appends its results to the checkpoint
+     *
+     * @param unit Unit index
+     * @param data Results of the \p unit
+     *
+     * @return true Checkpoint was written
+     * @return false Checkpoint could not be written
+     */
+    bool write(u32 unit, const std::string &data);
+
+    /**
+     * @brief Replaces the \p file with the \p contents. The contents are synced to disk in a temporary file before it is renamed over
+     * the \p file, so a crash leaves either the old or the new contents.
+     *
+     * @param file Path to write to
+     * @param contents File contents
+     *
+     * @return true File was written
+     * @return false File could not be written
+     */
+    static bool writeFile(const std::string &file, const std::string &contents);
+
+private:
+    std::vector<u8> done;
+    std::string data;
+    std::string file;
+    u64 key;
+
+    /**
+     * @brief Adds \p size bytes of \p bytes to the FNV-1a \p value
+     *
+     * @param value Hash value
+     * @param bytes Bytes to hash
+     * @param size Number of bytes
+     */
+    static void hashBytes(u64 &value, const void *bytes, size_t size);
+
+    /**
+     * @brief Adds the \p arg to the FNV-1a \p value
+     *
+     * @tparam Type Trivially copyable type or vector of them
+     * @param value Hash value
+     * @param arg Value to hash
+     */
+    template <class Type>
+    static void hashValue(u64 &value, const Type &arg)
+    {
+        if constexpr (requires { arg.size(); arg.data(); })
+        {
+            using Element = std::remove_cvref_t<decltype(*arg.data())>;
+
+            u64 size = arg.size();
+            hashBytes(value, &size, sizeof(size));
+            if constexpr (std::has_unique_object_representations_v<Element>)
+            {
+                hashBytes(value, arg.data(), size * sizeof(Element));
+            }
+            else
+            {
+                for (const auto &element : arg)
+                {
+                    hashValue(value, element);
+                }
+            }
+        }
+        else if constexpr (requires { arg.first; arg.second; })
+        {
+            hashValue(value, arg.first);
+            hashValue(value, arg.second);
+        }
+        else
+        {
+            static_assert(std::is_trivially_copyable_v<Type> && std::has_unique_object_representations_v<Type>,
+                          "Checkpoint keys can only hash values without padding");
+            hashBytes(value, &arg, sizeof(arg));
+        }
+    }
+};
+
+#endif // CHECKPOINT_HPP
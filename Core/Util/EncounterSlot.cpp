@@ -31,9 +31,9 @@
  * @return Encounter slot table
  */
 template <int size, bool greater = false>
-static consteval std::array<u8, 100> computeTable(const std::array<int, size> &ranges)
+static consteval SlotTable computeTable(const std::array<int, size> &ranges)
 {
-    std::array<u8, 100> table;
+    SlotTable table;
 
     int r = greater ? 99 : 0;
     for (int i = 0; i < size; i++)
@@ -73,21 +73,21 @@ constexpr auto water4 = computeTable<5>(std::array<int, 5> { 60, 90, 95, 99, 100
 
 // BW Lucky Power
 // clang-format off
-constexpr std::array<std::array<u8, 100>, 4> grassBW = {
+constexpr std::array<SlotTable, 4> grassBW = {
     grass,
     computeTable<12>(std::array<int, 12> { 10, 20, 30, 40, 50, 60, 70, 80, 85, 90, 95, 100 }),
     computeTable<12>(std::array<int, 12> { 5, 10, 15, 20, 30, 40, 50, 60, 70, 80, 90, 100 }),
     computeTable<12>(std::array<int, 12> { 1, 2, 6, 10, 15, 20, 30, 40, 50, 60, 80, 100 })
 };
 
-constexpr std::array<std::array<u8, 100>, 4> surfBW = {
+constexpr std::array<SlotTable, 4> surfBW = {
     water4,
     computeTable<5>(std::array<int, 5> { 50, 80, 90, 95, 100 }),
     computeTable<5>(std::array<int, 5> { 40, 70, 80, 90, 100 }),
     computeTable<5>(std::array<int, 5> { 30, 50, 60, 80, 100 })
 };
 
-constexpr std::array<std::array<u8, 100>, 4> fishBW = {
+constexpr std::array<SlotTable, 4> fishBW = {
     water2,
     computeTable<5>(std::array<int, 5> { 40, 75, 90, 95, 100 }),
     computeTable<5>(std::array<int, 5> { 30, 60, 80, 90, 100 }),
@@ -98,88 +98,113 @@ constexpr std::array<std::array<u8, 100>, 4> fishBW = {
 namespace EncounterSlot
 {
     u8 hSlot(u8 rand, Encounter encounter)
+    {
+        return hTable(encounter)[rand];
+    }
+
+    const SlotTable &hTable(Encounter encounter)
     {
         switch (encounter)
         {
         case Encounter::OldRod:
-            return water0[rand];
+            return water0;
         case Encounter::GoodRod:
-            return water1[rand];
+            return water1;
         case Encounter::SuperRod:
-            return water2[rand];
+            return water2;
         case Encounter::Surfing:
         case Encounter::RockSmash:
-            return water4[rand];
+            return water4;
         default:
-            return grass[rand];
+            return grass;
         }
     }
 
     u8 jSlot(u8 rand, Encounter encounter)
+    {
+        return jTable(encounter)[rand];
+    }
+
+    const SlotTable &jTable(Encounter encounter)
     {
         switch (encounter)
         {
         case Encounter::GoodRod:
         case Encounter::SuperRod:
-            return water2[rand];
+            return water2;
         case Encounter::OldRod:
         case Encounter::Surfing:
-            return water4[rand];
+            return water4;
         default:
-            return grass[rand];
+            return grass;
         }
     }
 
     u8 kSlot(u8 rand, Encounter encounter)
+    {
+        return kTable(encounter)[rand];
+    }
+
+    const SlotTable &kTable(Encounter encounter)
     {
         switch (encounter)
         {
         case Encounter::OldRod:
         case Encounter::GoodRod:
         case Encounter::SuperRod:
-            return water3[rand];
+            return water3;
         case Encounter::Surfing:
-            return water4[rand];
+            return water4;
         case Encounter::BugCatchingContest:
-            return bug[rand];
+            return bug;
         case Encounter::Headbutt:
         case Encounter::HeadbuttAlt:
         case Encounter::HeadbuttSpecial:
-            return headbutt[rand];
+            return headbutt;
         case Encounter::RockSmash:
-            return rocksmash[rand];
+            return rocksmash;
         default:
-            return grass[rand];
+            return grass;
         }
     }
 
     u8 bwSlot(u8 rand, Encounter encounter, u8 luckyPower)
+    {
+        return bwTable(encounter, luckyPower)[rand];
+    }
+
+    const SlotTable &bwTable(Encounter encounter, u8 luckyPower)
     {
         switch (encounter)
         {
         case Encounter::SuperRod:
         case Encounter::SuperRodRippling:
-            return fishBW[luckyPower][rand];
+            return fishBW[luckyPower];
         case Encounter::Surfing:
         case Encounter::SurfingRippling:
-            return surfBW[luckyPower][rand];
+            return surfBW[luckyPower];
         default:
-            return grassBW[luckyPower][rand];
+            return grassBW[luckyPower];
         }
     }
 
     u8 bdspSlot(u8 rand, Encounter encounter)
+    {
+        return bdspTable(encounter)[rand];
+    }
+
+    const SlotTable &bdspTable(Encounter encounter)
     {
         switch (encounter)
         {
         case Encounter::GoodRod:
         case Encounter::SuperRod:
-            return water2[rand];
+            return water2;
         case Encounter::OldRod:
         case Encounter::Surfing:
-            return water4[rand];
+            return water4;
         default:
-            return grass[rand];
+            return grass;
         }
     }
 }
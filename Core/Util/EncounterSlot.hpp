@@ -21,9 +21,15 @@
 #define ENCOUNTERSLOT_HPP
 
 #include <Core/Global.hpp>
+#include <array>
 
 enum class Encounter : u8;
 
+/**
+ * @brief Encounter slot of each PRNG call in [0, 100)
+ */
+using SlotTable = std::array<u8, 100>;
+
 namespace EncounterSlot
 {
     /**
@@ -36,6 +42,15 @@ namespace EncounterSlot
      */
     u8 hSlot(u8 rand, Encounter encounter);
 
+    /**
+     * @brief Returns the encounter slot table for Gen 3
+     *
+     * @param encounter Encounter type
+     *
+     * @return Encounter slot table
+     */
+    const SlotTable &hTable(Encounter encounter);
+
     /**
      * @brief Calculates the encounter slot for DPPt
      *
@@ -46,6 +61,15 @@ namespace EncounterSlot
      */
     u8 jSlot(u8 rand, Encounter encounter);
 
+    /**
+     * @brief Returns the encounter slot table for DPPt
+     *
+     * @param encounter Encounter type
+     *
+     * @return Encounter slot table
+     */
+    const SlotTable &jTable(Encounter encounter);
+
     /**
      * @brief Calculates the encounter slot for HGSS
      *
@@ -56,6 +80,15 @@ namespace EncounterSlot
      */
     u8 kSlot(u8 rand, Encounter encounter);
 
+    /**
+     * @brief Returns the encounter slot table for HGSS
+     *
+     * @param encounter Encounter type
+     *
+     * @return Encounter slot table
+     */
+    const SlotTable &kTable(Encounter encounter);
+
     /**
      * @brief Calculates the encounter slot for BW/BW2
      *
@@ -67,6 +100,16 @@ namespace EncounterSlot
      */
     u8 bwSlot(u8 rand, Encounter encounter, u8 luckyPower);
 
+    /**
+     * @brief Returns the encounter slot table for BW/BW2
+     *
+     * @param encounter Encounter type
+     * @param luckyPower Lucky power level
+     *
+     * @return Encounter slot table
+     */
+    const SlotTable &bwTable(Encounter encounter, u8 luckyPower);
+
     /**
      * @brief Calculates the encounter slot for BDSP
      *
@@ -76,6 +119,15 @@ namespace EncounterSlot
      * @return Encounter slot
      */
     u8 bdspSlot(u8 rand, Encounter encounter);
+
+    /**
+     * @brief Returns the encounter slot table for BDSP
+     *
+     * @param encounter Encounter type
+     *
+     * @return Encounter slot table
+     */
+    const SlotTable &bdspTable(Encounter encounter);
 };
 
 #endif // ENCOUNTERSLOT_HPP
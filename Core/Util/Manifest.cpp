@@ -0,0 +1,109 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "Manifest.hpp"
+#include <Core/Util/Checkpoint.hpp>
+#include <fstream>
+#include <nlohmann/json.hpp>
+
+using json = nlohmann::json;
+
+Manifest::Manifest(const std::string &type, u64 key, const std::vector<WorkUnit> &units) :
+    units(units),
+    done(units.size()),
+    type(type),
+    end(units.empty() ? 0 : units.back().end),
+    key(key),
+    start(units.empty() ? 0 : units.front().start)
+{
+}
+
+bool Manifest::isDone(u32 unit) const
+{
+    return unit < done.size() && done[unit];
+}
+
+bool Manifest::matches(const Manifest &other) const
+{
+    return type == other.type && key == other.key && start == other.start && end == other.end && units.size() == other.units.size();
+}
+
+bool Manifest::read(std::string_view file)
+{
+    std::ifstream stream(file.data());
+    json j = json::parse(stream, nullptr, false);
+    if (j.is_discarded() || !j.is_object())
+    {
+        return false;
+    }
+
+    try
+    {
+        type = j["type"].get<std::string>();
+        key = j["key"].get<u64>();
+        start = j["start"].get<u64>();
+        end = j["end"].get<u64>();
+        if (j["units"].empty() || end < start)
+        {
+            return false;
+        }
+        units = Shard::split(start, end, j["units"].size());
+
+        done.assign(units.size(), false);
+        for (u32 i = 0; i < units.size(); i++)
+        {
+            const json &unit = j["units"][i];
+            if (unit["start"].get<u64>() != units[i].start || unit["end"].get<u64>() != units[i].end)
+            {
+                return false;
+            }
+            done[i] = unit["done"].get<bool>();
+        }
+    }
+    catch (const json::exception &)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+void Manifest::setDone(u32 unit)
+{
+    if (unit < done.size())
+    {
+        done[unit] = true;
+    }
+}
+
+bool Manifest::write(std::string_view file) const
+{
+    json j;
+    j["type"] = type;
+    j["key"] = key;
+    j["start"] = start;
+    j["end"] = end;
+    j["units"] = json::array();
+    for (const auto &unit : units)
+    {
+        j["units"].push_back({ { "index", unit.index }, { "start", unit.start }, { "end", unit.end }, { "done", isDone(unit.index) } });
+    }
+
+    return Checkpoint::writeFile(std::string(file), j.dump(2));
+}
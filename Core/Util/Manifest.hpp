@@ -0,0 +1,123 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef MANIFEST_HPP
+#define MANIFEST_HPP
+
+#include <Core/Util/Shard.hpp>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Describes the work units of a sharded search and which of them are complete
+ */
+class Manifest
+{
+public:
+    /**
+     * @brief Construct a new empty Manifest object
+     */
+    Manifest() = default;
+
+    /**
+     * @brief Construct a new Manifest object where all the \p units are pending
+     *
+     * @param type Search type
+     * @param key Key of the search parameters from Checkpoint::hash
+     * @param units Work units from Shard::split
+     */
+    Manifest(const std::string &type, u64 key, const std::vector<WorkUnit> &units);
+
+    /**
+     * @brief Returns the search type
+     *
+     * @return Search type
+     */
+    std::string getType() const
+    {
+        return type;
+    }
+
+    /**
+     * @brief Returns the work units
+     *
+     * @return Work units
+     */
+    const std::vector<WorkUnit> &getUnits() const
+    {
+        return units;
+    }
+
+    /**
+     * @brief Determines if the \p unit is complete
+     *
+     * @param unit Unit index
+     *
+     * @return true Unit is complete
+     * @return false Unit is not complete
+     */
+    bool isDone(u32 unit) const;
+
+    /**
+     * @brief Determines if the \p other manifest describes the same search parameters and units
+     *
+     * @param other Manifest to compare
+     *
+     * @return true Manifests describe the same search
+     * @return false Manifests describe different searches
+     */
+    bool matches(const Manifest &other) const;
+
+    /**
+     * @brief Reads the manifest from the \p file
+     *
+     * @param file Path to read from
+     *
+     * @return true Manifest was read
+     * @return false File is missing or invalid
+     */
+    bool read(std::string_view file);
+
+    /**
+     * @brief Marks the \p unit as complete
+     *
+     * @param unit Unit index
+     */
+    void setDone(u32 unit);
+
+    /**
+     * @brief Writes the manifest to the \p file with Checkpoint::writeFile, so an interrupted write never leaves a partial manifest
+     *
+     * @param file Path to write to
+     *
+     * @return true Manifest was written
+     * @return false Manifest could not be written
+     */
+    bool write(std::string_view file) const;
+
+private:
+    std::vector<WorkUnit> units;
+    std::vector<bool> done;
+    std::string type;
+    u64 end = 0;
+    u64 key = 0;
+    u64 start = 0;
+};
+
+#endif // MANIFEST_HPP
@@ -0,0 +1,72 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include <Core/Global.hpp>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Splits the advances [0, \p count) into a block per thread and generates each block on its own thread.
+ * Each block is expected to jump its own RNG to the start of the block. The results are concatenated in order.
+ *
+ * @tparam State State class that is generated
+ * @tparam Function Function that generates the states of the advances [start, end)
+ * @param count Number of advances
+ * @param threads Number of threads
+ * @param function Block generation function
+ *
+ * @return Vector of computed states
+ */
+template <class State, class Function>
+std::vector<State> generateParallel(u64 count, int threads, const Function &function)
+{
+    // Keep blocks large enough that jumping each RNG into place stays negligible
+    threads = static_cast<int>(std::clamp<u64>(count / 0x4000, 1, std::max(threads, 1)));
+    if (threads == 1)
+    {
+        return function(0, count);
+    }
+
+    auto *results = new std::vector<State>[threads];
+    auto *threadContainer = new std::thread[threads];
+    for (int i = 0; i < threads; i++)
+    {
+        u64 start = count * i / threads;
+        u64 end = count * (i + 1) / threads;
+        threadContainer[i] = std::thread([=, &function] { results[i] = function(start, end); });
+    }
+
+    std::vector<State> states;
+    for (int i = 0; i < threads; i++)
+    {
+        threadContainer[i].join();
+        states.insert(states.end(), results[i].begin(), results[i].end());
+    }
+
+    delete[] threadContainer;
+    delete[] results;
+
+    return states;
+}
+
+#endif // PARALLEL_HPP
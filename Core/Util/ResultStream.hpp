@@ -0,0 +1,292 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef RESULTSTREAM_HPP
+#define RESULTSTREAM_HPP
+
+#include <Core/Global.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief File of results that keeps a bounded number of rows in memory.
+ *
+ * Rows are written as raw records, so the file is only meaningful to the process that wrote it (states hold pointers to static
+ * data). Reads are served from a small cache of pages. Every member locks the file, use at() when reading from several threads.
+ *
+ * @tparam Item Trivially copyable result type
+ */
+template <class Item>
+class ResultStream
+{
+    static constexpr size_t pageSize = 4096;
+    static constexpr size_t pageCount = 8;
+    static constexpr u32 magic = 0x52534650; // "PFSR"
+
+    /**
+     * @brief Cached rows of the file. Rows are kept as raw bytes so that row types do not need to be default constructible.
+     */
+    struct Page
+    {
+        std::unique_ptr<std::byte[]> data;
+        size_t size = 0;
+        size_t index = 0;
+        u64 lastUse = 0;
+    };
+
+public:
+    /**
+     * @brief Construct a new ResultStream object. Any existing file at \p path is truncated.
+     *
+     * @param path File to write to
+     */
+    ResultStream(const std::string &path) : path(path), count(0), useCounter(0)
+    {
+        file.open(path, std::ios_base::in | std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+        if (file.is_open())
+        {
+            u32 header[2] = { magic, sizeof(Item) };
+            file.write(reinterpret_cast<const char *>(header), sizeof(header));
+        }
+    }
+
+    /**
+     * @brief Destroy the ResultStream object and removes its file
+     */
+    ~ResultStream()
+    {
+        file.close();
+        std::remove(path.data());
+    }
+
+    /**
+     * @brief Appends \p items to the end of the file
+     *
+     * @param items Items to append
+     */
+    void append(const std::vector<Item> &items)
+    {
+        static_assert(std::is_trivially_copyable_v<Item>, "ResultStream requires trivially copyable items");
+
+        if (items.empty())
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        file.seekp(offset(count));
+        file.write(reinterpret_cast<const char *>(items.data()), items.size() * sizeof(Item));
+        file.flush();
+
+        // The last page may have been cached while it was still partially filled
+        invalidate(count);
+        count += items.size();
+    }
+
+    /**
+     * @brief Returns a copy of the item at \p row. Safe to call from several threads.
+     *
+     * @param row Row to read
+     *
+     * @return Item
+     */
+    Item at(size_t row) const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return read(row);
+    }
+
+    /**
+     * @brief Removes the item at \p row by moving every following row back by one
+     *
+     * @param row Row to remove
+     */
+    void erase(size_t row)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<char> buffer;
+        for (size_t start = row + 1; start < count; start += pageSize)
+        {
+            buffer.resize(std::min(pageSize, count - start) * sizeof(Item));
+            file.seekg(offset(start));
+            file.read(buffer.data(), buffer.size());
+            file.seekp(offset(start - 1));
+            file.write(buffer.data(), buffer.size());
+        }
+        file.flush();
+
+        invalidate(row);
+        count--;
+    }
+
+    /**
+     * @brief Returns if the file was opened successfully
+     *
+     * @return true File is open
+     * @return false File is not open
+     */
+    bool good() const
+    {
+        return file.is_open() && file.good();
+    }
+
+    /**
+     * @brief Returns the item at \p row. The reference is only valid until the next read, so this must not be used while other
+     * threads read the file.
+     *
+     * @param row Row to read
+     *
+     * @return Item
+     */
+    const Item &operator[](size_t row) const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return read(row);
+    }
+
+    /**
+     * @brief Replaces the item at \p row
+     *
+     * @param row Row to replace
+     * @param item New item
+     */
+    void set(size_t row, const Item &item)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        file.seekp(offset(row));
+        file.write(reinterpret_cast<const char *>(&item), sizeof(Item));
+        file.flush();
+
+        for (auto &page : pages)
+        {
+            if (page.index == row / pageSize)
+            {
+                page.size = 0;
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the number of rows in the file
+     *
+     * @return Number of rows
+     */
+    size_t size() const
+    {
+        return count;
+    }
+
+private:
+    mutable std::array<Page, pageCount> pages;
+    mutable std::fstream file;
+    std::string path;
+    size_t count;
+    mutable std::mutex mutex;
+    mutable u64 useCounter;
+
+    /**
+     * @brief Drops every cached page that holds \p row or a later row
+     *
+     * @param row First changed row
+     */
+    void invalidate(size_t row)
+    {
+        for (auto &page : pages)
+        {
+            if ((page.index + 1) * pageSize > row)
+            {
+                page.size = 0;
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the item at \p row, loading its page when it is not cached. The caller must hold the lock.
+     *
+     * @param row Row to read
+     *
+     * @return Item
+     */
+    const Item &read(size_t row) const
+    {
+        size_t index = row / pageSize;
+
+        Page *target = nullptr;
+        for (auto &page : pages)
+        {
+            if (page.size != 0 && page.index == index)
+            {
+                target = &page;
+                break;
+            }
+        }
+
+        if (!target)
+        {
+            target = &pages[0];
+            for (auto &page : pages)
+            {
+                if (page.size == 0 || page.lastUse < target->lastUse)
+                {
+                    target = &page;
+                    if (page.size == 0)
+                    {
+                        break;
+                    }
+                }
+            }
+
+            if (!target->data)
+            {
+                target->data = std::make_unique<std::byte[]>(pageSize * sizeof(Item));
+            }
+
+            size_t start = index * pageSize;
+            target->index = index;
+            target->size = std::min(pageSize, count - start);
+            file.seekg(offset(start));
+            file.read(reinterpret_cast<char *>(target->data.get()), target->size * sizeof(Item));
+        }
+
+        target->lastUse = ++useCounter;
+        return *std::launder(reinterpret_cast<const Item *>(target->data.get() + (row % pageSize) * sizeof(Item)));
+    }
+
+    /**
+     * @brief Computes the file offset of \p row
+     *
+     * @param row Row index
+     *
+     * @return File offset
+     */
+    static std::streamoff offset(size_t row)
+    {
+        return 2 * sizeof(u32) + row * sizeof(Item);
+    }
+};
+
+#endif // RESULTSTREAM_HPP
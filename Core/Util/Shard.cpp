@@ -0,0 +1,72 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "Shard.hpp"
+#include <algorithm>
+
+Shard::Shard(u32 index, u32 count) : count(std::max(count, 1u)), index(index)
+{
+}
+
+Shard::Shard(const std::vector<u32> &units) : units(units), count(0), index(0)
+{
+    std::ranges::sort(this->units);
+}
+
+bool Shard::contains(u32 unit) const
+{
+    if (count == 0)
+    {
+        return std::ranges::binary_search(units, unit);
+    }
+    return unit % count == index;
+}
+
+std::vector<WorkUnit> Shard::getUnits(const std::vector<WorkUnit> &units) const
+{
+    std::vector<WorkUnit> selected;
+    for (const auto &unit : units)
+    {
+        if (contains(unit.index))
+        {
+            selected.emplace_back(unit);
+        }
+    }
+    return selected;
+}
+
+std::vector<WorkUnit> Shard::split(u64 start, u64 end, u32 count)
+{
+    u64 length = end - start + 1;
+    count = std::clamp<u64>(count, 1, length);
+
+    // The first length % count units get the remainder so the sizes differ by at most one
+    u64 size = length / count;
+    u64 extra = length % count;
+
+    std::vector<WorkUnit> units;
+    units.reserve(count);
+    for (u32 i = 0; i < count; i++)
+    {
+        u64 unitSize = size + (i < extra);
+        units.emplace_back(i, start, start + unitSize - 1);
+        start += unitSize;
+    }
+    return units;
+}
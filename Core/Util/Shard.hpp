@@ -0,0 +1,94 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SHARD_HPP
+#define SHARD_HPP
+
+#include <Core/Global.hpp>
+#include <vector>
+
+/**
+ * @brief Contiguous piece of a search range
+ */
+struct WorkUnit
+{
+    u32 index;
+    u64 start;
+    u64 end;
+};
+
+/**
+ * @brief Selects which work units of a search a process is responsible for
+ */
+class Shard
+{
+public:
+    /**
+     * @brief Construct a new Shard object that selects every \p count unit starting at \p index
+     *
+     * @param index Shard index
+     * @param count Number of shards
+     */
+    Shard(u32 index = 0, u32 count = 1);
+
+    /**
+     * @brief Construct a new Shard object that selects an explicit list of units
+     *
+     * @param units Unit indexes
+     */
+    Shard(const std::vector<u32> &units);
+
+    /**
+     * @brief Determines if the \p unit belongs to the shard
+     *
+     * @param unit Unit index
+     *
+     * @return true Unit belongs to the shard
+     * @return false Unit does not belong to the shard
+     */
+    bool contains(u32 unit) const;
+
+    /**
+     * @brief Returns the \p units that belong to the shard
+     *
+     * @param units Work units of the whole search
+     *
+     * @return Work units of the shard
+     */
+    std::vector<WorkUnit> getUnits(const std::vector<WorkUnit> &units) const;
+
+    /**
+     * @brief Splits the inclusive range between \p start and \p end into \p count units. The split only depends on the arguments so
+     * every process computes the same units.
+     *
+     * @param start First value of the range
+     * @param end Last value of the range
+     * @param count Number of units
+     *
+     * @return Work units
+     */
+    static std::vector<WorkUnit> split(u64 start, u64 end, u32 count);
+
+private:
+    std::vector<u32> units;
+    u32 count;
+    u32 index;
+};
+
+#endif // SHARD_HPP
@@ -0,0 +1,109 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "Startup.hpp"
+#include <mutex>
+#include <thread>
+
+using Clock = std::chrono::steady_clock;
+
+static const Clock::time_point loaded = Clock::now();
+static std::chrono::microseconds last(0);
+static std::function<void(const StartupStage &)> hook;
+static std::mutex mutex;
+static std::vector<StartupStage> stages;
+static std::vector<std::thread> threads;
+
+/**
+ * @brief Stores the \p stage and passes it to the hook
+ *
+ * @param stage Stage to record
+ */
+static void record(const StartupStage &stage)
+{
+    std::function<void(const StartupStage &)> callback;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stages.emplace_back(stage);
+        callback = hook;
+    }
+
+    if (callback)
+    {
+        callback(stage);
+    }
+}
+
+namespace Startup
+{
+    void background(const std::string &name, std::function<void()> function)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        threads.emplace_back([name, function = std::move(function)] {
+            auto start = elapsed();
+            function();
+            record(StartupStage { name, start, elapsed() - start, true });
+        });
+    }
+
+    std::chrono::microseconds elapsed()
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - loaded);
+    }
+
+    bool finish()
+    {
+        auto total = elapsed();
+        record(StartupStage { "Startup", std::chrono::microseconds(0), total, false });
+        return total <= budget;
+    }
+
+    std::vector<StartupStage> getStages()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return stages;
+    }
+
+    void mark(const std::string &name)
+    {
+        auto now = elapsed();
+        record(StartupStage { name, last, now - last, false });
+        last = now;
+    }
+
+    void setHook(std::function<void(const StartupStage &)> hook)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ::hook = std::move(hook);
+    }
+
+    void wait()
+    {
+        std::vector<std::thread> running;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            running.swap(threads);
+        }
+
+        for (auto &thread : running)
+        {
+            thread.join();
+        }
+    }
+}
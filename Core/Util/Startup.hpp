@@ -0,0 +1,101 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef STARTUP_HPP
+#define STARTUP_HPP
+
+#include <Core/Global.hpp>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Timing of a single startup stage
+ */
+struct StartupStage
+{
+    std::string name;
+    std::chrono::microseconds start;
+    std::chrono::microseconds duration;
+    bool background;
+};
+
+/**
+ * @brief Records how long each stage of application startup takes and runs stages that are not needed by the first window in the
+ * background. Times are relative to when the program was loaded.
+ */
+namespace Startup
+{
+    /**
+     * @brief Time the application should take to show its main window on a cold start
+     */
+    constexpr std::chrono::milliseconds budget(500);
+
+    /**
+     * @brief Runs the \p function on a background thread and records it as a stage once it finishes
+     *
+     * @param name Stage name
+     * @param function Stage function
+     */
+    void background(const std::string &name, std::function<void()> function);
+
+    /**
+     * @brief Returns the time since the program was loaded
+     *
+     * @return Elapsed time
+     */
+    std::chrono::microseconds elapsed();
+
+    /**
+     * @brief Records the total startup time as the "Startup" stage
+     *
+     * @return true Startup finished within the budget
+     * @return false Startup took longer than the budget
+     */
+    bool finish();
+
+    /**
+     * @brief Returns every stage recorded so far
+     *
+     * @return Vector of stages
+     */
+    std::vector<StartupStage> getStages();
+
+    /**
+     * @brief Records a stage that started when the previous foreground stage ended and ends now
+     *
+     * @param name Stage name
+     */
+    void mark(const std::string &name);
+
+    /**
+     * @brief Sets a function that is called with each stage as it is recorded. Background stages call it from their own thread.
+     *
+     * @param hook Instrumentation function
+     */
+    void setHook(std::function<void(const StartupStage &)> hook);
+
+    /**
+     * @brief Waits for every background stage to finish
+     */
+    void wait();
+}
+
+#endif // STARTUP_HPP
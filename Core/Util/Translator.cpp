@@ -26,6 +26,8 @@
 #include <bit>
 #include <iterator>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <nlohmann/json.hpp>
 
 using json = nlohmann::json;
@@ -67,33 +69,82 @@ enum class Translation : u8
     Count
 };
 
+/**
+ * @brief String table that is read from the i18n data the first time it is used
+ *
+ * @tparam Table Type of the string table
+ */
+template <class Table>
+class LazyTable
+{
+public:
+    /**
+     * @brief Returns the string table, reading it with \p read if this is the first use
+     *
+     * @tparam Read Function that returns the string table
+     * @param read Function that returns the string table
+     *
+     * @return String table
+     */
+    template <class Read>
+    const Table &get(const Read &read)
+    {
+        std::call_once(flag, [this, &read] { table = read(); });
+        return table;
+    }
+
+private:
+    std::once_flag flag;
+    Table table;
+};
+
+template <class Table>
+using LanguageTables = std::array<LazyTable<Table>, static_cast<int>(Language::Count)>;
+
 static Language language;
-static std::vector<std::string> abilities;
-static std::array<std::vector<std::string>, 5> characteristics;
-static std::map<u16, std::string> forms;
-static std::vector<std::string> games;
-static std::vector<std::string> hiddenPowers;
-static std::map<u16, std::string> items;
-static std::vector<std::string> moves;
-static std::vector<std::string> natures;
-static std::vector<std::string> species;
+static LanguageTables<std::vector<std::string>> abilities;
+static LanguageTables<std::array<std::vector<std::string>, 5>> characteristics;
+static LanguageTables<std::map<u16, std::string>> forms;
+static LanguageTables<std::vector<std::string>> games;
+static LanguageTables<std::vector<std::string>> hiddenPowers;
+static LanguageTables<std::map<u16, std::string>> items;
+static std::array<LanguageTables<std::map<u16, std::string>>, static_cast<int>(Translation::Count)> locations;
+static LanguageTables<std::vector<std::string>> moves;
+static LanguageTables<std::vector<std::string>> natures;
+static LanguageTables<std::vector<std::string>> species;
 const static std::array<std::string, 3> genders = { "♂", "♀", "-" };
 const static std::array<std::string, 12> buttons = { "R", "L", "X", "Y", "A", "B", "Select", "Start", "Right", "Left", "Up", "Down" };
 const static std::array<std::string, 8> needles = { "↑", "↗", "→", "↘", "↓", "↙", "←", "↖" };
 
+/**
+ * @brief Returns the decompressed i18n data. It is decompressed once and kept for every later string table.
+ *
+ * @return Text of every string table
+ */
+static const char *getI18N()
+{
+    static const std::unique_ptr<const char[]> data([] {
+        u32 size;
+        return Utilities::decompress<char>(I18N.data(), I18N.size(), size);
+    }());
+    return data.get();
+}
+
 /**
  * @brief Reads strings from the \p translation in the languaged specified by Translator::init()
  *
- * @param data Text to read from
  * @param translation String category to read from
- * @param strings Vector to write strings out to
+ *
+ * @return Vector of translated strings
  */
-static void readFile(const char *data, Translation translation, std::vector<std::string> &strings)
+static std::vector<std::string> readStrings(Translation translation)
 {
+    const char *data = getI18N();
     int index = (static_cast<int>(language) * static_cast<int>(Translation::Count)) + static_cast<int>(translation);
     u32 start = INDICES[index];
     u32 end = INDICES[index + 1];
 
+    std::vector<std::string> strings;
     for (u32 i = start; i < end;)
     {
         const char *it = std::find(data + i, data + end, 0);
@@ -101,16 +152,20 @@ static void readFile(const char *data, Translation translation, std::vector<std:
         strings.emplace_back(data + i, len);
         i += len + 1;
     }
+
+    return strings;
 }
 
 /**
  * @brief Reads characteristic strings in the languaged specified by Translator::init()
  *
- * @param data Text to read from
- * @param strings Vector to write strings out to
+ * @return Characteristic strings of each generation
  */
-static void readFile(const char *data, std::array<std::vector<std::string>, 5> &strings)
+static std::array<std::vector<std::string>, 5> readCharacteristics()
 {
+    const char *data = getI18N();
+    std::array<std::vector<std::string>, 5> strings;
+
     int index = (static_cast<int>(language) * static_cast<int>(Translation::Count)) + static_cast<int>(Translation::Characteristic);
     u32 start = INDICES[index];
     u32 end = INDICES[index + 1];
@@ -126,18 +181,20 @@ static void readFile(const char *data, std::array<std::vector<std::string>, 5> &
             }
         }
     }
+
+    return strings;
 }
 
 /**
  * @brief Reads string mapping from the \p translation in the languaged specified by Translator::init()
  *
- * @param data Text to read from
  * @param translation String category to read from
  *
  * @return Map of translated strings
  */
-static std::map<u16, std::string> readFile(const char *data, Translation translation)
+static std::map<u16, std::string> readMap(Translation translation)
 {
+    const char *data = getI18N();
     int index = (static_cast<int>(language) * static_cast<int>(Translation::Count)) + static_cast<int>(translation);
     u32 start = INDICES[index];
     u32 end = INDICES[index + 1];
@@ -158,6 +215,47 @@ static std::map<u16, std::string> readFile(const char *data, Translation transla
     return strings;
 }
 
+/**
+ * @brief Returns the strings of the \p translation in the current language, reading them on first use
+ *
+ * @param tables Tables of each language
+ * @param translation String category to read from
+ *
+ * @return Vector of translated strings
+ */
+static const std::vector<std::string> &getStrings(LanguageTables<std::vector<std::string>> &tables, Translation translation)
+{
+    return tables[static_cast<int>(language)].get([translation] { return readStrings(translation); });
+}
+
+/**
+ * @brief Returns the string mapping of the \p translation in the current language, reading it on first use
+ *
+ * @param tables Tables of each language
+ * @param translation String category to read from
+ *
+ * @return Map of translated strings
+ */
+static const std::map<u16, std::string> &getMap(LanguageTables<std::map<u16, std::string>> &tables, Translation translation)
+{
+    return tables[static_cast<int>(language)].get([translation] { return readMap(translation); });
+}
+
+/**
+ * @brief Returns the string from the \p map, or an empty string if it has none for \p num
+ *
+ * @param map Map of translated strings
+ * @param num String number
+ *
+ * @return Translated string
+ */
+static const std::string &findString(const std::map<u16, std::string> &map, u16 num)
+{
+    static const std::string empty;
+    auto it = map.find(num);
+    return it != map.end() ? it->second : empty;
+}
+
 namespace Translator
 {
     CharacteristicGeneration getCharacteristicGeneration(Game version)
@@ -186,17 +284,17 @@ namespace Translator
 
     const std::string &getAbility(u16 ability)
     {
-        return abilities[ability - 1];
+        return getStrings(abilities, Translation::Ability)[ability - 1];
     }
 
     const std::string &getCharacteristic(u8 characteristic, CharacteristicGeneration generation)
     {
-        return characteristics[static_cast<u8>(generation)][characteristic];
+        return getCharacteristics(generation)[characteristic];
     }
 
     const std::vector<std::string> &getCharacteristics(CharacteristicGeneration generation)
     {
-        return characteristics[static_cast<u8>(generation)];
+        return characteristics[static_cast<int>(language)].get(readCharacteristics)[static_cast<u8>(generation)];
     }
 
     const std::vector<std::string> &getCharacteristics(Game version)
@@ -206,21 +304,20 @@ namespace Translator
 
     const std::string &getForm(u16 specie, u8 form)
     {
-        static const std::string empty;
-        auto it = forms.find((form << 11) | specie);
-        return it != forms.end() ? it->second : empty;
+        return findString(getMap(forms, Translation::Form), (form << 11) | specie);
     }
 
     const std::string &getGame(Game version)
     {
         // Strings are ordered to match the enum
         // Use countr_zero to get the bit that is set
+        const auto &strings = getStrings(games, Translation::Game);
         int index = std::countr_zero(toInt(version));
         if (index == 32)
         {
-            return games[games.size() - 1];
+            return strings[strings.size() - 1];
         }
-        return games[index];
+        return strings[index];
     }
 
     const std::string &getGender(u8 gender)
@@ -235,24 +332,25 @@ namespace Translator
 
     const std::string &getHiddenPower(u8 power)
     {
-        return hiddenPowers[power];
+        return getStrings(hiddenPowers, Translation::Power)[power];
     }
 
     const std::vector<std::string> &getHiddenPowers()
     {
-        return hiddenPowers;
+        return getStrings(hiddenPowers, Translation::Power);
     }
 
     const std::string &getItem(u16 item)
     {
-        return items[item];
+        return findString(getMap(items, Translation::Item), item);
     }
 
     std::vector<std::string> getItems(const std::vector<u16> &item)
     {
         std::vector<std::string> s;
         s.reserve(item.size());
-        std::ranges::transform(item, std::back_inserter(s), [](u16 num) { return items[num]; });
+        const auto &map = getMap(items, Translation::Item);
+        std::ranges::transform(item, std::back_inserter(s), [&map](u16 num) { return findString(map, num); });
         return s;
     }
 
@@ -329,32 +427,27 @@ namespace Translator
             translation = Translation::BDSP;
         }
 
-        u32 size;
-        auto *data = Utilities::decompress<char>(I18N.data(), I18N.size(), size);
-
-        std::map<u16, std::string> map = readFile(data, translation);
-        std::vector<std::string> locations;
-        locations.reserve(nums.size());
-        std::ranges::transform(nums, std::back_inserter(locations), [&map](u16 num) { return map[num]; });
-
-        delete[] data;
+        const auto &map = getMap(locations[static_cast<int>(translation)], translation);
+        std::vector<std::string> strings;
+        strings.reserve(nums.size());
+        std::ranges::transform(nums, std::back_inserter(strings), [&map](u16 num) { return findString(map, num); });
 
-        return locations;
+        return strings;
     }
 
     const std::string &getMove(u16 move)
     {
-        return moves[move];
+        return getStrings(moves, Translation::Move)[move];
     }
 
     const std::string &getNature(u8 nature)
     {
-        return natures[nature];
+        return getStrings(natures, Translation::Nature)[nature];
     }
 
     const std::vector<std::string> &getNatures()
     {
-        return natures;
+        return getStrings(natures, Translation::Nature);
     }
 
     const std::string &getNeedle(u8 needle)
@@ -364,19 +457,19 @@ namespace Translator
 
     const std::string &getSpecie(u16 specie)
     {
-        return species[specie - 1];
+        return getStrings(species, Translation::Specie)[specie - 1];
     }
 
     std::string getSpecie(u16 specie, u8 form)
     {
-        auto it = forms.find((form << 11) | specie);
-        if (it != forms.end() && !it->second.empty())
+        const std::string &name = getForm(specie, form);
+        if (!name.empty())
         {
-            return species[specie - 1] + " (" + it->second + ")";
+            return getSpecie(specie) + " (" + name + ")";
         }
         else
         {
-            return species[specie - 1];
+            return getSpecie(specie);
         }
     }
 
@@ -384,9 +477,10 @@ namespace Translator
     {
         std::vector<std::string> s;
         s.reserve(max);
+        const auto &strings = getStrings(species, Translation::Specie);
         for (u16 i = 0; i < max; i++)
         {
-            s.emplace_back(species[i]);
+            s.emplace_back(strings[i]);
         }
         return s;
     }
@@ -433,20 +527,18 @@ namespace Translator
         {
             language = Language::Chinese;
         }
+    }
 
-        u32 size;
-        auto *data = Utilities::decompress<char>(I18N.data(), I18N.size(), size);
-
-        readFile(data, Translation::Ability, abilities);
-        readFile(data, characteristics);
-        forms = readFile(data, Translation::Form);
-        readFile(data, Translation::Game, games);
-        readFile(data, Translation::Power, hiddenPowers);
-        items = readFile(data, Translation::Item);
-        readFile(data, Translation::Move, moves);
-        readFile(data, Translation::Nature, natures);
-        readFile(data, Translation::Specie, species);
-
-        delete[] data;
+    void load()
+    {
+        getStrings(abilities, Translation::Ability);
+        getCharacteristics(CharacteristicGeneration::Gen4);
+        getMap(forms, Translation::Form);
+        getStrings(games, Translation::Game);
+        getStrings(hiddenPowers, Translation::Power);
+        getMap(items, Translation::Item);
+        getStrings(moves, Translation::Move);
+        getStrings(natures, Translation::Nature);
+        getStrings(species, Translation::Specie);
     }
 }
@@ -249,11 +249,17 @@ namespace Translator
 
     /**
      * @brief Initalize the Translator with what \p locale to use.
-     * This must be called before using any other function in the namespace.
+     * This must be called before using any other function in the namespace. String tables are read the first time they are used.
      *
      * @param locale Language
      */
     void init(std::string_view locale);
+
+    /**
+     * @brief Reads the string tables used by most windows so later lookups do not have to.
+     * Can be called from a background thread once init() has been called.
+     */
+    void load();
 }
 
 #endif // TRANSLATOR_HPP
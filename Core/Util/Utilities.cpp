@@ -23,6 +23,7 @@
 #include <Core/Gen5/Profile5.hpp>
 #include <Core/RNG/LCRNG.hpp>
 #include <Core/RNG/MT.hpp>
+#include <Core/RNG/SIMD.hpp>
 #include <Core/Util/DateTime.hpp>
 #include <zstd.h>
 
@@ -69,6 +70,283 @@ static u32 advanceProbabilityTable(BWRNG &rng)
     return count;
 }
 
+struct ProbabilityTable
+{
+    u8 threshold[64];
+    u8 next[64][2];
+    u8 done;
+};
+
+/**
+ * @brief Flattens the probability tables into nodes that each consume one random number.
+ * Nodes that always advance have a threshold that can not be passed.
+ *
+ * @param extra Number of advances done after the first probability table
+ *
+ * @return Probability table nodes
+ */
+static consteval ProbabilityTable computeProbabilityTable(u8 extra)
+{
+    constexpr u8 threshold[12] = { 255, 50, 255, 30, 255, 25, 30, 255, 20, 25, 33, 255 };
+    constexpr u8 pass[12] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+    constexpr u8 fail[12] = { 1, 3, 3, 5, 5, 8, 8, 8, 12, 12, 12, 12 };
+
+    ProbabilityTable table {};
+    u8 node = 0;
+    for (u8 i = 0; i < 5; i++)
+    {
+        u8 base = node;
+        for (u8 j = 0; j < 12; j++, node++)
+        {
+            table.threshold[node] = threshold[j];
+            table.next[node][0] = base + fail[j];
+            table.next[node][1] = base + pass[j];
+        }
+
+        for (u8 j = 0; i == 0 && j < extra; j++, node++)
+        {
+            table.threshold[node] = 255;
+            table.next[node][0] = node + 1;
+            table.next[node][1] = node + 1;
+        }
+    }
+
+    table.threshold[node] = 255;
+    table.next[node][0] = node;
+    table.next[node][1] = node;
+    table.done = node;
+
+    return table;
+}
+
+constexpr ProbabilityTable probabilityTables[3] = { computeProbabilityTable(0), computeProbabilityTable(3), computeProbabilityTable(2) };
+
+/**
+ * @brief Calculates the initial advances of each seed in lockstep.
+ * Every lane consumes one random number per step so the lanes only differ by which node they are on.
+ *
+ * @tparam size Number of seeds
+ * @param seeds PRNG states
+ * @param bw2 Whether the seeds are for BW2
+ * @param memory Whether memory link is activated or not
+ *
+ * @return Initial advance count of each seed
+ */
+template <size_t size>
+static std::array<u32, size> computeInitialAdvances(const std::array<u64, size> &seeds, bool bw2, bool memory)
+{
+    constexpr u64 add = BWRNG::getAdd();
+    constexpr u64 mult = BWRNG::getMult();
+
+    const ProbabilityTable &table = probabilityTables[bw2 ? (memory ? 2 : 1) : 0];
+
+    std::array<u64, size> states = seeds;
+    std::array<u32, size> counts {};
+    std::array<u8, size> nodes {};
+
+    bool running = true;
+    while (running)
+    {
+        running = false;
+        for (size_t i = 0; i < size; i++)
+        {
+            u8 node = nodes[i];
+            bool active = node != table.done;
+
+            u64 state = states[i] * mult + add;
+            u32 rand = ((state >> 32) * 101) >> 32;
+
+            states[i] = active ? state : states[i];
+            counts[i] += active;
+            nodes[i] = table.next[node][rand > table.threshold[node]];
+            running |= active;
+        }
+    }
+
+    if (bw2)
+    {
+        std::array<bool, size> searching;
+        searching.fill(true);
+
+        // Lanes stop once their 3 rand calls are not duplicates
+        running = true;
+        for (u8 limit = 0; limit < 100 && running; limit++)
+        {
+            running = false;
+            for (size_t i = 0; i < size; i++)
+            {
+                u64 state1 = states[i] * mult + add;
+                u64 state2 = state1 * mult + add;
+                u64 state3 = state2 * mult + add;
+                u32 rand1 = ((state1 >> 32) * 15) >> 32;
+                u32 rand2 = ((state2 >> 32) * 15) >> 32;
+                u32 rand3 = ((state3 >> 32) * 15) >> 32;
+
+                states[i] = searching[i] ? state3 : states[i];
+                counts[i] += searching[i] ? 3 : 0;
+                searching[i] = searching[i] && (rand1 == rand2 || rand1 == rand3 || rand2 == rand3);
+                running |= searching[i];
+            }
+        }
+    }
+
+    return counts;
+}
+
+#ifdef SIMD_X86
+/**
+ * @brief Calculates the initial advances of each seed in lockstep with 4 seeds per AVX2 register.
+ * Nodes are kept relative to a single probability table so they can be looked up with a byte shuffle.
+ *
+ * @tparam size Number of seeds
+ * @param seeds PRNG states
+ * @param bw2 Whether the seeds are for BW2
+ * @param memory Whether memory link is activated or not
+ *
+ * @return Initial advance count of each seed
+ */
+template <size_t size>
+static std::array<u32, size> computeInitialAdvancesAVX2(const std::array<u64, size> &seeds, bool bw2, bool memory)
+{
+    constexpr size_t registers = size / 4;
+
+    // Nodes 0-11 are a single probability table, 12-14 are the advances done after the first BW2 table and 15 ends the segment
+    const __m256i thresholds = _mm256_setr_epi8(-1, 50, -1, 30, -1, 25, 30, -1, 20, 25, 33, -1, -1, -1, -1, -1, -1, 50, -1, 30, -1, 25,
+                                                30, -1, 20, 25, 33, -1, -1, -1, -1, -1);
+    const __m256i pass = _mm256_setr_epi8(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 15, 13, 14, 15, 15, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 15, 13,
+                                          14, 15, 15);
+    const __m256i fail = _mm256_setr_epi8(1, 3, 3, 5, 5, 8, 8, 8, 15, 15, 15, 15, 13, 14, 15, 15, 1, 3, 3, 5, 5, 8, 8, 8, 15, 15, 15, 15,
+                                          13, 14, 15, 15);
+    const __m256i index = _mm256_set1_epi64x(static_cast<s64>(0x8080808080808000));
+
+    const __m256i multLow = _mm256_set1_epi64x(BWRNG::getMult() & 0xffffffff);
+    const __m256i multHigh = _mm256_set1_epi64x(BWRNG::getMult() >> 32);
+    const __m256i add = _mm256_set1_epi64x(BWRNG::getAdd());
+    auto next = [&](__m256i state) {
+        __m256i low = _mm256_mul_epu32(state, multLow);
+        __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(state, 32), multLow), _mm256_mul_epu32(state, multHigh));
+        return _mm256_add_epi64(_mm256_add_epi64(low, _mm256_slli_epi64(cross, 32)), add);
+    };
+    auto rand = [](__m256i state, __m256i max) { return _mm256_srli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(state, 32), max), 32); };
+
+    const __m256i one = _mm256_set1_epi64x(1);
+    const __m256i end = _mm256_set1_epi64x(15);
+    const __m256i max101 = _mm256_set1_epi64x(101);
+    const __m256i segments = _mm256_set1_epi64x(bw2 ? 6 : 5);
+    const __m256i extra = _mm256_set1_epi64x(bw2 ? (memory ? 13 : 12) : 0);
+
+    __m256i states[registers];
+    __m256i counts[registers];
+    __m256i nodes[registers];
+    __m256i segment[registers];
+    for (size_t i = 0; i < registers; i++)
+    {
+        states[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&seeds[i * 4]));
+        counts[i] = _mm256_setzero_si256();
+        nodes[i] = _mm256_setzero_si256();
+        segment[i] = _mm256_setzero_si256();
+    }
+
+    bool running = true;
+    while (running)
+    {
+        running = false;
+        for (size_t i = 0; i < registers; i++)
+        {
+            __m256i active = _mm256_xor_si256(_mm256_cmpeq_epi64(segment[i], segments), _mm256_set1_epi64x(-1));
+
+            __m256i state = next(states[i]);
+            __m256i value = rand(state, max101);
+            states[i] = _mm256_blendv_epi8(states[i], state, active);
+            counts[i] = _mm256_sub_epi64(counts[i], active);
+
+            __m256i lookup = _mm256_or_si256(nodes[i], index);
+            __m256i taken = _mm256_cmpgt_epi64(value, _mm256_shuffle_epi8(thresholds, lookup));
+            __m256i node = _mm256_blendv_epi8(_mm256_shuffle_epi8(fail, lookup), _mm256_shuffle_epi8(pass, lookup), taken);
+
+            // Move finished lanes onto the start of their next segment
+            __m256i finished = _mm256_and_si256(_mm256_cmpeq_epi64(node, end), active);
+            segment[i] = _mm256_sub_epi64(segment[i], finished);
+            __m256i start = _mm256_and_si256(_mm256_cmpeq_epi64(segment[i], one), extra);
+            nodes[i] = _mm256_blendv_epi8(node, start, finished);
+
+            running |= _mm256_movemask_epi8(_mm256_cmpeq_epi64(segment[i], segments)) != -1;
+        }
+    }
+
+    if (bw2)
+    {
+        const __m256i max15 = _mm256_set1_epi64x(15);
+        const __m256i three = _mm256_set1_epi64x(3);
+
+        __m256i searching[registers];
+        for (size_t i = 0; i < registers; i++)
+        {
+            searching[i] = _mm256_set1_epi64x(-1);
+        }
+
+        // Lanes stop once their 3 rand calls are not duplicates
+        running = true;
+        for (u8 limit = 0; limit < 100 && running; limit++)
+        {
+            running = false;
+            for (size_t i = 0; i < registers; i++)
+            {
+                __m256i state1 = next(states[i]);
+                __m256i state2 = next(state1);
+                __m256i state3 = next(state2);
+                __m256i rand1 = rand(state1, max15);
+                __m256i rand2 = rand(state2, max15);
+                __m256i rand3 = rand(state3, max15);
+
+                states[i] = _mm256_blendv_epi8(states[i], state3, searching[i]);
+                counts[i] = _mm256_add_epi64(counts[i], _mm256_and_si256(searching[i], three));
+
+                __m256i duplicate = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi64(rand1, rand2), _mm256_cmpeq_epi64(rand1, rand3)),
+                                                    _mm256_cmpeq_epi64(rand2, rand3));
+                searching[i] = _mm256_and_si256(searching[i], duplicate);
+                running |= !_mm256_testz_si256(searching[i], searching[i]);
+            }
+        }
+    }
+
+    std::array<u32, size> result;
+    for (size_t i = 0; i < registers; i++)
+    {
+        alignas(32) u64 lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), counts[i]);
+        for (size_t j = 0; j < 4; j++)
+        {
+            result[i * 4 + j] = lanes[j];
+        }
+    }
+    return result;
+}
+#endif
+
+/**
+ * @brief Calculates the initial advances of each seed for the \p profile
+ *
+ * @tparam size Number of seeds
+ * @param seeds PRNG states
+ * @param profile Profile information
+ *
+ * @return Initial advance count of each seed
+ */
+template <size_t size>
+static std::array<u32, size> getInitialAdvances(const std::array<u64, size> &seeds, const Profile5 &profile)
+{
+    bool bw2 = (profile.getVersion() & Game::BW) == Game::None;
+#ifdef SIMD_X86
+    static const bool avx2 = hasAVX2();
+    if (avx2)
+    {
+        return computeInitialAdvancesAVX2(seeds, bw2, profile.getMemoryLink());
+    }
+#endif
+    return computeInitialAdvances(seeds, bw2, profile.getMemoryLink());
+}
+
 static std::string getPitch(u8 result)
 {
     std::string pitch;
@@ -280,6 +558,16 @@ namespace Utilities5
         }
     }
 
+    std::array<u32, 4> initialAdvances(const std::array<u64, 4> &seeds, const Profile5 &profile)
+    {
+        return getInitialAdvances(seeds, profile);
+    }
+
+    std::array<u32, 8> initialAdvances(const std::array<u64, 8> &seeds, const Profile5 &profile)
+    {
+        return getInitialAdvances(seeds, profile);
+    }
+
     u32 initialAdvancesBW(u64 seed)
     {
         BWRNG rng(seed);
@@ -23,6 +23,7 @@
 #include <Core/Global.hpp>
 #include <Core/Parents/PersonalInfo.hpp>
 #include <Core/RNG/LCRNG64.hpp>
+#include <array>
 #include <string>
 
 class DateTime;
@@ -228,6 +229,26 @@ namespace Utilities5
      */
     u32 initialAdvances(u64 seed, const Profile5 &profile);
 
+    /**
+     * @brief Calculates the initial set of advances for the \p profile of each seed from a SHA1SSE hash
+     *
+     * @param seeds PRNG states
+     * @param profile Profile information
+     *
+     * @return Initial advance count of each seed
+     */
+    std::array<u32, 4> initialAdvances(const std::array<u64, 4> &seeds, const Profile5 &profile);
+
+    /**
+     * @brief Calculates the initial set of advances for the \p profile of each seed from a SHA1AVX2 hash
+     *
+     * @param seeds PRNG states
+     * @param profile Profile information
+     *
+     * @return Initial advance count of each seed
+     */
+    std::array<u32, 8> initialAdvances(const std::array<u64, 8> &seeds, const Profile5 &profile);
+
     /**
      * @brief Calculates the initial set of advances for BW
      *
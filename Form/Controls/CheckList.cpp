@@ -18,17 +18,17 @@
  */
 
 #include "CheckList.hpp"
-#include <Model/SortFilterProxyModel.hpp>
 #include <QCheckBox>
 #include <QLineEdit>
 #include <QListWidget>
 #include <QMouseEvent>
+#include <QSortFilterProxyModel>
 #include <QStandardItemModel>
 
 /**
  * @brief Provides a proxy to sort strings but sorting numbers numerically
  */
-class CheckListProxyModel : public SortFilterProxyModel
+class CheckListProxyModel : public QSortFilterProxyModel
 {
 public:
     /**
@@ -37,8 +37,9 @@ public:
      * @param parent Parent object, which takes memory ownership
      * @param model Source model to be processed by proxy
      */
-    CheckListProxyModel(QObject *parent, QAbstractItemModel *model) : SortFilterProxyModel(parent, model)
+    CheckListProxyModel(QObject *parent, QAbstractItemModel *model) : QSortFilterProxyModel(parent)
     {
+        setSourceModel(model);
     }
 
     /**
@@ -84,6 +85,7 @@ CheckList::CheckList(QWidget *parent) : QComboBox(parent), uncheckedText(tr("Any
 
     connect(view(), &QAbstractItemView::pressed, this, &CheckList::onItemClicked);
     connect(model, &QStandardItemModel::dataChanged, this, &CheckList::updateText);
+    connect(model, &QStandardItemModel::dataChanged, this, &CheckList::checkedChanged);
 }
 
 void CheckList::addItem(const QString &string, const QVariant &data)
@@ -33,6 +33,12 @@ class QStandardItemModel;
 class CheckList : public QComboBox
 {
     Q_OBJECT
+signals:
+    /**
+     * @brief Emits that the checked items have been changed
+     */
+    void checkedChanged();
+
 public:
     /**
      * @brief Construct a new CheckList object
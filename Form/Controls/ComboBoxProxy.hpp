@@ -21,8 +21,8 @@
 #define COMBOBOXPROXY_HPP
 
 #include <Core/Global.hpp>
-#include <Model/SortFilterProxyModel.hpp>
 #include <QComboBox>
+#include <QSortFilterProxyModel>
 
 class ComboBoxProxyModel;
 class QStandardItemModel;
@@ -105,7 +105,7 @@ private:
 /**
  * @brief Provides a proxy to sort strings placing "None" at the top
  */
-class ComboBoxProxyModel : public SortFilterProxyModel
+class ComboBoxProxyModel : public QSortFilterProxyModel
 {
     Q_OBJECT
 public:
@@ -115,8 +115,9 @@ public:
      * @param parent Parent object, which takes memory ownership
      * @param model Source model to be processed by proxy
      */
-    ComboBoxProxyModel(QObject *parent, QAbstractItemModel *model) : SortFilterProxyModel(parent, model)
+    ComboBoxProxyModel(QObject *parent, QAbstractItemModel *model) : QSortFilterProxyModel(parent)
     {
+        setSourceModel(model);
     }
 
     /**
@@ -122,6 +122,21 @@ Filter::Filter(QWidget *parent) : QWidget(parent), ui(new Ui::Filter)
     connect(ui->checkBoxShowStats, &QCheckBox::checkStateChanged, this,
             [=](Qt::CheckState state) { emit showStatsChanged(state == Qt::Checked); });
     connect(ui->pushButtonIVCalculator, &QPushButton::clicked, this, &Filter::openIVCalculator);
+
+    connect(this, &Filter::ivsChanged, this, &Filter::filterChanged);
+    connect(ui->checkBoxDisableFilters, &QCheckBox::checkStateChanged, this, &Filter::filterChanged);
+    connect(ui->checkListEncounterSlot, &CheckList::checkedChanged, this, &Filter::filterChanged);
+    connect(ui->checkListHiddenPower, &CheckList::checkedChanged, this, &Filter::filterChanged);
+    connect(ui->checkListNature, &CheckList::checkedChanged, this, &Filter::filterChanged);
+    connect(ui->comboBoxAbility, &ComboBox::currentIndexChanged, this, &Filter::filterChanged);
+    connect(ui->comboBoxGender, &ComboBox::currentIndexChanged, this, &Filter::filterChanged);
+    connect(ui->comboBoxShiny, &ComboBox::currentIndexChanged, this, &Filter::filterChanged);
+    connect(ui->spinBoxHeightMax, &QSpinBox::valueChanged, this, &Filter::filterChanged);
+    connect(ui->spinBoxHeightMin, &QSpinBox::valueChanged, this, &Filter::filterChanged);
+    connect(ui->spinBoxLevelMax, &QSpinBox::valueChanged, this, &Filter::filterChanged);
+    connect(ui->spinBoxLevelMin, &QSpinBox::valueChanged, this, &Filter::filterChanged);
+    connect(ui->spinBoxWeightMax, &QSpinBox::valueChanged, this, &Filter::filterChanged);
+    connect(ui->spinBoxWeightMin, &QSpinBox::valueChanged, this, &Filter::filterChanged);
 }
 
 Filter::~Filter()
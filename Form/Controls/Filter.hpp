@@ -38,6 +38,11 @@ class Filter : public QWidget
 {
     Q_OBJECT
 signals:
+    /**
+     * @brief Emits that any setting of the filter has been changed
+     */
+    void filterChanged();
+
     /**
      * @brief Emits that show stats setting has been changed
      */
@@ -38,6 +38,8 @@ TableView::TableView(QWidget *parent) : QTableView(parent)
 
     QHeaderView *horizontal = this->horizontalHeader();
     horizontal->setSectionResizeMode(QHeaderView::Interactive);
+    // Only size columns from the visible rows, otherwise every insert formats up to 1000 extra rows
+    horizontal->setResizeContentsPrecision(0);
 
     QHeaderView *vertical = this->verticalHeader();
     vertical->hide();
@@ -24,7 +24,10 @@
 #include <Core/Gen4/Searchers/IDSearcher4.hpp>
 #include <Form/Gen4/Tools/SeedToTime4.hpp>
 #include <Model/Gen4/IDModel4.hpp>
+#include <QDir>
+#include <QMessageBox>
 #include <QSettings>
+#include <QStandardPaths>
 #include <QThread>
 #include <QTimer>
 
@@ -104,6 +107,14 @@ void IDs4::search()
 
     IDFilter filter = ui->idFilter->getFilter(true);
     auto *searcher = new IDSearcher4(filter);
+    if (infinite)
+    {
+        QString path = QStandardPaths::writableLocation(QStandardPaths::AppLocalDataLocation);
+        if (QDir().mkpath(path))
+        {
+            searcher->setCheckpoint(QDir(path).filePath("ids4.checkpoint").toStdString());
+        }
+    }
 
     searcher->setMaxProgress(256 * 24 * (infinite ? 0xE8FFFF : (maxDelay - minDelay + 1)));
 
@@ -123,6 +134,12 @@ void IDs4::search()
         ui->pushButtonCancel->setEnabled(false);
         searcherModel->addItems(searcher->getResults());
         ui->progressBar->setValue(searcher->getProgress());
+        if (searcher->getCheckpointFailed())
+        {
+            QMessageBox msg(QMessageBox::Warning, tr("Checkpoint failed"),
+                            tr("Unable to write the checkpoint, resuming this search will repeat the part searched after the failure"));
+            msg.exec();
+        }
         delete searcher;
     });
 
@@ -31,7 +31,7 @@
 #include <Form/Controls/Controls.hpp>
 #include <Form/Gen5/Profile/ProfileManager5.hpp>
 #include <Model/Gen5/DreamRadarModel.hpp>
-#include <Model/SortFilterProxyModel.hpp>
+#include <Model/StateFilterProxyModel.hpp>
 #include <QMessageBox>
 #include <QSettings>
 #include <QThread>
@@ -87,7 +87,7 @@ DreamRadar::DreamRadar(QWidget *parent) : QWidget(parent), ui(new Ui::DreamRadar
     ui->tableViewGenerator->setModel(generatorModel);
 
     searcherModel = new DreamRadarSearcherModel5(ui->tableViewSearcher);
-    proxyModel = new SortFilterProxyModel(ui->tableViewSearcher, searcherModel);
+    proxyModel = new StateFilterProxyModel(ui->tableViewSearcher, searcherModel);
     ui->tableViewSearcher->setModel(proxyModel);
 
     ui->comboBoxGeneratorSpecie1->addItem(tr("None"), -1);
@@ -141,6 +141,8 @@ DreamRadar::DreamRadar(QWidget *parent) : QWidget(parent), ui(new Ui::DreamRadar
     connect(ui->pushButtonSearch, &QPushButton::clicked, this, &DreamRadar::search);
     connect(ui->filterGenerator, &Filter::showStatsChanged, generatorModel, &DreamRadarGeneratorModel5::setShowStats);
     connect(ui->filterSearcher, &Filter::showStatsChanged, searcherModel, &DreamRadarSearcherModel5::setShowStats);
+    connect(ui->filterSearcher, &Filter::filterChanged, this,
+            [=] { proxyModel->setStateFilter(ui->filterSearcher->getFilter<StateFilter>()); });
 
     connect(ui->comboBoxGeneratorSpecie1, &ComboBox::currentIndexChanged, this,
             [=]() { updateGenders(ui->comboBoxGeneratorSpecie1, ui->comboBoxGeneratorGender1); });
@@ -355,7 +357,7 @@ void DreamRadar::search()
     u32 initialAdvances = ui->textBoxSearcherInitialAdvances->getUInt();
     u32 maxAdvances = ui->textBoxSearcherMaxAdvances->getUInt();
 
-    auto filter = ui->filterSearcher->getFilter<StateFilter>();
+    auto filter = proxyModel->startSearch(ui->filterSearcher->getFilter<StateFilter>());
     DreamRadarGenerator generator(initialAdvances, maxAdvances, ui->spinBoxSearcherBadges->value(), radarTemplates, *currentProfile,
                                   filter);
     auto *searcher = new Searcher5<DreamRadarGenerator, DreamRadarState>(generator, *currentProfile);
@@ -370,7 +372,9 @@ void DreamRadar::search()
 
     auto *timer = new QTimer();
     connect(timer, &QTimer::timeout, this, [=] {
-        searcherModel->addItems(searcher->getResults());
+        auto results = searcher->getResults();
+        proxyModel->addCandidates(results);
+        searcherModel->addItems(results);
         ui->progressBar->setValue(searcher->getProgress());
     });
     connect(thread, &QThread::finished, timer, &QTimer::stop);
@@ -378,9 +382,12 @@ void DreamRadar::search()
     connect(timer, &QTimer::destroyed, this, [=] {
         ui->pushButtonSearch->setEnabled(true);
         ui->pushButtonCancel->setEnabled(false);
-        searcherModel->addItems(searcher->getResults());
+        auto results = searcher->getResults();
+        proxyModel->addCandidates(results);
+        searcherModel->addItems(results);
         ui->progressBar->setValue(searcher->getProgress());
         delete searcher;
+        proxyModel->finishSearch();
     });
 
     thread->start();
@@ -27,7 +27,7 @@ class DreamRadarGeneratorModel5;
 class DreamRadarSearcherModel5;
 class DreamRadarTemplate;
 class Profile5;
-class SortFilterProxyModel;
+class StateFilterProxyModel;
 
 namespace Ui
 {
@@ -79,7 +79,7 @@ private:
     DreamRadarGeneratorModel5 *generatorModel;
     DreamRadarSearcherModel5 *searcherModel;
     const Profile5 *currentProfile;
-    SortFilterProxyModel *proxyModel;
+    StateFilterProxyModel *proxyModel;
 
     /**
      * @brief Loads UI settings for dream radar templates
@@ -31,7 +31,7 @@
 #include <Form/Gen5/Profile/ProfileManager5.hpp>
 #include <Form/Util/AdvanceFinder.hpp>
 #include <Model/Gen5/EggModel5.hpp>
-#include <Model/SortFilterProxyModel.hpp>
+#include <Model/StateFilterProxyModel.hpp>
 #include <QAction>
 #include <QMessageBox>
 #include <QSettings>
@@ -51,7 +51,7 @@ Eggs5::Eggs5(QWidget *parent) : QWidget(parent), ui(new Ui::Eggs5)
     ui->tableViewGenerator->setModel(generatorModel);
 
     searcherModel = new EggSearcherModel5(ui->tableViewSearcher);
-    proxyModel = new SortFilterProxyModel(ui->tableViewSearcher, searcherModel);
+    proxyModel = new StateFilterProxyModel(ui->tableViewSearcher, searcherModel);
     ui->tableViewSearcher->setModel(proxyModel);
 
     ui->textBoxGeneratorSeed->setValues(InputType::Seed64Bit);
@@ -85,6 +85,8 @@ Eggs5::Eggs5(QWidget *parent) : QWidget(parent), ui(new Ui::Eggs5)
     connect(ui->eggSettingsSearcher, &EggSettings::showInheritanceChanged, searcherModel, &EggSearcherModel5::setShowInheritance);
     connect(ui->filterGenerator, &Filter::showStatsChanged, generatorModel, &EggGeneratorModel5::setShowStats);
     connect(ui->filterSearcher, &Filter::showStatsChanged, searcherModel, &EggSearcherModel5::setShowStats);
+    connect(ui->filterSearcher, &Filter::filterChanged, this,
+            [=] { proxyModel->setStateFilter(ui->filterSearcher->getFilter<StateFilter>()); });
 
     updateProfiles();
 
@@ -209,7 +211,7 @@ void Eggs5::search()
     u32 maxAdvances = ui->textBoxSearcherMaxAdvances->getUInt();
     Daycare daycare = ui->eggSettingsSearcher->getDaycare();
 
-    auto filter = ui->filterSearcher->getFilter<StateFilter>();
+    auto filter = proxyModel->startSearch(ui->filterSearcher->getFilter<StateFilter>());
     EggGenerator5 generator(initialAdvances, maxAdvances, 0, daycare, *currentProfile, filter);
     auto *searcher = new Searcher5<EggGenerator5, EggState5>(generator, *currentProfile);
     searcher->setMaxProgress(searcher->getMaxProgress(start, end));
@@ -223,7 +225,9 @@ void Eggs5::search()
 
     auto *timer = new QTimer();
     connect(timer, &QTimer::timeout, this, [=] {
-        searcherModel->addItems(searcher->getResults());
+        auto results = searcher->getResults();
+        proxyModel->addCandidates(results);
+        searcherModel->addItems(results);
         ui->progressBar->setValue(searcher->getProgress());
     });
     connect(thread, &QThread::finished, timer, &QTimer::stop);
@@ -231,9 +235,12 @@ void Eggs5::search()
     connect(timer, &QTimer::destroyed, this, [=] {
         ui->pushButtonSearch->setEnabled(true);
         ui->pushButtonCancel->setEnabled(false);
-        searcherModel->addItems(searcher->getResults());
+        auto results = searcher->getResults();
+        proxyModel->addCandidates(results);
+        searcherModel->addItems(results);
         ui->progressBar->setValue(searcher->getProgress());
         delete searcher;
+        proxyModel->finishSearch();
     });
 
     thread->start();
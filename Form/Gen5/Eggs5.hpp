@@ -25,7 +25,7 @@
 class EggGeneratorModel5;
 class EggSearcherModel5;
 class Profile5;
-class SortFilterProxyModel;
+class StateFilterProxyModel;
 
 namespace Ui
 {
@@ -77,7 +77,7 @@ private:
     EggGeneratorModel5 *generatorModel;
     EggSearcherModel5 *searcherModel;
     const Profile5 *currentProfile;
-    SortFilterProxyModel *proxyModel;
+    StateFilterProxyModel *proxyModel;
 
 private slots:
     /**
@@ -34,7 +34,7 @@
 #include <Form/Gen5/Profile/ProfileManager5.hpp>
 #include <Form/Util/AdvanceFinder.hpp>
 #include <Model/Gen5/EventModel5.hpp>
-#include <Model/SortFilterProxyModel.hpp>
+#include <Model/StateFilterProxyModel.hpp>
 #include <QAction>
 #include <QFileDialog>
 #include <QMessageBox>
@@ -55,7 +55,7 @@ Event5::Event5(QWidget *parent) : QWidget(parent), ui(new Ui::Event5)
     ui->tableViewGenerator->setModel(generatorModel);
 
     searcherModel = new EventSearcherModel5(ui->tableViewSearcher);
-    proxyModel = new SortFilterProxyModel(ui->tableViewSearcher, searcherModel);
+    proxyModel = new StateFilterProxyModel(ui->tableViewSearcher, searcherModel);
     ui->tableViewSearcher->setModel(proxyModel);
 
     ui->textBoxGeneratorSeed->setValues(InputType::Seed64Bit);
@@ -105,6 +105,8 @@ Event5::Event5(QWidget *parent) : QWidget(parent), ui(new Ui::Event5)
     connect(ui->pushButtonSearcherImport, &QPushButton::clicked, this, &Event5::searcherImportEvent);
     connect(ui->filterGenerator, &Filter::showStatsChanged, generatorModel, &EventGeneratorModel5::setShowStats);
     connect(ui->filterSearcher, &Filter::showStatsChanged, searcherModel, &EventSearcherModel5::setShowStats);
+    connect(ui->filterSearcher, &Filter::filterChanged, this,
+            [=] { proxyModel->setStateFilter(ui->filterSearcher->getFilter<StateFilter>()); });
 
     updateProfiles();
 
@@ -304,7 +306,7 @@ void Event5::search()
     u32 maxAdvances = ui->textBoxSearcherMaxAdvances->getUInt();
     PGF pgf = getSearcherParameters();
 
-    auto filter = ui->filterSearcher->getFilter<StateFilter>();
+    auto filter = proxyModel->startSearch(ui->filterSearcher->getFilter<StateFilter>());
     EventGenerator5 generator(initialAdvances, maxAdvances, 0, pgf, *currentProfile, filter);
     auto *searcher = new Searcher5<EventGenerator5, EventState5>(generator, *currentProfile);
     searcher->setMaxProgress(searcher->getMaxProgress(start, end));
@@ -318,7 +320,9 @@ void Event5::search()
 
     auto *timer = new QTimer();
     connect(timer, &QTimer::timeout, this, [=] {
-        searcherModel->addItems(searcher->getResults());
+        auto results = searcher->getResults();
+        proxyModel->addCandidates(results);
+        searcherModel->addItems(results);
         ui->progressBar->setValue(searcher->getProgress());
     });
     connect(thread, &QThread::finished, timer, &QTimer::stop);
@@ -326,9 +330,12 @@ void Event5::search()
     connect(timer, &QTimer::destroyed, this, [=] {
         ui->pushButtonSearch->setEnabled(true);
         ui->pushButtonCancel->setEnabled(false);
-        searcherModel->addItems(searcher->getResults());
+        auto results = searcher->getResults();
+        proxyModel->addCandidates(results);
+        searcherModel->addItems(results);
         ui->progressBar->setValue(searcher->getProgress());
         delete searcher;
+        proxyModel->finishSearch();
     });
 
     thread->start();
@@ -26,7 +26,7 @@ class EventGeneratorModel5;
 class EventSearcherModel5;
 class PGF;
 class Profile5;
-class SortFilterProxyModel;
+class StateFilterProxyModel;
 
 namespace Ui
 {
@@ -78,7 +78,7 @@ private:
     EventGeneratorModel5 *generatorModel;
     EventSearcherModel5 *searcherModel;
     const Profile5 *currentProfile;
-    SortFilterProxyModel *proxyModel;
+    StateFilterProxyModel *proxyModel;
 
     /**
      * @brief Loads UI settings for a wondercard
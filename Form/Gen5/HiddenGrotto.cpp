@@ -41,6 +41,7 @@
 #include <Form/Util/AdvanceFinder.hpp>
 #include <Model/Gen5/HiddenGrottoModel.hpp>
 #include <Model/SortFilterProxyModel.hpp>
+#include <Model/StateFilterProxyModel.hpp>
 #include <QAction>
 #include <QFileDialog>
 #include <QMessageBox>
@@ -169,7 +170,7 @@ HiddenGrotto::HiddenGrotto(QWidget *parent) :
     ui->tableViewPokemonGenerator->setModel(pokemonGeneratorModel);
 
     pokemonSearcherModel = new HiddenGrottoSearcherModel5(ui->tableViewPokemonSearcher);
-    pokemonProxyModel = new SortFilterProxyModel(ui->tableViewPokemonSearcher, pokemonSearcherModel);
+    pokemonProxyModel = new StateFilterProxyModel(ui->tableViewPokemonSearcher, pokemonSearcherModel);
     ui->tableViewPokemonSearcher->setModel(pokemonProxyModel);
 
     ui->textBoxPokemonGeneratorSeed->setValues(InputType::Seed64Bit);
@@ -254,6 +255,8 @@ HiddenGrotto::HiddenGrotto(QWidget *parent) :
     connect(ui->filterPokemonGenerator, &Filter::showStatsChanged, pokemonGeneratorModel, &HiddenGrottoGeneratorModel5::setShowStats);
     connect(ui->filterPokemonSearcher, &Filter::showStatsChanged, pokemonSearcherModel, &HiddenGrottoSearcherModel5::setShowStats);
     connect(ui->filterPokemonSearcher, &Filter::ivsChanged, this, &HiddenGrotto::pokemonSearcherFastSearchChanged);
+    connect(ui->filterPokemonSearcher, &Filter::filterChanged, this,
+            [=] { pokemonProxyModel->setStateFilter(ui->filterPokemonSearcher->getFilter<StateFilter>()); });
     connect(ui->textBoxPokemonSearcherInitialIVAdvances, &TextBox::textChanged, this, &HiddenGrotto::pokemonSearcherFastSearchChanged);
     connect(ui->textBoxPokemonSearcherMaxIVAdvances, &TextBox::textChanged, this, &HiddenGrotto::pokemonSearcherFastSearchChanged);
 
@@ -714,13 +717,16 @@ void HiddenGrotto::pokemonSearch()
     const auto &area = encounter[ui->comboBoxPokemonSearcherLocation->currentIndex()];
     auto slot = getPokemonSlot(area, ui->comboBoxPokemonSearcherPokemon->getCurrentUChar(), currentProfile->getVersion());
 
-    auto filter = ui->filterPokemonSearcher->getFilter<StateFilter>();
+    auto filter = pokemonProxyModel->startSearch(ui->filterPokemonSearcher->getFilter<StateFilter>());
     HiddenGrottoGenerator generator(initialAdvances, maxAdvances, 0, lead, gender, slot, *currentProfile, filter);
 
+    QSettings settings;
+    int threads = settings.value("settings/threads").toInt();
+
     SearcherBase5<HiddenGrottoGenerator, State5> *searcher;
     if (fastSearchEnabled())
     {
-        auto ivMap = ivCache->getCache(initialIVAdvances, maxIVAdvances, currentProfile->getVersion(), CacheType::Normal, filter);
+        auto ivMap = ivCache->getCache(initialIVAdvances, maxIVAdvances, currentProfile->getVersion(), CacheType::Normal, filter, threads);
         if (shaCache && shaCache->isValid(*currentProfile))
         {
             auto shaMap = shaCache->getCache(initialIVAdvances, maxIVAdvances, start, end, ivMap, CacheType::Normal, *currentProfile);
@@ -740,16 +746,15 @@ void HiddenGrotto::pokemonSearch()
 
     searcher->setMaxProgress(searcher->getMaxProgress(start, end));
 
-    QSettings settings;
-    int threads = settings.value("settings/threads").toInt();
-
     auto *thread = QThread::create([=] { searcher->startSearch(threads, start, end); });
     connect(thread, &QThread::finished, thread, &QThread::deleteLater);
     connect(ui->pushButtonPokemonCancel, &QPushButton::clicked, [searcher] { searcher->cancelSearch(); });
 
     auto *timer = new QTimer();
     connect(timer, &QTimer::timeout, this, [=] {
-        pokemonSearcherModel->addItems(searcher->getResults());
+        auto results = searcher->getResults();
+        pokemonProxyModel->addCandidates(results);
+        pokemonSearcherModel->addItems(results);
         ui->progressBarPokemon->setValue(searcher->getProgress());
     });
     connect(thread, &QThread::finished, timer, &QTimer::stop);
@@ -757,9 +762,12 @@ void HiddenGrotto::pokemonSearch()
     connect(timer, &QTimer::destroyed, this, [=] {
         ui->pushButtonPokemonSearch->setEnabled(true);
         ui->pushButtonPokemonCancel->setEnabled(false);
-        pokemonSearcherModel->addItems(searcher->getResults());
+        auto results = searcher->getResults();
+        pokemonProxyModel->addCandidates(results);
+        pokemonSearcherModel->addItems(results);
         ui->progressBarPokemon->setValue(searcher->getProgress());
         delete searcher;
+        pokemonProxyModel->finishSearch();
     });
 
     thread->start();
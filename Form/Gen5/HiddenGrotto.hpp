@@ -31,6 +31,7 @@ class IVCache;
 class Profile5;
 class SHA1Cache;
 class SortFilterProxyModel;
+class StateFilterProxyModel;
 
 namespace Ui
 {
@@ -87,7 +88,7 @@ private:
     const Profile5 *currentProfile;
     SHA1Cache *shaCache;
     SortFilterProxyModel *grottoProxyModel;
-    SortFilterProxyModel *pokemonProxyModel;
+    StateFilterProxyModel *pokemonProxyModel;
     std::vector<HiddenGrottoArea> encounter;
 
     /**
@@ -677,10 +677,13 @@ void Phenomenon::search()
     WildGenerator5 generator(initialAdvances, maxAdvances, 0, Method::Method5, leads, luckyPowers, false, false,
                              encounterSearcher[ui->comboBoxSearcherLocation->currentIndex()], *currentProfile, filter, true);
 
+    QSettings settings;
+    int threads = settings.value("settings/threads").toInt();
+
     SearcherBase5<WildGenerator5, WildState5> *searcher;
     if (fastSearchEnabled())
     {
-        auto ivMap = ivCache->getCache(initialIVAdvances, maxIVAdvances, currentProfile->getVersion(), CacheType::Normal, filter);
+        auto ivMap = ivCache->getCache(initialIVAdvances, maxIVAdvances, currentProfile->getVersion(), CacheType::Normal, filter, threads);
         if (shaCache && shaCache->isValid(*currentProfile))
         {
             auto shaMap = shaCache->getCache(initialIVAdvances, maxIVAdvances, start, end, ivMap, CacheType::Normal, *currentProfile);
@@ -699,9 +702,6 @@ void Phenomenon::search()
 
     searcher->setMaxProgress(searcher->getMaxProgress(start, end));
 
-    QSettings settings;
-    int threads = settings.value("settings/threads").toInt();
-
     auto *thread = QThread::create([=] { searcher->startSearch(threads, start, end); });
     connect(thread, &QThread::finished, thread, &QThread::deleteLater);
     connect(ui->pushButtonCancel, &QPushButton::clicked, [searcher] { searcher->cancelSearch(); });
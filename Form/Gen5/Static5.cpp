@@ -38,7 +38,7 @@
 #include <Form/Gen5/Tools/AdjacentSeeds.hpp>
 #include <Form/Util/AdvanceFinder.hpp>
 #include <Model/Gen5/StaticModel5.hpp>
-#include <Model/SortFilterProxyModel.hpp>
+#include <Model/StateFilterProxyModel.hpp>
 #include <QAction>
 #include <QFileDialog>
 #include <QMessageBox>
@@ -96,7 +96,7 @@ Static5::Static5(QWidget *parent) : QWidget(parent), ui(new Ui::Static5), ivCach
 
     generatorModel = new StaticGeneratorModel5(ui->tableViewGenerator);
     searcherModel = new StaticSearcherModel5(ui->tableViewSearcher);
-    proxyModel = new SortFilterProxyModel(ui->tableViewSearcher, searcherModel);
+    proxyModel = new StateFilterProxyModel(ui->tableViewSearcher, searcherModel);
 
     ui->tableViewGenerator->setModel(generatorModel);
     ui->tableViewSearcher->setModel(proxyModel);
@@ -158,6 +158,8 @@ Static5::Static5(QWidget *parent) : QWidget(parent), ui(new Ui::Static5), ivCach
     connect(ui->filterGenerator, &Filter::showStatsChanged, generatorModel, &StaticGeneratorModel5::setShowStats);
     connect(ui->filterSearcher, &Filter::showStatsChanged, searcherModel, &StaticSearcherModel5::setShowStats);
     connect(ui->filterSearcher, &Filter::ivsChanged, this, &Static5::searcherFastSearchChanged);
+    connect(ui->filterSearcher, &Filter::filterChanged, this,
+            [=] { proxyModel->setStateFilter(ui->filterSearcher->getFilter<StateFilter>()); });
     connect(ui->textBoxSearcherInitialIVAdvances, &TextBox::textChanged, this, &Static5::searcherFastSearchChanged);
     connect(ui->textBoxSearcherMaxIVAdvances, &TextBox::textChanged, this, &Static5::searcherFastSearchChanged);
 
@@ -432,15 +434,18 @@ void Static5::search()
     const StaticTemplate5 *staticTemplate
         = Encounters5::getStaticEncounter(ui->comboBoxSearcherCategory->currentIndex(), ui->comboBoxSearcherPokemon->getCurrentInt());
 
-    auto filter = ui->filterSearcher->getFilter<StateFilter>();
+    auto filter = proxyModel->startSearch(ui->filterSearcher->getFilter<StateFilter>());
     StaticGenerator5 generator(initialAdvances, maxAdvances, 0, Method::Method5, leads, luckyPowers, *staticTemplate, *currentProfile,
                                filter);
 
+    QSettings settings;
+    int threads = settings.value("settings/threads").toInt();
+
     SearcherBase5<StaticGenerator5, State5> *searcher;
     if (fastSearchEnabled())
     {
         CacheType type = staticTemplate->getRoamer() ? CacheType::Roamer : CacheType::Normal;
-        auto ivMap = ivCache->getCache(initialIVAdvances, maxIVAdvances, currentProfile->getVersion(), type, filter);
+        auto ivMap = ivCache->getCache(initialIVAdvances, maxIVAdvances, currentProfile->getVersion(), type, filter, threads);
         if (shaCache && shaCache->isValid(*currentProfile))
         {
             auto shaMap = shaCache->getCache(initialAdvances, maxIVAdvances, start, end, ivMap, type, *currentProfile);
@@ -459,16 +464,15 @@ void Static5::search()
 
     searcher->setMaxProgress(searcher->getMaxProgress(start, end));
 
-    QSettings settings;
-    int threads = settings.value("settings/threads").toInt();
-
     auto *thread = QThread::create([=] { searcher->startSearch(threads, start, end); });
     connect(thread, &QThread::finished, thread, &QThread::deleteLater);
     connect(ui->pushButtonCancel, &QPushButton::clicked, [searcher] { searcher->cancelSearch(); });
 
     auto *timer = new QTimer();
     connect(timer, &QTimer::timeout, this, [=] {
-        searcherModel->addItems(searcher->getResults());
+        auto results = searcher->getResults();
+        proxyModel->addCandidates(results);
+        searcherModel->addItems(results);
         if (showPassPower)
         {
             ui->tableViewSearcher->resizeColumnToContents(2);
@@ -480,13 +484,16 @@ void Static5::search()
     connect(timer, &QTimer::destroyed, this, [=] {
         ui->pushButtonSearch->setEnabled(true);
         ui->pushButtonCancel->setEnabled(false);
-        searcherModel->addItems(searcher->getResults());
+        auto results = searcher->getResults();
+        proxyModel->addCandidates(results);
+        searcherModel->addItems(results);
         if (showPassPower)
         {
             ui->tableViewSearcher->resizeColumnToContents(2);
         }
         ui->progressBar->setValue(searcher->getProgress());
         delete searcher;
+        proxyModel->finishSearch();
     });
 
     thread->start();
@@ -25,7 +25,7 @@
 class IVCache;
 class Profile5;
 class SHA1Cache;
-class SortFilterProxyModel;
+class StateFilterProxyModel;
 class StaticGeneratorModel5;
 class StaticSearcherModel5;
 
@@ -78,7 +78,7 @@ private:
     IVCache *ivCache;
     const Profile5 *currentProfile;
     SHA1Cache *shaCache;
-    SortFilterProxyModel *proxyModel;
+    StateFilterProxyModel *proxyModel;
     StaticGeneratorModel5 *generatorModel;
     StaticSearcherModel5 *searcherModel;
 
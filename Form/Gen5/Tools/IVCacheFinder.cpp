@@ -58,6 +58,7 @@ void IVCacheFinder::search()
     ui->pushButtonCancel->setEnabled(true);
 
     auto *searcher = new IVCacheSearcher(ui->textEditInitialAdvances->getUInt(), ui->textEditMaxAdvances->getUInt());
+    searcher->setCheckpoint(ui->lineEditOutputFile->text().toStdString() + ".checkpoint");
     searcher->setMaxProgress(0x100000000);
 
     QSettings settings;
@@ -79,6 +80,12 @@ void IVCacheFinder::search()
         {
             searcher->writeResults(ui->lineEditOutputFile->text().toStdString());            
         }
+        if (searcher->getCheckpointFailed())
+        {
+            QMessageBox msg(QMessageBox::Warning, tr("Checkpoint failed"),
+                            tr("Unable to write the checkpoint, resuming this search will repeat the part searched after the failure"));
+            msg.exec();
+        }
         delete searcher;
     });
 
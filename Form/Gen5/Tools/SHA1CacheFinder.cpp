@@ -118,6 +118,7 @@ void SHA1CacheFinder::search()
     ui->pushButtonCancel->setEnabled(true);
 
     auto *searcher = new SHA1CacheSearcher(ivCache, *currentProfile, start, end);
+    searcher->setCheckpoint(ui->lineEditOutputFile->text().toStdString() + ".checkpoint");
     searcher->setMaxProgress(searcher->getMaxProgress());
 
     QSettings settings;
@@ -139,6 +140,12 @@ void SHA1CacheFinder::search()
         {
             searcher->writeResults(ui->lineEditOutputFile->text().toStdString());
         }
+        if (searcher->getCheckpointFailed())
+        {
+            QMessageBox msg(QMessageBox::Warning, tr("Checkpoint failed"),
+                            tr("Unable to write the checkpoint, resuming this search will repeat the part searched after the failure"));
+            msg.exec();
+        }
         delete searcher;
     });
 
@@ -130,7 +130,10 @@ void Eggs8::generate()
     auto filter = ui->filter->getFilter<StateFilter>();
     EggGenerator8 generator(initialAdvances, maxAdvances, offset, compatability, daycare, *currentProfile, filter);
 
-    auto states = generator.generate(seed0, seed1);
+    QSettings settings;
+    int threads = settings.value("settings/threads").toInt();
+
+    auto states = generator.generate(seed0, seed1, threads);
     model->addItems(states);
 }
 
@@ -181,7 +181,10 @@ void Event8::generate()
     auto filter = ui->filter->getFilter<StateFilter>();
     EventGenerator8 generator(initialAdvances, maxAdvances, offset, wb8, *currentProfile, filter);
 
-    auto states = generator.generate(seed0, seed1);
+    QSettings settings;
+    int threads = settings.value("settings/threads").toInt();
+
+    auto states = generator.generate(seed0, seed1, threads);
     model->addItems(states);
 }
 
@@ -77,6 +77,9 @@ void IDs8::generate()
     IDFilter filter = ui->filter->getFilter(false);
     IDGenerator8 generator(initialAdvances, maxAdvances, filter);
 
-    auto states = generator.generate(seed0, seed1);
+    QSettings settings;
+    int threads = settings.value("settings/threads").toInt();
+
+    auto states = generator.generate(seed0, seed1, threads);
     model->addItems(states);
 }
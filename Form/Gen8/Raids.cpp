@@ -23,6 +23,7 @@
 #include <Core/Gen8/Encounters8.hpp>
 #include <Core/Gen8/Generators/RaidGenerator.hpp>
 #include <Core/Gen8/Profile8.hpp>
+#include <Core/Gen8/Searchers/RaidSearcher.hpp>
 #include <Core/Parents/PersonalInfo.hpp>
 #include <Core/Parents/PersonalLoader.hpp>
 #include <Core/Parents/ProfileLoader.hpp>
@@ -30,8 +31,12 @@
 #include <Form/Controls/Controls.hpp>
 #include <Form/Gen8/Profile/ProfileManager8.hpp>
 #include <Model/Gen8/StaticModel8.hpp>
+#include <QAction>
 #include <QFile>
+#include <QMessageBox>
 #include <QSettings>
+#include <QThread>
+#include <QTimer>
 
 static const QString settingPrefix = QStringLiteral("raid");
 
@@ -43,7 +48,9 @@ Raids::Raids(QWidget *parent) : QWidget(parent), ui(new Ui::Raids), currentProfi
     ui->profileDisplay->setup(settingPrefix, Game::SwSh);
 
     model = new StaticModel8(ui->tableView);
+    searcherModel = new StaticSearcherModel8(ui->tableViewSearcher);
     ui->tableView->setModel(model);
+    ui->tableViewSearcher->setModel(searcherModel);
 
     ui->filter->disableControls(Controls::EncounterSlots | Controls::HiddenPowers | Controls::Level);
     ui->filter->enableHiddenAbility();
@@ -59,14 +66,19 @@ Raids::Raids(QWidget *parent) : QWidget(parent), ui(new Ui::Raids), currentProfi
 
     ui->comboBoxShinyType->setup({ 0, 1, 2 }); // Random, Non-shiny, shiny
 
+    auto *transferSeed = ui->tableViewSearcher->addAction(tr("Generate from den seed"));
+    connect(transferSeed, &QAction::triggered, this, &Raids::transferSeed);
+
     connect(ui->profileDisplay, &ProfileDisplay8::profileChanged, this, &Raids::profileChanged);
     connect(ui->profileDisplay, &ProfileDisplay8::profilesChanged, this, &Raids::profilesChanged);
     connect(ui->pushButtonGenerate, &QPushButton::clicked, this, &Raids::generate);
+    connect(ui->pushButtonSearch, &QPushButton::clicked, this, &Raids::search);
     connect(ui->comboBoxLocation, &QComboBox::currentIndexChanged, this, &Raids::locationIndexChanged);
     connect(ui->comboBoxDen, &QComboBox::currentIndexChanged, this, &Raids::denIndexChanged);
     connect(ui->comboBoxRarity, &QComboBox::currentIndexChanged, this, &Raids::rarityIndexChange);
     connect(ui->comboBoxSpecies, &QComboBox::currentIndexChanged, this, &Raids::specieIndexChanged);
     connect(ui->filter, &Filter::showStatsChanged, model, &StaticModel8::setShowStats);
+    connect(ui->filter, &Filter::showStatsChanged, searcherModel, &StaticSearcherModel8::setShowStats);
 
     updateProfiles();
     locationIndexChanged(0);
@@ -79,6 +91,10 @@ Raids::Raids(QWidget *parent) : QWidget(parent), ui(new Ui::Raids), currentProfi
     {
         ui->textBoxSeed->setText(setting.value("seed").toString());
     }
+    if (setting.contains("observations"))
+    {
+        ui->plainTextEditObservations->setPlainText(setting.value("observations").toString());
+    }
     if (setting.contains("geometry"))
     {
         this->restoreGeometry(setting.value("geometry").toByteArray());
@@ -91,6 +107,7 @@ Raids::~Raids()
     setting.beginGroup(settingPrefix);
     setting.setValue("geometry", this->saveGeometry());
     setting.setValue("seed", ui->textBoxSeed->text());
+    setting.setValue("observations", ui->plainTextEditObservations->toPlainText());
     setting.endGroup();
 
     delete ui;
@@ -157,21 +174,22 @@ void Raids::generate()
     auto filter = ui->filter->getFilter<StateFilter>();
     RaidGenerator generator(initialAdvances, maxAdvances, offset, *currentProfile, filter);
 
+    auto states = generator.generate(seed, level, getRaid());
+    model->addItems(states);
+    ui->tabWidgetResults->setCurrentWidget(ui->tabGenerator);
+}
+
+Raid Raids::getRaid() const
+{
     if (ui->comboBoxLocation->currentIndex() == 3)
     {
         const DenEvent *den = Encounters8::getDenEvent(ui->comboBoxDen->currentIndex());
-        Raid raid = den->getRaid(ui->comboBoxSpecies->currentIndex(), currentProfile->getVersion());
-
-        auto states = generator.generate(seed, level, raid);
-        model->addItems(states);
+        return den->getRaid(ui->comboBoxSpecies->currentIndex(), currentProfile->getVersion());
     }
     else
     {
         const Den *den = Encounters8::getDen(ui->comboBoxDen->getCurrentUShort(), ui->comboBoxRarity->currentIndex());
-        Raid raid = den->getRaid(ui->comboBoxSpecies->currentIndex(), currentProfile->getVersion());
-
-        auto states = generator.generate(seed, level, raid);
-        model->addItems(states);
+        return den->getRaid(ui->comboBoxSpecies->currentIndex(), currentProfile->getVersion());
     }
 }
 
@@ -232,6 +250,113 @@ void Raids::rarityIndexChange(int index)
     }
 }
 
+void Raids::search()
+{
+    std::vector<RaidObservation> observations;
+    u32 maxAdvances = 0;
+    const QStringList lines = ui->plainTextEditObservations->toPlainText().split('\n', Qt::SkipEmptyParts);
+    for (const QString &line : lines)
+    {
+        QStringList values = line.simplified().split(' ', Qt::SkipEmptyParts);
+        if (values.isEmpty())
+        {
+            continue;
+        }
+
+        bool flag = values.size() == 3 || values.size() == 9;
+        RaidObservation observation;
+        if (flag)
+        {
+            bool advancesFlag, ecFlag, pidFlag;
+            observation.advances = values[0].toUInt(&advancesFlag);
+            observation.ec = values[1].toUInt(&ecFlag, 16);
+            observation.pid = values[2].toUInt(&pidFlag, 16);
+            flag = advancesFlag && ecFlag && pidFlag;
+        }
+
+        for (int i = 3; i < values.size() && flag; i++)
+        {
+            u32 iv = values[i].toUInt(&flag);
+            flag &= iv < 32;
+            observation.ivs[i - 3] = iv;
+        }
+
+        if (!flag)
+        {
+            QMessageBox msg(QMessageBox::Warning, tr("Invalid observation"),
+                            tr("Each observation must be the advances, the EC and PID in hex, and optionally the six IVs: %1").arg(line));
+            msg.exec();
+            return;
+        }
+        observations.emplace_back(observation);
+        maxAdvances = std::max(maxAdvances, observation.advances);
+    }
+
+    if (observations.empty())
+    {
+        QMessageBox msg(QMessageBox::Warning, tr("Missing observations"), tr("Please insert the observed raid pokemon"));
+        msg.exec();
+        return;
+    }
+
+    std::array<u8, 6> min;
+    min.fill(0);
+
+    std::array<u8, 6> max;
+    max.fill(31);
+
+    std::array<bool, 25> natures;
+    natures.fill(true);
+
+    std::array<bool, 16> powers;
+    powers.fill(true);
+
+    // The observations are checked against every generated state, so the filter is not applied to the generator
+    StateFilter filter(255, 255, 255, 1, 100, 0, 255, 0, 255, false, min, max, natures, powers);
+    RaidGenerator generator(0, maxAdvances, 0, *currentProfile, filter);
+
+    auto *searcher = new RaidSearcher(observations, ui->spinBoxLevel->value(), getRaid(), generator);
+    if (searcher->getMaxProgress() == 0)
+    {
+        delete searcher;
+        QMessageBox msg(QMessageBox::Warning, tr("Unsolvable observations"), tr("Observations disagree on the den seed"));
+        msg.exec();
+        return;
+    }
+    searcher->setMaxProgress(searcher->getMaxProgress());
+
+    searcherModel->clearModel();
+    ui->tabWidgetResults->setCurrentWidget(ui->tabSearcher);
+
+    ui->pushButtonSearch->setEnabled(false);
+    ui->pushButtonCancel->setEnabled(true);
+
+    QSettings settings;
+    int threads = settings.value("settings/threads").toInt();
+
+    auto *thread = QThread::create([=] { searcher->startSearch(threads); });
+    connect(thread, &QThread::finished, thread, &QThread::deleteLater);
+    connect(ui->pushButtonCancel, &QPushButton::clicked, [searcher] { searcher->cancelSearch(); });
+
+    auto *timer = new QTimer();
+    timer->callOnTimeout(this, [=] {
+        searcherModel->addItems(searcher->getResults());
+        ui->progressBar->setValue(searcher->getProgress());
+    });
+    connect(thread, &QThread::finished, timer, &QTimer::stop);
+    connect(thread, &QThread::finished, timer, &QTimer::deleteLater);
+    connect(timer, &QTimer::destroyed, this, [=] {
+        ui->pushButtonSearch->setEnabled(true);
+        ui->pushButtonCancel->setEnabled(false);
+        searcherModel->addItems(searcher->getResults());
+        ui->progressBar->setValue(searcher->getProgress());
+        delete searcher;
+    });
+
+    thread->start();
+    timer->start(1000);
+}
+
 void Raids::specieIndexChanged(int index)
 {
     if (index >= 0)
@@ -265,3 +390,16 @@ void Raids::specieIndexChanged(int index)
         }
     }
 }
+
+void Raids::transferSeed()
+{
+    QModelIndex index = ui->tableViewSearcher->currentIndex();
+    if (!index.isValid())
+    {
+        return;
+    }
+
+    const auto &state = searcherModel->getItem(index.row());
+    ui->textBoxSeed->setText(QString::number(state.getSeed0(), 16));
+    generate();
+}
@@ -23,7 +23,9 @@
 #include <QWidget>
 
 class Profile8;
+class Raid;
 class StaticModel8;
+class StaticSearcherModel8;
 
 namespace Ui
 {
@@ -66,6 +68,14 @@ private:
 
     const Profile8 *currentProfile;
     StaticModel8 *model;
+    StaticSearcherModel8 *searcherModel;
+
+    /**
+     * @brief Returns the raid selected by the location, den and species
+     *
+     * @return Selected raid
+     */
+    Raid getRaid() const;
 
 private slots:
     /**
@@ -101,12 +111,22 @@ private slots:
      */
     void rarityIndexChange(int index);
 
+    /**
+     * @brief Recovers the den seeds that produce the observed raid pokemon
+     */
+    void search();
+
     /**
      * @brief Updates display information for a raid
      *
      * @param index Specie index
      */
     void specieIndexChanged(int index);
+
+    /**
+     * @brief Copies the den seed of the selected search result to the generator and generates from it
+     */
+    void transferSeed();
 };
 
 #endif // RAIDS_HPP
@@ -23,14 +23,18 @@
 #include <Core/Gen8/Encounters8.hpp>
 #include <Core/Gen8/Generators/StaticGenerator8.hpp>
 #include <Core/Gen8/Profile8.hpp>
+#include <Core/Gen8/Searchers/Searcher8.hpp>
 #include <Core/Gen8/StaticTemplate8.hpp>
 #include <Core/Parents/ProfileLoader.hpp>
 #include <Core/Util/Translator.hpp>
 #include <Form/Controls/Controls.hpp>
 #include <Form/Gen8/Profile/ProfileManager8.hpp>
 #include <Model/Gen8/StaticModel8.hpp>
+#include <QAction>
 #include <QMessageBox>
 #include <QSettings>
+#include <QThread>
+#include <QTimer>
 
 static const QString settingPrefix = QStringLiteral("static8");
 
@@ -42,7 +46,9 @@ Static8::Static8(QWidget *parent) : QWidget(parent), ui(new Ui::Static8)
     ui->profileDisplay->setup(settingPrefix, Game::BDSP);
 
     model = new StaticModel8(ui->tableView);
+    searcherModel = new StaticSearcherModel8(ui->tableViewSearcher);
     ui->tableView->setModel(model);
+    ui->tableViewSearcher->setModel(searcherModel);
 
     ui->textBoxSeed0->setValues(InputType::Seed64Bit);
     ui->textBoxSeed1->setValues(InputType::Seed64Bit);
@@ -59,12 +65,17 @@ Static8::Static8(QWidget *parent) : QWidget(parent), ui(new Ui::Static8)
 
     ui->filter->disableControls(Controls::EncounterSlots | Controls::HiddenPowers | Controls::Level);
 
+    auto *transferSeeds = ui->tableViewSearcher->addAction(tr("Generate from seeds"));
+    connect(transferSeeds, &QAction::triggered, this, &Static8::transferSeeds);
+
     connect(ui->profileDisplay, &ProfileDisplay8::profileChanged, this, &Static8::profileChanged);
     connect(ui->profileDisplay, &ProfileDisplay8::profilesChanged, this, &Static8::profilesChanged);
     connect(ui->pushButtonGenerate, &QPushButton::clicked, this, &Static8::generate);
+    connect(ui->pushButtonSearch, &QPushButton::clicked, this, &Static8::search);
     connect(ui->comboBoxCategory, &QComboBox::currentIndexChanged, this, &Static8::categoryIndexChanged);
     connect(ui->comboBoxPokemon, &QComboBox::currentIndexChanged, this, &Static8::pokemonIndexChanged);
     connect(ui->filter, &Filter::showStatsChanged, model, &StaticModel8::setShowStats);
+    connect(ui->filter, &Filter::showStatsChanged, searcherModel, &StaticSearcherModel8::setShowStats);
 
     updateProfiles();
     categoryIndexChanged(0);
@@ -72,6 +83,10 @@ Static8::Static8(QWidget *parent) : QWidget(parent), ui(new Ui::Static8)
 
     QSettings setting;
     setting.beginGroup(settingPrefix);
+    if (setting.contains("observations"))
+    {
+        ui->plainTextEditObservations->setPlainText(setting.value("observations").toString());
+    }
     if (setting.contains("geometry"))
     {
         this->restoreGeometry(setting.value("geometry").toByteArray());
@@ -83,6 +98,7 @@ Static8::~Static8()
 {
     QSettings setting;
     setting.beginGroup(settingPrefix);
+    setting.setValue("observations", ui->plainTextEditObservations->toPlainText());
     setting.setValue("geometry", this->saveGeometry());
     setting.endGroup();
 
@@ -141,8 +157,12 @@ void Static8::generate()
     auto filter = ui->filter->getFilter<StateFilter>();
     StaticGenerator8 generator(initialAdvances, maxAdvances, offset, lead, *staticTemplate, *currentProfile, filter);
 
-    auto states = generator.generate(seed0, seed1);
+    QSettings settings;
+    int threads = settings.value("settings/threads").toInt();
+
+    auto states = generator.generate(seed0, seed1, threads);
     model->addItems(states);
+    ui->tabWidgetResults->setCurrentWidget(ui->tabGenerator);
 }
 
 void Static8::pokemonIndexChanged(int index)
@@ -166,3 +186,117 @@ void Static8::profileChanged(const Profile8 &profile)
 {
     currentProfile = &profile;
 }
+
+void Static8::search()
+{
+    std::vector<XorshiftObservation> observations;
+    const QStringList lines = ui->plainTextEditObservations->toPlainText().split('\n', Qt::SkipEmptyParts);
+    for (const QString &line : lines)
+    {
+        QStringList values = line.simplified().split(' ', Qt::SkipEmptyParts);
+        if (values.isEmpty())
+        {
+            continue;
+        }
+
+        bool advanceFlag = false;
+        bool valueFlag = false;
+        bool maskFlag = true;
+        XorshiftObservation observation { values[0].toUInt(&advanceFlag, 0), 0xffffffff, 0 };
+        if (values.size() >= 2)
+        {
+            observation.value = values[1].toUInt(&valueFlag, 0);
+        }
+        if (values.size() == 3)
+        {
+            observation.mask = values[2].toUInt(&maskFlag, 0);
+        }
+
+        if (!advanceFlag || !valueFlag || !maskFlag || values.size() > 3)
+        {
+            QMessageBox msg(QMessageBox::Warning, tr("Invalid observation"),
+                            tr("Each observation must be an advance, a value, and an optional mask: %1").arg(line));
+            msg.exec();
+            return;
+        }
+        observations.emplace_back(observation);
+    }
+
+    if (observations.empty())
+    {
+        QMessageBox msg(QMessageBox::Warning, tr("Missing observations"), tr("Please insert the observed PRNG outputs"));
+        msg.exec();
+        return;
+    }
+
+    if (!ui->filter->isValid())
+    {
+        return;
+    }
+
+    u32 initialAdvances = ui->textBoxInitialAdvances->getUInt();
+    u32 maxAdvances = ui->textBoxMaxAdvances->getUInt();
+    u32 offset = ui->textBoxOffset->getUInt();
+    auto lead = ui->comboMenuLead->getEnum<Lead>();
+    const StaticTemplate8 *staticTemplate
+        = Encounters8::getStaticEncounter(ui->comboBoxCategory->currentIndex(), ui->comboBoxPokemon->getCurrentInt());
+
+    auto filter = ui->filter->getFilter<StateFilter>();
+    StaticGenerator8 generator(initialAdvances, maxAdvances, offset, lead, *staticTemplate, *currentProfile, filter);
+
+    auto *searcher = new Searcher8<StaticGenerator8, State8>(observations, generator);
+    if (searcher->getMaxProgress() == 0)
+    {
+        delete searcher;
+        QMessageBox msg(QMessageBox::Warning, tr("Unsolvable observations"),
+                        tr("Observations are contradictory or leave too many PRNG state bits unknown"));
+        msg.exec();
+        return;
+    }
+    searcher->setMaxProgress(searcher->getMaxProgress());
+
+    searcherModel->clearModel();
+    ui->tabWidgetResults->setCurrentWidget(ui->tabSearcher);
+
+    ui->pushButtonSearch->setEnabled(false);
+    ui->pushButtonCancel->setEnabled(true);
+
+    QSettings settings;
+    int threads = settings.value("settings/threads").toInt();
+
+    auto *thread = QThread::create([=] { searcher->startSearch(threads); });
+    connect(thread, &QThread::finished, thread, &QThread::deleteLater);
+    connect(ui->pushButtonCancel, &QPushButton::clicked, [searcher] { searcher->cancelSearch(); });
+
+    auto *timer = new QTimer();
+    timer->callOnTimeout(this, [=] {
+        searcherModel->addItems(searcher->getResults());
+        ui->progressBar->setValue(searcher->getProgress());
+    });
+    connect(thread, &QThread::finished, timer, &QTimer::stop);
+    connect(thread, &QThread::finished, timer, &QTimer::deleteLater);
+    connect(timer, &QTimer::destroyed, this, [=] {
+        ui->pushButtonSearch->setEnabled(true);
+        ui->pushButtonCancel->setEnabled(false);
+        searcherModel->addItems(searcher->getResults());
+        ui->progressBar->setValue(searcher->getProgress());
+        delete searcher;
+    });
+
+    thread->start();
+    timer->start(1000);
+}
+
+void Static8::transferSeeds()
+{
+    QModelIndex index = ui->tableViewSearcher->currentIndex();
+    if (!index.isValid())
+    {
+        return;
+    }
+
+    const auto &state = searcherModel->getItem(index.row());
+    ui->textBoxSeed0->setText(QString::number(state.getSeed0(), 16));
+    ui->textBoxSeed1->setText(QString::number(state.getSeed1(), 16));
+    generate();
+}
@@ -24,6 +24,7 @@
 
 class Profile8;
 class StaticModel8;
+class StaticSearcherModel8;
 
 namespace Ui
 {
@@ -66,6 +67,7 @@ private:
 
     const Profile8 *currentProfile;
     StaticModel8 *model;
+    StaticSearcherModel8 *searcherModel;
 
 private slots:
     /**
@@ -93,6 +95,16 @@ private slots:
      * @param profile Selected profile
      */
     void profileChanged(const Profile8 &profile);
+
+    /**
+     * @brief Recovers the PRNG states that agree with the observed outputs and generates static encounters from each of them
+     */
+    void search();
+
+    /**
+     * @brief Copies the seeds of the selected search result to the generator and generates from them
+     */
+    void transferSeeds();
 };
 
 #endif // STATIC8_HPP
@@ -152,7 +152,10 @@ void Underground::generate()
     UndergroundGenerator generator(initialAdvances, maxAdvances, offset, lead, bonus, levelFlag,
                                    encounters[ui->comboBoxLocation->currentIndex()], *currentProfile, filter);
 
-    auto states = generator.generate(seed0, seed1);
+    QSettings settings;
+    int threads = settings.value("settings/threads").toInt();
+
+    auto states = generator.generate(seed0, seed1, threads);
     model->addItems(states);
 }
 
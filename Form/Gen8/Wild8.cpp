@@ -235,7 +235,10 @@ void Wild8::generate()
     WildGenerator8 generator(initialAdvances, maxAdvances, offset, method, lead, feebasTile,
                              encounters[ui->comboBoxLocation->currentIndex()], *currentProfile, filter);
 
-    auto states = generator.generate(seed0, seed1, fixedSlot);
+    QSettings settings;
+    int threads = settings.value("settings/threads").toInt();
+
+    auto states = generator.generate(seed0, seed1, fixedSlot, threads);
     model->addItems(states);
 }
 
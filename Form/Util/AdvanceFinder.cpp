@@ -26,6 +26,7 @@
 #include <Model/Gen4/IRNGProvider4.hpp>
 #include <Model/Gen5/IRNGProvider5.hpp>
 #include <Model/IndexFilterProxyModel.hpp>
+#include <QSettings>
 #include <array>
 
 AdvanceFinder::AdvanceFinder(QAbstractItemModel *sourceModel, QTableView *sourceTableView, const Profile *profile, QWidget *parent) :
@@ -201,7 +202,17 @@ void AdvanceFinder::search()
         return;
     }
 
-    std::vector<size_t> matches = AdvanceSearcher::findMatches(model->sourceModel()->rowCount(), sequence, getter);
+    int rowCount = model->sourceModel()->rowCount();
+    std::vector<u8> values(rowCount);
+    for (int row = 0; row < rowCount; row++)
+    {
+        values[row] = getter(row);
+    }
+
+    QSettings settings;
+    int threads = settings.value("settings/threads").toInt();
+
+    std::vector<size_t> matches = AdvanceSearcher::findMatches(values, sequence, threads);
 
     model->setFilteredIndexes(matches.size() <= 5 ? matches : std::vector<size_t>());
     ui->labelPossibleResults->setText(tr("Possible Results: %1").arg(matches.size()));
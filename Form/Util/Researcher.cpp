@@ -29,6 +29,7 @@
 #include <Model/Util/ResearcherModel.hpp>
 #include <QMessageBox>
 #include <QSettings>
+#include <thread>
 
 /**
  * @brief Gets the \p custom value from the current \p state or \p states
@@ -105,11 +106,7 @@ static std::vector<u64> getStates(RNGType rng, u32 initial, u32 max)
 {
     std::vector<u64> states;
 
-    if constexpr (std::is_same_v<RNGType, SFMT>)
-    {
-        rng.advance(initial);
-    }
-    else if constexpr (!std::is_same_v<RNGType, MT>)
+    if constexpr (!std::is_same_v<RNGType, SFMT>)
     {
         rng.jump(initial);
     }
@@ -122,6 +119,45 @@ static std::vector<u64> getStates(RNGType rng, u32 initial, u32 max)
     return states;
 }
 
+/**
+ * @brief Generates the PRNG states of a MT stream by splitting it into a consecutive substream per thread
+ *
+ * @param rng RNG object to generate numbers
+ * @param max Maximum advances
+ *
+ * @return Vector of PRNG states
+ */
+static std::vector<u64> getMTStates(const MT &rng, u32 max)
+{
+    QSettings settings;
+    int threads = max < 0x100000 ? 1 : std::max(settings.value("settings/threads").toInt(), 1);
+
+    u32 length = static_cast<u32>((static_cast<u64>(max) + threads - 1) / threads);
+    std::vector<MT> streams = rng.split(threads, length);
+    std::vector<u64> states(max);
+
+    auto *threadContainer = new std::thread[threads];
+    for (int i = 0; i < threads; i++)
+    {
+        threadContainer[i] = std::thread([&states, &streams, i, length, max] {
+            u64 start = static_cast<u64>(i) * length;
+            u64 end = std::min<u64>(start + length, max);
+            for (u64 j = start; j < end; j++)
+            {
+                states[j] = streams[i].next();
+            }
+        });
+    }
+
+    for (int i = 0; i < threads; i++)
+    {
+        threadContainer[i].join();
+    }
+    delete[] threadContainer;
+
+    return states;
+}
+
 Researcher::Researcher(QWidget *parent) : QWidget(parent), ui(new Ui::Researcher)
 {
     ui->setupUi(this);
@@ -257,7 +293,7 @@ void Researcher::generate()
             rngStates = getStates(ARNGR(seed), initialAdvances, maxAdvances);
             break;
         case 6:
-            rngStates = getStates<MT>(MT(seed, initialAdvances), initialAdvances, maxAdvances);
+            rngStates = getMTStates(MT(seed, initialAdvances), maxAdvances);
             break;
         }
     }
@@ -277,7 +313,7 @@ void Researcher::generate()
             {
                 seed >>= 32;
             }
-            rngStates = getStates<SFMT>(SFMT(seed), initialAdvances, maxAdvances);
+            rngStates = getStates<SFMT>(SFMT(seed, initialAdvances), initialAdvances, maxAdvances);
             break;
         case 3:
             rngStates = getStates<Xoroshiro>(Xoroshiro(seed), initialAdvances, maxAdvances);
@@ -131,6 +131,26 @@ QVariant GameCubeSearcherModel::data(const QModelIndex &index, int role) const
     return QVariant();
 }
 
+bool GameCubeSearcherModel::hasSortKey(int column) const
+{
+    return column <= 1 || (column >= 5 && column <= 10) || column == 12;
+}
+
+u64 GameCubeSearcherModel::getSortKey(const SearcherState &state, int column) const
+{
+    switch (column)
+    {
+    case 0:
+        return state.getSeed();
+    case 1:
+        return state.getPID();
+    case 12:
+        return state.getHiddenPowerStrength();
+    default:
+        return showStats ? state.getStat(column - 5) : state.getIV(column - 5);
+    }
+}
+
 QVariant GameCubeSearcherModel::headerData(int section, Qt::Orientation orientation, int role) const
 {
     if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
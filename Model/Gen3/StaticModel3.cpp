@@ -131,6 +131,26 @@ QVariant StaticSearcherModel3::data(const QModelIndex &index, int role) const
     return QVariant();
 }
 
+bool StaticSearcherModel3::hasSortKey(int column) const
+{
+    return column <= 1 || (column >= 5 && column <= 10) || column == 12;
+}
+
+u64 StaticSearcherModel3::getSortKey(const SearcherState &state, int column) const
+{
+    switch (column)
+    {
+    case 0:
+        return state.getSeed();
+    case 1:
+        return state.getPID();
+    case 12:
+        return state.getHiddenPowerStrength();
+    default:
+        return showStats ? state.getStat(column - 5) : state.getIV(column - 5);
+    }
+}
+
 QVariant StaticSearcherModel3::headerData(int section, Qt::Orientation orientation, int role) const
 {
     if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
@@ -261,6 +261,28 @@ QVariant WildSearcherModel3::data(const QModelIndex &index, int role) const
     return QVariant();
 }
 
+bool WildSearcherModel3::hasSortKey(int column) const
+{
+    return column == 0 || column == 3 || column == 4 || (column >= 8 && column <= 13) || column == 15;
+}
+
+u64 WildSearcherModel3::getSortKey(const WildSearcherState &state, int column) const
+{
+    switch (column)
+    {
+    case 0:
+        return state.getSeed();
+    case 3:
+        return state.getLevel();
+    case 4:
+        return state.getPID();
+    case 15:
+        return state.getHiddenPowerStrength();
+    default:
+        return showStats ? state.getStat(column - 8) : state.getIV(column - 8);
+    }
+}
+
 QVariant WildSearcherModel3::headerData(int section, Qt::Orientation orientation, int role) const
 {
     if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
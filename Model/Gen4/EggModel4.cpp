@@ -201,6 +201,33 @@ QVariant EggSearcherModel4::data(const QModelIndex &index, int role) const
     return QVariant();
 }
 
+bool EggSearcherModel4::hasSortKey(int column) const
+{
+    // Inherited IVs are displayed as text
+    return (column >= 0 && column <= 4) || (!showInheritance && column >= 8 && column <= 13) || column == 15;
+}
+
+u64 EggSearcherModel4::getSortKey(const EggSearcherState4 &state, int column) const
+{
+    switch (column)
+    {
+    case 0:
+        return state.getSeed();
+    case 1:
+        return state.getSeed() & 0xffff;
+    case 2:
+        return state.getState().getAdvances();
+    case 3:
+        return state.getState().getPickupAdvances();
+    case 4:
+        return state.getState().getPID();
+    case 15:
+        return state.getState().getHiddenPowerStrength();
+    default:
+        return showStats ? state.getState().getStat(column - 8) : state.getState().getIV(column - 8);
+    }
+}
+
 QVariant EggSearcherModel4::headerData(int section, Qt::Orientation orientation, int role) const
 {
     if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
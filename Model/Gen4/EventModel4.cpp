@@ -144,6 +144,28 @@ QVariant EventSearcherModel4::data(const QModelIndex &index, int role) const
     return QVariant();
 }
 
+bool EventSearcherModel4::hasSortKey(int column) const
+{
+    return (column >= 0 && column <= 8) || column == 10;
+}
+
+u64 EventSearcherModel4::getSortKey(const SearcherState4 &state, int column) const
+{
+    switch (column)
+    {
+    case 0:
+        return state.getSeed();
+    case 1:
+        return state.getSeed() & 0xffff;
+    case 2:
+        return state.getAdvances();
+    case 10:
+        return state.getHiddenPowerStrength();
+    default:
+        return showStats ? state.getStat(column - 3) : state.getIV(column - 3);
+    }
+}
+
 QVariant EventSearcherModel4::headerData(int section, Qt::Orientation orientation, int role) const
 {
     if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
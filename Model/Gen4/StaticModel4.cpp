@@ -252,6 +252,32 @@ QVariant StaticSearcherModel4::data(const QModelIndex &index, int role) const
     return QVariant();
 }
 
+bool StaticSearcherModel4::hasSortKey(int column) const
+{
+    return column <= 2 || column == 4 || column == 5 || (column >= 9 && column <= 14) || column == 16;
+}
+
+u64 StaticSearcherModel4::getSortKey(const SearcherState4 &state, int column) const
+{
+    switch (column)
+    {
+    case 0:
+        return state.getSeed();
+    case 1:
+        return state.getSeed() & 0xffff;
+    case 2:
+        return (state.getSeed() >> 16) & 0xff;
+    case 4:
+        return state.getAdvances();
+    case 5:
+        return state.getPID();
+    case 16:
+        return state.getHiddenPowerStrength();
+    default:
+        return showStats ? state.getStat(column - 9) : state.getIV(column - 9);
+    }
+}
+
 QVariant StaticSearcherModel4::headerData(int section, Qt::Orientation orientation, int role) const
 {
     if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
@@ -31,6 +31,38 @@
 
 namespace
 {
+/**
+ * @brief Maps a displayed searcher column to the column of the full layout
+ *
+ * @param column Displayed column, excluding the lead column
+ * @param showStepEncounter Whether step encounter columns are displayed
+ * @param showStepMovement Whether the step movement column is displayed
+ *
+ * @return Column of the full layout, -1 for the lead column
+ */
+int getSearcherColumn(int column, bool showStepEncounter, bool showStepMovement)
+{
+    if (column == 3)
+    {
+        return -1;
+    }
+
+    if (column > 3)
+    {
+        column--;
+    }
+
+    if (!showStepEncounter && column >= 4)
+    {
+        column += 3;
+    }
+    else if (showStepEncounter && !showStepMovement && column >= 5)
+    {
+        column++;
+    }
+    return column;
+}
+
 QString getSynchronizeLeadName4(Lead lead, u32 flags, u8 targetNature)
 {
     constexpr u32 allNatures = (1 << 25) - 1;
@@ -299,19 +331,7 @@ QVariant WildSearcherModel4::data(const QModelIndex &index, int role) const
             return LeadDisplay::getLeadName(state.getLeadMask());
         }
 
-        if (column > 3)
-        {
-            column--;
-        }
-
-        if (!showStepEncounter && column >= 4)
-        {
-            column += 3;
-        }
-        else if (showStepEncounter && !showStepMovement && column >= 5)
-        {
-            column++;
-        }
+        column = getSearcherColumn(column, showStepEncounter, showStepMovement);
         switch (column)
         {
         case 0:
@@ -401,6 +421,38 @@ QVariant WildSearcherModel4::data(const QModelIndex &index, int role) const
     return QVariant();
 }
 
+bool WildSearcherModel4::hasSortKey(int column) const
+{
+    column = getSearcherColumn(column, showStepEncounter, showStepMovement);
+    return (column >= 0 && column <= 4) || column == 9 || column == 10 || (column >= 14 && column <= 19) || column == 21;
+}
+
+u64 WildSearcherModel4::getSortKey(const WildSearcherState4 &state, int column) const
+{
+    column = getSearcherColumn(column, showStepEncounter, showStepMovement);
+    switch (column)
+    {
+    case 0:
+        return state.getSeed();
+    case 1:
+        return state.getSeed() & 0xffff;
+    case 2:
+        return (state.getSeed() >> 16) & 0xff;
+    case 3:
+        return state.getAdvances();
+    case 4:
+        return state.getMovements();
+    case 9:
+        return state.getLevel();
+    case 10:
+        return state.getPID();
+    case 21:
+        return state.getHiddenPowerStrength();
+    default:
+        return showStats ? state.getStat(column - 14) : state.getIV(column - 14);
+    }
+}
+
 QVariant WildSearcherModel4::headerData(int section, Qt::Orientation orientation, int role) const
 {
     if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
@@ -59,6 +59,26 @@ QVariant AdjacentSeedsModel::data(const QModelIndex &index, int role) const
     return QVariant();
 }
 
+bool AdjacentSeedsModel::hasSortKey(int column) const
+{
+    return column == 0 || (column >= 2 && column <= 9);
+}
+
+u64 AdjacentSeedsModel::getSortKey(const AdjacentSeedsState &state, int column) const
+{
+    switch (column)
+    {
+    case 0:
+        return state.getSeed();
+    case 2:
+        return state.getTimer0();
+    case 3:
+        return state.getIVAdvance();
+    default:
+        return state.getIV(column - 4);
+    }
+}
+
 QVariant AdjacentSeedsModel::headerData(int section, Qt::Orientation orientation, int role) const
 {
     if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
@@ -164,6 +164,31 @@ QVariant DreamRadarSearcherModel5::data(const QModelIndex &index, int role) cons
     return QVariant();
 }
 
+bool DreamRadarSearcherModel5::hasSortKey(int column) const
+{
+    return column <= 2 || (column >= 6 && column <= 11) || column == 13 || column == 17;
+}
+
+u64 DreamRadarSearcherModel5::getSortKey(const SearcherState5<DreamRadarState> &display, int column) const
+{
+    const auto &state = display.getState();
+    switch (column)
+    {
+    case 0:
+        return display.getInitialSeed();
+    case 1:
+        return state.getAdvances();
+    case 2:
+        return state.getPID();
+    case 13:
+        return state.getHiddenPowerStrength();
+    case 17:
+        return display.getTimer0();
+    default:
+        return showStats ? state.getStat(column - 6) : state.getIV(column - 6);
+    }
+}
+
 QVariant DreamRadarSearcherModel5::headerData(int section, Qt::Orientation orientation, int role) const
 {
     if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
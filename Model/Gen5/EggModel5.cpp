@@ -190,6 +190,32 @@ QVariant EggSearcherModel5::data(const QModelIndex &index, int role) const
     return QVariant();
 }
 
+bool EggSearcherModel5::hasSortKey(int column) const
+{
+    // Inherited IVs are displayed as text
+    return column <= 2 || (!showInheritance && column >= 6 && column <= 11) || column == 13 || column == 17;
+}
+
+u64 EggSearcherModel5::getSortKey(const SearcherState5<EggState5> &display, int column) const
+{
+    const auto &state = display.getState();
+    switch (column)
+    {
+    case 0:
+        return display.getInitialSeed();
+    case 1:
+        return state.getAdvances();
+    case 2:
+        return state.getPID();
+    case 13:
+        return state.getHiddenPowerStrength();
+    case 17:
+        return display.getTimer0();
+    default:
+        return showStats ? state.getStat(column - 6) : state.getIV(column - 6);
+    }
+}
+
 QVariant EggSearcherModel5::headerData(int section, Qt::Orientation orientation, int role) const
 {
     if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
@@ -409,6 +409,35 @@ QVariant HiddenGrottoSearcherModel5::data(const QModelIndex &index, int role) co
     return QVariant();
 }
 
+bool HiddenGrottoSearcherModel5::hasSortKey(int column) const
+{
+    return (column >= 0 && column <= 4) || (column >= 8 && column <= 13) || column == 15 || column == 19;
+}
+
+u64 HiddenGrottoSearcherModel5::getSortKey(const SearcherState5<State5> &display, int column) const
+{
+    const auto &state = display.getState();
+    switch (column)
+    {
+    case 0:
+        return display.getInitialSeed();
+    case 1:
+        return state.getAdvances();
+    case 2:
+        return state.getIVAdvances();
+    case 3:
+        return state.getLevel();
+    case 4:
+        return state.getPID();
+    case 15:
+        return state.getHiddenPowerStrength();
+    case 19:
+        return display.getTimer0();
+    default:
+        return showStats ? state.getStat(column - 8) : state.getIV(column - 8);
+    }
+}
+
 QVariant HiddenGrottoSearcherModel5::headerData(int section, Qt::Orientation orientation, int role) const
 {
     if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
@@ -278,6 +278,27 @@ public slots:
      */
     void setShowStats(bool flag);
 
+protected:
+    /**
+     * @brief Returns if the \p column is sorted by a key read from the state instead of its displayed data
+     *
+     * @param column Column index
+     *
+     * @return true Column has a sort key
+     * @return false Column is sorted by its displayed data
+     */
+    bool hasSortKey(int column) const override;
+
+    /**
+     * @brief Returns the sort key of the \p column for the \p display
+     *
+     * @param display State to read
+     * @param column Column index
+     *
+     * @return Sort key
+     */
+    u64 getSortKey(const SearcherState5<State5> &display, int column) const override;
+
 private:
     QStringList header = { tr("Seed"),      tr("Advances"), tr("IV Advances"), tr("Level"), tr("PID"),    tr("Shiny"),
                            tr("Nature"),    tr("Ability"),  tr("HP"),          tr("Atk"),   tr("Def"),    tr("SpA"),
@@ -107,6 +107,24 @@ QVariant PhenomenonSearcherModel5::data(const QModelIndex &index, int role) cons
     return QVariant();
 }
 
+bool PhenomenonSearcherModel5::hasSortKey(int column) const
+{
+    return column <= 1 || column == 4;
+}
+
+u64 PhenomenonSearcherModel5::getSortKey(const SearcherState5<PhenomenonState> &display, int column) const
+{
+    switch (column)
+    {
+    case 0:
+        return display.getInitialSeed();
+    case 1:
+        return display.getState().getAdvances();
+    default:
+        return display.getTimer0();
+    }
+}
+
 QVariant PhenomenonSearcherModel5::headerData(int section, Qt::Orientation orientation, int role) const
 {
     if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
@@ -117,6 +117,27 @@ public:
      */
     QVariant headerData(int section, Qt::Orientation orientation, int role) const override;
 
+protected:
+    /**
+     * @brief Returns if the \p column is sorted by a key read from the state instead of its displayed data
+     *
+     * @param column Column index
+     *
+     * @return true Column has a sort key
+     * @return false Column is sorted by its displayed data
+     */
+    bool hasSortKey(int column) const override;
+
+    /**
+     * @brief Returns the sort key of the \p column for the \p display
+     *
+     * @param display State to read
+     * @param column Column index
+     *
+     * @return Sort key
+     */
+    u64 getSortKey(const SearcherState5<PhenomenonState> &display, int column) const override;
+
 private:
     QStringList header = { tr("Seed"), tr("Advances"), tr("Slot"), tr("Date/Time"), tr("Timer0"), tr("Buttons") };
 };
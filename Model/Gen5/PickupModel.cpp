@@ -218,6 +218,24 @@ QVariant PickupSearcherModel5::data(const QModelIndex &index, int role) const
     return QVariant();
 }
 
+bool PickupSearcherModel5::hasSortKey(int column) const
+{
+    return column <= 1 || column == 9;
+}
+
+u64 PickupSearcherModel5::getSortKey(const SearcherState5<PickupState> &display, int column) const
+{
+    switch (column)
+    {
+    case 0:
+        return display.getInitialSeed();
+    case 1:
+        return display.getState().getAdvances();
+    default:
+        return display.getTimer0();
+    }
+}
+
 QVariant PickupSearcherModel5::headerData(int section, Qt::Orientation orientation, int role) const
 {
     if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
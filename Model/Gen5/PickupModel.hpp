@@ -56,6 +56,27 @@ public:
     QVariant data(const QModelIndex &index, int role) const override;
     QVariant headerData(int section, Qt::Orientation orientation, int role) const override;
 
+protected:
+    /**
+     * @brief Returns if the \p column is sorted by a key read from the state instead of its displayed data
+     *
+     * @param column Column index
+     *
+     * @return true Column has a sort key
+     * @return false Column is sorted by its displayed data
+     */
+    bool hasSortKey(int column) const override;
+
+    /**
+     * @brief Returns the sort key of the \p column for the \p display
+     *
+     * @param display State to read
+     * @param column Column index
+     *
+     * @return Sort key
+     */
+    u64 getSortKey(const SearcherState5<PickupState> &display, int column) const override;
+
 private:
     QStringList header = { tr("Seed"),   tr("Advances"), tr("Item 1"), tr("Item 2"), tr("Item 3"),
                            tr("Item 4"), tr("Item 5"),   tr("Item 6"), tr("Date/Time"), tr("Timer0"), tr("Buttons") };
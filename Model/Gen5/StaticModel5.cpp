@@ -258,6 +258,46 @@ QVariant StaticSearcherModel5::data(const QModelIndex &index, int role) const
     return QVariant();
 }
 
+bool StaticSearcherModel5::hasSortKey(int column) const
+{
+    if (showPassPower && column >= 2)
+    {
+        if (column == 2)
+        {
+            return false;
+        }
+        column--;
+    }
+    return column == 0 || (column >= 2 && column <= 4) || (column >= 8 && column <= 13) || column == 15 || column == 19;
+}
+
+u64 StaticSearcherModel5::getSortKey(const SearcherState5<State5> &display, int column) const
+{
+    if (showPassPower && column > 2)
+    {
+        column--;
+    }
+
+    const auto &state = display.getState();
+    switch (column)
+    {
+    case 0:
+        return display.getInitialSeed();
+    case 2:
+        return state.getAdvances();
+    case 3:
+        return state.getIVAdvances();
+    case 4:
+        return state.getPID();
+    case 15:
+        return state.getHiddenPowerStrength();
+    case 19:
+        return display.getTimer0();
+    default:
+        return showStats ? state.getStat(column - 8) : state.getIV(column - 8);
+    }
+}
+
 QVariant StaticSearcherModel5::headerData(int section, Qt::Orientation orientation, int role) const
 {
     if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
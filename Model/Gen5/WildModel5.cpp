@@ -27,6 +27,7 @@
 #include <QColor>
 #include <QFont>
 #include <QStringList>
+#include <array>
 #include <vector>
 
 namespace
@@ -40,6 +41,7 @@ constexpr int searcherDataStepsColumn = 3;
 constexpr int searcherDataPhenomenonColumn = 4;
 constexpr int searcherDataIVAdvancesColumn = 5;
 constexpr int searcherDataFirstPayloadColumn = 6;
+constexpr int searcherDataTimer0Column = 24;
 constexpr int searcherHeaderAdvancesColumn = 2;
 constexpr int searcherHeaderStepsColumn = 4;
 constexpr int searcherHeaderPhenomenonColumn = 5;
@@ -238,6 +240,29 @@ std::vector<int> getSearcherHeaderColumns(bool showPassPower, bool showMovingTri
 
     return columns;
 }
+
+int getSearcherColumn(int index, bool showPassPower, bool showMovingTrigger, bool showPhenomenon)
+{
+    // Same layout as getSearcherColumns without building the vector, used per row while sorting
+    std::array<int, 6> prefix;
+    int size = 0;
+    prefix[size++] = 0;
+    if (showPassPower)
+    {
+        prefix[size++] = searcherDataPassPowerColumn;
+    }
+    prefix[size++] = searcherDataAdvancesColumn;
+    prefix[size++] = searcherDataIVAdvancesColumn;
+    if (showMovingTrigger)
+    {
+        prefix[size++] = searcherDataStepsColumn;
+    }
+    if (showPhenomenon)
+    {
+        prefix[size++] = searcherDataPhenomenonColumn;
+    }
+    return index < size ? prefix[index] : searcherDataFirstPayloadColumn + index - size;
+}
 }
 
 WildGeneratorModel5::WildGeneratorModel5(QObject *parent) : TableModel(parent), showStats(false), showMovingTrigger(false), showPhenomenon(false)
@@ -560,6 +585,35 @@ QVariant WildSearcherModel5::data(const QModelIndex &index, int role) const
     return QVariant();
 }
 
+bool WildSearcherModel5::hasSortKey(int column) const
+{
+    if (column == 1)
+    {
+        return false;
+    }
+
+    // Item encounters display "-" in the Pokemon columns, so only the columns shared by every state have keys
+    column = getSearcherColumn(column > 1 ? column - 1 : column, showPassPower, showMovingTrigger, showPhenomenon);
+    return column == 0 || column == searcherDataAdvancesColumn || column == searcherDataIVAdvancesColumn
+        || column == searcherDataTimer0Column;
+}
+
+u64 WildSearcherModel5::getSortKey(const SearcherState5<WildState5> &display, int column) const
+{
+    column = getSearcherColumn(column > 1 ? column - 1 : column, showPassPower, showMovingTrigger, showPhenomenon);
+    switch (column)
+    {
+    case 0:
+        return display.getInitialSeed();
+    case searcherDataAdvancesColumn:
+        return display.getState().getAdvances();
+    case searcherDataIVAdvancesColumn:
+        return display.getState().getIVAdvances();
+    default:
+        return display.getTimer0();
+    }
+}
+
 QVariant WildSearcherModel5::headerData(int section, Qt::Orientation orientation, int role) const
 {
     if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
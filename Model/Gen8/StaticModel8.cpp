@@ -20,6 +20,52 @@
 #include "StaticModel8.hpp"
 #include <Core/Util/Translator.hpp>
 
+static QVariant getStateData(const State8 &state, int column, bool showStats)
+{
+    switch (column)
+    {
+    case 0:
+        return state.getAdvances();
+    case 1:
+        return QString::number(state.getEC(), 16).toUpper().rightJustified(8, '0');
+    case 2:
+        return QString::number(state.getPID(), 16).toUpper().rightJustified(8, '0');
+    case 3:
+    {
+        u8 shiny = state.getShiny();
+        return shiny == 2 ? StaticModel8::tr("Square") : shiny == 1 ? StaticModel8::tr("Star") : StaticModel8::tr("No");
+    }
+    case 4:
+        return QString::fromStdString(Translator::getNature(state.getNature()));
+    case 5:
+        if (state.getAbility() == 0 || state.getAbility() == 1)
+        {
+            return QString("%1: %2").arg(state.getAbility()).arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
+        }
+        else
+        {
+            return QString("H (%2)").arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
+        }
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+        return showStats ? state.getStat(column - 6) : state.getIV(column - 6);
+    case 12:
+        return QString::fromStdString(Translator::getGender(state.getGender()));
+    case 13:
+        return state.getHeight();
+    case 14:
+        return state.getWeight();
+    case 15:
+        return QString::fromStdString(Translator::getCharacteristic(state.getCharacteristic(), CharacteristicGeneration::Gen8));
+    }
+
+    return QVariant();
+}
+
 StaticModel8::StaticModel8(QObject *parent) : TableModel(parent), showStats(false)
 {
 }
@@ -30,6 +76,40 @@ int StaticModel8::columnCount(const QModelIndex &parent) const
 }
 
 QVariant StaticModel8::data(const QModelIndex &index, int role) const
+{
+    if (role == Qt::DisplayRole)
+    {
+        return getStateData(model[index.row()], index.column(), showStats);
+    }
+
+    return QVariant();
+}
+
+QVariant StaticModel8::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
+    {
+        return header[section];
+    }
+    return QVariant();
+}
+
+void StaticModel8::setShowStats(bool flag)
+{
+    showStats = flag;
+    emit dataChanged(index(0, 6), index(rowCount() - 1, 11), { Qt::DisplayRole });
+}
+
+StaticSearcherModel8::StaticSearcherModel8(QObject *parent) : TableModel(parent), showStats(false)
+{
+}
+
+int StaticSearcherModel8::columnCount(const QModelIndex &parent) const
+{
+    return 18;
+}
+
+QVariant StaticSearcherModel8::data(const QModelIndex &index, int role) const
 {
     if (role == Qt::DisplayRole)
     {
@@ -38,51 +118,18 @@ QVariant StaticModel8::data(const QModelIndex &index, int role) const
         switch (column)
         {
         case 0:
-            return state.getAdvances();
+            return QString::number(state.getSeed0(), 16).toUpper().rightJustified(16, '0');
         case 1:
-            return QString::number(state.getEC(), 16).toUpper().rightJustified(8, '0');
-        case 2:
-            return QString::number(state.getPID(), 16).toUpper().rightJustified(8, '0');
-        case 3:
-        {
-            u8 shiny = state.getShiny();
-            return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
-        }
-        case 4:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
-        case 5:
-            if (state.getAbility() == 0 || state.getAbility() == 1)
-            {
-                return QString("%1: %2")
-                    .arg(state.getAbility())
-                    .arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
-            }
-            else
-            {
-                return QString("H (%2)").arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
-            }
-        case 6:
-        case 7:
-        case 8:
-        case 9:
-        case 10:
-        case 11:
-            return showStats ? state.getStat(column - 6) : state.getIV(column - 6);
-        case 12:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
-        case 13:
-            return state.getHeight();
-        case 14:
-            return state.getWeight();
-        case 15:
-            return QString::fromStdString(Translator::getCharacteristic(state.getCharacteristic(), CharacteristicGeneration::Gen8));
+            return QString::number(state.getSeed1(), 16).toUpper().rightJustified(16, '0');
+        default:
+            return getStateData(state.getState(), column - 2, showStats);
         }
     }
 
     return QVariant();
 }
 
-QVariant StaticModel8::headerData(int section, Qt::Orientation orientation, int role) const
+QVariant StaticSearcherModel8::headerData(int section, Qt::Orientation orientation, int role) const
 {
     if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
     {
@@ -91,8 +138,8 @@ QVariant StaticModel8::headerData(int section, Qt::Orientation orientation, int
     return QVariant();
 }
 
-void StaticModel8::setShowStats(bool flag)
+void StaticSearcherModel8::setShowStats(bool flag)
 {
     showStats = flag;
-    emit dataChanged(index(0, 6), index(rowCount() - 1, 11), { Qt::DisplayRole });
+    emit dataChanged(index(0, 8), index(rowCount() - 1, 13), { Qt::DisplayRole });
 }
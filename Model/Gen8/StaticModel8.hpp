@@ -20,6 +20,7 @@
 #ifndef STATICMODEL8_HPP
 #define STATICMODEL8_HPP
 
+#include <Core/Gen8/States/SearcherState8.hpp>
 #include <Core/Gen8/States/State8.hpp>
 #include <Model/TableModel.hpp>
 
@@ -82,4 +83,64 @@ private:
     bool showStats;
 };
 
+/**
+ * @brief Provides a table model implementation to show static encounter information recovered from observed PRNG outputs for Gen 8
+ */
+class StaticSearcherModel8 : public TableModel<SearcherState8<State8>>
+{
+    Q_OBJECT
+public:
+    /**
+     * @brief Construct a new StaticSearcherModel8 object
+     *
+     * @param parent Parent object, which takes memory ownership
+     */
+    StaticSearcherModel8(QObject *parent);
+
+    /**
+     * @brief Returns the number of columns in the model
+     *
+     * @param parent Unused parent index
+     *
+     * @return Number of columns
+     */
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    /**
+     * @brief Returns data at the \p index with \p role
+     *
+     * @param index Row/column index
+     * @param role Model data role
+     *
+     * @return Data at index
+     */
+    QVariant data(const QModelIndex &index, int role) const override;
+
+    /**
+     * @brief Returns header text at the \p section, \p orientation, and \p role
+     *
+     * @param section Column index
+     * @param orientation Header position
+     * @param role Model data role
+     *
+     * @return Header text at column
+     */
+    QVariant headerData(int section, Qt::Orientation orientation, int role) const override;
+
+public slots:
+    /**
+     * @brief Sets flag that controls whether the model display stats or IVs
+     *
+     * @param flag Whether to show stats or not
+     */
+    void setShowStats(bool flag);
+
+private:
+    QStringList header
+        = { tr("Seed 0"), tr("Seed 1"), tr("Advances"), tr("EC"),  tr("PID"),    tr("Shiny"),  tr("Nature"), tr("Ability"),
+            tr("HP"),     tr("Atk"),    tr("Def"),      tr("SpA"), tr("SpD"),    tr("Spe"),    tr("Gender"), tr("Height"),
+            tr("Weight"), tr("Characteristic") };
+    bool showStats;
+};
+
 #endif // STATICMODEL8_HPP
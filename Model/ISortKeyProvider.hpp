@@ -0,0 +1,50 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef ISORTKEYPROVIDER_HPP
+#define ISORTKEYPROVIDER_HPP
+
+#include <Core/Global.hpp>
+#include <vector>
+
+/**
+ * @brief Interface for table models that can read sort keys straight from their storage instead of going through model data
+ */
+class ISortKeyProvider
+{
+public:
+    /**
+     * @brief Destroy the ISortKeyProvider object
+     */
+    virtual ~ISortKeyProvider() = default;
+
+    /**
+     * @brief Reads the sort keys of the \p column for the source \p rows. Keys order the same way as the displayed values.
+     *
+     * @param column Column to read
+     * @param rows Source rows to read
+     * @param keys Keys to store the result in, one per row
+     *
+     * @return true Column has typed keys
+     * @return false Column has to be sorted by its displayed data
+     */
+    virtual bool getSortKeys(int column, const std::vector<int> &rows, std::vector<u64> &keys) const = 0;
+};
+
+#endif // ISORTKEYPROVIDER_HPP
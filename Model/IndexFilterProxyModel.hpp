@@ -20,12 +20,12 @@
 #ifndef INDEXFILTERPROXYMODEL_HPP
 #define INDEXFILTERPROXYMODEL_HPP
 
-#include <QSortFilterProxyModel>
+#include <Model/SortFilterProxyModel.hpp>
 
 /**
  * @brief Provides a proxy to filter data from a table model by indexes
  */
-class IndexFilterProxyModel : public QSortFilterProxyModel
+class IndexFilterProxyModel : public SortFilterProxyModel
 {
 public:
     /**
@@ -34,9 +34,9 @@ public:
      * @param parent Parent object, which takes memory ownership
      * @param model Source model to be processed by proxy
      */
-    IndexFilterProxyModel(QObject *parent, QAbstractItemModel *model) : QSortFilterProxyModel(parent)
+    IndexFilterProxyModel(QObject *parent, QAbstractItemModel *model) : SortFilterProxyModel(parent, model)
     {
-        setSourceModel(model);
+        setFilteredRows({});
     }
 
     /**
@@ -46,12 +46,16 @@ public:
      */
     void setFilteredIndexes(const QModelIndexList &indexes)
     {
-        allowedIndexes.clear();
+        std::vector<int> rows;
+        rows.reserve(indexes.size());
         for (const QModelIndex &index : indexes)
         {
-            allowedIndexes.insert(QPersistentModelIndex(index));
+            if (index.isValid())
+            {
+                rows.emplace_back(index.row());
+            }
         }
-        invalidateFilter();
+        setFilteredRows(std::move(rows));
     }
 
     /**
@@ -61,29 +65,8 @@ public:
      */
     void setFilteredIndexes(const std::vector<size_t> &rows)
     {
-        allowedIndexes.clear();
-        for (size_t row : rows)
-        {
-            allowedIndexes.insert(QPersistentModelIndex(sourceModel()->index(row, 0)));
-        }
-        invalidateFilter();
+        setFilteredRows(std::vector<int>(rows.begin(), rows.end()));
     }
-
-protected:
-    /**
-     * @brief Checks if row should be displayed
-     *
-     * @param sourceRow Row to check
-     * @param sourceParent Parent index of row
-     */
-    bool filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const override
-    {
-        QModelIndex sourceIndex = sourceModel()->index(sourceRow, 0, sourceParent);
-        return allowedIndexes.contains(QPersistentModelIndex(sourceIndex));
-    }
-
-private:
-    QSet<QPersistentModelIndex> allowedIndexes;
 };
 
 #endif // INDEXFILTERPROXYMODEL_HPP
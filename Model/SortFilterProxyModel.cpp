@@ -0,0 +1,845 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "SortFilterProxyModel.hpp"
+#include <Model/ISortKeyProvider.hpp>
+#include <QThread>
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <thread>
+
+constexpr size_t asyncThreshold = 100000;
+constexpr size_t parallelThreshold = 65536;
+constexpr size_t radixThreshold = 4096;
+constexpr size_t removeRangeThreshold = 64;
+constexpr int radixBits = 16;
+constexpr int radixSize = 1 << radixBits;
+
+namespace
+{
+    /**
+     * @brief Runs \p function on \p threads threads, passing each its thread index
+     *
+     * @param threads Number of threads
+     * @param function Function to run
+     */
+    template <class Function>
+    void runParallel(int threads, const Function &function)
+    {
+        if (threads == 1)
+        {
+            function(0);
+            return;
+        }
+
+        auto *pool = new std::thread[threads];
+        for (int i = 0; i < threads; i++)
+        {
+            pool[i] = std::thread([&function, i] { function(i); });
+        }
+
+        for (int i = 0; i < threads; i++)
+        {
+            pool[i].join();
+        }
+        delete[] pool;
+    }
+
+    /**
+     * @brief Stable sorts \p rows by splitting them into one block per thread and merging the sorted blocks
+     *
+     * @param rows Rows to sort
+     * @param compare Row comparison
+     * @param threads Number of threads
+     */
+    template <class Compare>
+    void mergeSort(std::vector<int> &rows, const Compare &compare, int threads)
+    {
+        std::vector<size_t> bounds(threads + 1);
+        for (int i = 0; i <= threads; i++)
+        {
+            bounds[i] = rows.size() * i / threads;
+        }
+
+        runParallel(threads, [&](int i) { std::stable_sort(rows.begin() + bounds[i], rows.begin() + bounds[i + 1], compare); });
+
+        for (int width = 1; width < threads; width *= 2)
+        {
+            int merges = (threads + 2 * width - 1) / (2 * width);
+            runParallel(merges, [&](int i) {
+                int first = i * 2 * width;
+                int middle = std::min(first + width, threads);
+                int last = std::min(first + 2 * width, threads);
+                if (middle < last)
+                {
+                    std::inplace_merge(rows.begin() + bounds[first], rows.begin() + bounds[middle], rows.begin() + bounds[last], compare);
+                }
+            });
+        }
+    }
+
+    /**
+     * @brief Stable LSD radix sort of (key, row) pairs. Digits that are equal for every key are skipped.
+     *
+     * @param items Items to sort
+     * @param threads Number of threads
+     */
+    void radixSort(std::vector<std::pair<u64, int>> &items, int threads)
+    {
+        if (items.size() < radixThreshold)
+        {
+            std::stable_sort(items.begin(), items.end(), [](const auto &left, const auto &right) { return left.first < right.first; });
+            return;
+        }
+
+        u64 diff = 0;
+        for (const auto &item : items)
+        {
+            diff |= item.first ^ items[0].first;
+        }
+
+        size_t size = items.size();
+        std::vector<std::pair<u64, int>> buffer(size);
+        std::vector<size_t> counts(static_cast<size_t>(threads) * radixSize);
+        for (int shift = 0; shift < 64; shift += radixBits)
+        {
+            if (((diff >> shift) & (radixSize - 1)) == 0)
+            {
+                continue;
+            }
+
+            std::fill(counts.begin(), counts.end(), 0);
+            runParallel(threads, [&](int i) {
+                size_t *count = &counts[static_cast<size_t>(i) * radixSize];
+                for (size_t j = size * i / threads; j < size * (i + 1) / threads; j++)
+                {
+                    count[(items[j].first >> shift) & (radixSize - 1)]++;
+                }
+            });
+
+            // Each thread writes its block after the blocks of earlier threads for the same digit, keeping the sort stable
+            size_t offset = 0;
+            for (int digit = 0; digit < radixSize; digit++)
+            {
+                for (int i = 0; i < threads; i++)
+                {
+                    size_t &count = counts[static_cast<size_t>(i) * radixSize + digit];
+                    size_t total = count;
+                    count = offset;
+                    offset += total;
+                }
+            }
+
+            runParallel(threads, [&](int i) {
+                size_t *count = &counts[static_cast<size_t>(i) * radixSize];
+                for (size_t j = size * i / threads; j < size * (i + 1) / threads; j++)
+                {
+                    buffer[count[(items[j].first >> shift) & (radixSize - 1)]++] = items[j];
+                }
+            });
+            items.swap(buffer);
+        }
+    }
+}
+
+SortFilterProxyModel::SortFilterProxyModel(QObject *parent, QAbstractItemModel *model) :
+    QAbstractProxyModel(parent),
+    generation(0),
+    sortColumn(-1),
+    sortKeyRole(Qt::DisplayRole),
+    sortOrder(Qt::AscendingOrder),
+    filtered(false),
+    pending(false),
+    resetting(false)
+{
+    setSourceModel(model);
+}
+
+void SortFilterProxyModel::appendFilteredRows(const std::vector<int> &rows)
+{
+    if (filtered)
+    {
+        filterRows.insert(filterRows.end(), rows.begin(), rows.end());
+    }
+}
+
+void SortFilterProxyModel::clearFilteredRows()
+{
+    if (filtered)
+    {
+        sourceAboutToBeReset();
+        filterRows.clear();
+        filtered = false;
+        sourceReset();
+    }
+}
+
+int SortFilterProxyModel::columnCount(const QModelIndex &parent) const
+{
+    return !parent.isValid() && sourceModel() ? sourceModel()->columnCount() : 0;
+}
+
+QVariant SortFilterProxyModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (!sourceModel())
+    {
+        return QVariant();
+    }
+
+    if (orientation == Qt::Horizontal)
+    {
+        return sourceModel()->headerData(section, orientation, role);
+    }
+
+    if (section >= 0 && section < rowCount())
+    {
+        return sourceModel()->headerData(proxyToSource[section], orientation, role);
+    }
+    return QVariant();
+}
+
+QModelIndex SortFilterProxyModel::index(int row, int column, const QModelIndex &parent) const
+{
+    if (parent.isValid() || row < 0 || row >= rowCount() || column < 0 || column >= columnCount())
+    {
+        return QModelIndex();
+    }
+    return createIndex(row, column);
+}
+
+QModelIndex SortFilterProxyModel::mapFromSource(const QModelIndex &sourceIndex) const
+{
+    if (!sourceIndex.isValid() || sourceIndex.model() != sourceModel() || sourceIndex.row() >= static_cast<int>(sourceToProxy.size()))
+    {
+        return QModelIndex();
+    }
+
+    int row = sourceToProxy[sourceIndex.row()];
+    return row == -1 ? QModelIndex() : createIndex(row, sourceIndex.column());
+}
+
+QModelIndex SortFilterProxyModel::mapToSource(const QModelIndex &proxyIndex) const
+{
+    if (!proxyIndex.isValid() || proxyIndex.row() >= rowCount())
+    {
+        return QModelIndex();
+    }
+    return sourceModel()->index(proxyToSource[proxyIndex.row()], proxyIndex.column());
+}
+
+QModelIndex SortFilterProxyModel::parent(const QModelIndex &child) const
+{
+    return QModelIndex();
+}
+
+int SortFilterProxyModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : static_cast<int>(proxyToSource.size());
+}
+
+void SortFilterProxyModel::setSourceModel(QAbstractItemModel *model)
+{
+    beginResetModel();
+
+    if (sourceModel())
+    {
+        disconnect(sourceModel(), nullptr, this, nullptr);
+    }
+    QAbstractProxyModel::setSourceModel(model);
+
+    if (model)
+    {
+        // Source rows are renumbered, so the row filter no longer applies
+        auto dropFilter = [this] {
+            filterRows.clear();
+            filtered = false;
+            sourceReset();
+        };
+        connect(model, &QAbstractItemModel::modelAboutToBeReset, this, &SortFilterProxyModel::sourceAboutToBeReset);
+        connect(model, &QAbstractItemModel::modelReset, this, dropFilter);
+        connect(model, &QAbstractItemModel::layoutAboutToBeChanged, this, &SortFilterProxyModel::sourceAboutToBeReset);
+        connect(model, &QAbstractItemModel::layoutChanged, this, dropFilter);
+        connect(model, &QAbstractItemModel::rowsAboutToBeRemoved, this,
+                [this](const QModelIndex &, int first, int last) { sourceRowsAboutToBeRemoved(first, last); });
+        connect(model, &QAbstractItemModel::rowsRemoved, this,
+                [this](const QModelIndex &, int first, int last) { sourceRowsRemoved(first, last); });
+        connect(model, &QAbstractItemModel::rowsAboutToBeInserted, this, [this](const QModelIndex &, int first, int) {
+            // Only appended rows can be merged into the existing mapping
+            if (first != static_cast<int>(sourceToProxy.size()))
+            {
+                sourceAboutToBeReset();
+            }
+        });
+        connect(model, &QAbstractItemModel::rowsInserted, this, [this](const QModelIndex &, int first, int last) {
+            if (resetting)
+            {
+                sourceReset();
+            }
+            else
+            {
+                sourceRowsAppended(first, last);
+            }
+        });
+        connect(model, &QAbstractItemModel::dataChanged, this,
+                [this](const QModelIndex &topLeft, const QModelIndex &bottomRight, const QList<int> &roles) {
+                    if (!topLeft.isValid() || !bottomRight.isValid() || proxyToSource.empty())
+                    {
+                        return;
+                    }
+
+                    if (sortColumn >= topLeft.column() && sortColumn <= bottomRight.column()
+                        && (roles.isEmpty() || roles.contains(sortKeyRole)))
+                    {
+                        sort(sortColumn, sortOrder);
+                    }
+                    emit dataChanged(index(0, topLeft.column()), index(rowCount() - 1, bottomRight.column()), roles);
+                });
+        connect(model, &QAbstractItemModel::headerDataChanged, this, &SortFilterProxyModel::headerDataChanged);
+    }
+
+    generation++;
+    pending = false;
+    resetting = false;
+    keys = SortKeys();
+    sourceToProxy.resize(model ? model->rowCount() : 0);
+    proxyToSource = acceptedRows(0, static_cast<int>(sourceToProxy.size()));
+    updateSourceToProxy();
+
+    endResetModel();
+}
+
+void SortFilterProxyModel::setSortRole(int role)
+{
+    sortKeyRole = role;
+    if (sortColumn >= 0)
+    {
+        sort(sortColumn, sortOrder);
+    }
+}
+
+void SortFilterProxyModel::sort(int column, Qt::SortOrder order)
+{
+    sortColumn = column;
+    sortOrder = order;
+    generation++;
+    pending = false;
+    keys = SortKeys();
+
+    QAbstractItemModel *model = sourceModel();
+    if (!model)
+    {
+        return;
+    }
+
+    int count = static_cast<int>(sourceToProxy.size());
+    std::vector<int> rows = acceptedRows(0, count);
+    if (column < 0 || column >= model->columnCount())
+    {
+        setOrder(std::move(rows));
+        return;
+    }
+
+    extractKeys(rows, count);
+
+    int threads = QThread::idealThreadCount();
+    if (rows.size() < asyncThreshold)
+    {
+        setOrder(sortRows(keys, std::move(rows), order, threads));
+        return;
+    }
+
+    // Large models are sorted on a worker thread. Rows appended in the meantime are shown unsorted and merged once the
+    // sort finishes. A newer sort or a reset bumps the generation and discards the result.
+    pending = true;
+    u64 current = generation;
+    auto result = std::make_shared<std::vector<int>>();
+    auto *thread = QThread::create([result, keys = keys, rows = std::move(rows), order, threads]() mutable {
+        *result = sortRows(keys, std::move(rows), order, threads);
+    });
+    connect(thread, &QThread::finished, thread, &QThread::deleteLater);
+    connect(thread, &QThread::finished, this, [this, result, current, count] {
+        if (current == generation)
+        {
+            pending = false;
+            std::vector<int> sorted = std::move(*result);
+            mergeRows(sorted, acceptedRows(count, static_cast<int>(sourceToProxy.size())));
+            setOrder(std::move(sorted));
+        }
+    });
+    thread->start();
+}
+
+void SortFilterProxyModel::setFilteredRows(std::vector<int> rows)
+{
+    std::sort(rows.begin(), rows.end());
+    rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+
+    sourceAboutToBeReset();
+    filterRows = std::move(rows);
+    filtered = true;
+    sourceReset();
+}
+
+std::vector<int> SortFilterProxyModel::acceptedRows(int first, int last) const
+{
+    std::vector<int> rows;
+    if (!filtered)
+    {
+        rows.resize(std::max(last - first, 0));
+        std::iota(rows.begin(), rows.end(), first);
+    }
+    else
+    {
+        auto begin = std::lower_bound(filterRows.begin(), filterRows.end(), first);
+        auto end = std::lower_bound(begin, filterRows.end(), last);
+        rows.assign(begin, end);
+    }
+    return rows;
+}
+
+bool SortFilterProxyModel::extractKeys(const std::vector<int> &rows, int last)
+{
+    QAbstractItemModel *model = sourceModel();
+
+    auto classify = [](const QVariant &value, int &length) {
+        switch (value.typeId())
+        {
+        case QMetaType::Bool:
+        case QMetaType::Char:
+        case QMetaType::SChar:
+        case QMetaType::Short:
+        case QMetaType::Int:
+        case QMetaType::Long:
+        case QMetaType::LongLong:
+            return KeyType::Signed;
+        case QMetaType::UChar:
+        case QMetaType::UShort:
+        case QMetaType::UInt:
+        case QMetaType::ULong:
+        case QMetaType::ULongLong:
+            return KeyType::Unsigned;
+        case QMetaType::Float:
+        case QMetaType::Double:
+            return KeyType::Double;
+        case QMetaType::QString:
+        {
+            // Equal length uppercase hex strings order the same as their values
+            QString string = value.toString();
+            int size = static_cast<int>(string.size());
+            if (size == 0 || size > 16 || (length != 0 && size != length))
+            {
+                return KeyType::Text;
+            }
+
+            for (QChar c : string)
+            {
+                char16_t u = c.unicode();
+                if (!((u >= u'0' && u <= u'9') || (u >= u'A' && u <= u'F')))
+                {
+                    return KeyType::Text;
+                }
+            }
+            length = size;
+            return KeyType::Hex;
+        }
+        default:
+            return KeyType::Text;
+        }
+    };
+
+    auto combine = [](KeyType left, KeyType right) {
+        if (left == KeyType::Empty || left == right)
+        {
+            return right;
+        }
+        if (left == KeyType::Text || right == KeyType::Text || left == KeyType::Hex || right == KeyType::Hex)
+        {
+            return KeyType::Text;
+        }
+        return KeyType::Double;
+    };
+
+    std::vector<u64> numbers;
+    auto *provider = dynamic_cast<const ISortKeyProvider *>(model);
+    if (sortKeyRole == Qt::DisplayRole && provider && provider->getSortKeys(sortColumn, rows, numbers))
+    {
+        if (keys.type != KeyType::Empty && keys.type != KeyType::Unsigned)
+        {
+            return false;
+        }
+
+        keys.type = KeyType::Unsigned;
+        keys.numbers.resize(last);
+        for (size_t i = 0; i < rows.size(); i++)
+        {
+            keys.numbers[rows[i]] = numbers[i];
+        }
+        return true;
+    }
+
+    std::vector<QVariant> values;
+    values.reserve(rows.size());
+
+    KeyType type = keys.type;
+    int length = keys.length;
+    for (int row : rows)
+    {
+        QVariant value = model->data(model->index(row, sortColumn), sortKeyRole);
+        type = combine(type, classify(value, length));
+        values.emplace_back(std::move(value));
+    }
+
+    if (keys.type != KeyType::Empty && type != keys.type)
+    {
+        return false;
+    }
+
+    keys.type = type;
+    keys.length = length;
+    if (type == KeyType::Text)
+    {
+        keys.strings.resize(last);
+        for (size_t i = 0; i < rows.size(); i++)
+        {
+            keys.strings[rows[i]] = values[i].toString();
+        }
+    }
+    else
+    {
+        keys.numbers.resize(last);
+        for (size_t i = 0; i < rows.size(); i++)
+        {
+            const QVariant &value = values[i];
+            u64 &key = keys.numbers[rows[i]];
+            switch (type)
+            {
+            case KeyType::Signed:
+                key = static_cast<u64>(value.toLongLong()) ^ 0x8000000000000000;
+                break;
+            case KeyType::Unsigned:
+                key = value.toULongLong();
+                break;
+            case KeyType::Double:
+            {
+                u64 bits = std::bit_cast<u64>(value.toDouble());
+                key = (bits >> 63) ? ~bits : bits | 0x8000000000000000;
+                break;
+            }
+            default:
+                key = value.toString().toULongLong(nullptr, 16);
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+void SortFilterProxyModel::mergeRows(std::vector<int> &order, std::vector<int> rows) const
+{
+    if (rows.empty())
+    {
+        return;
+    }
+
+    rows = sortRows(keys, std::move(rows), sortOrder, 1);
+
+    size_t size = order.size();
+    order.insert(order.end(), rows.begin(), rows.end());
+    if (keys.type == KeyType::Text)
+    {
+        std::inplace_merge(order.begin(), order.begin() + size, order.end(), [this](int left, int right) {
+            return sortOrder == Qt::AscendingOrder ? keys.strings[left] < keys.strings[right] : keys.strings[right] < keys.strings[left];
+        });
+    }
+    else
+    {
+        std::inplace_merge(order.begin(), order.begin() + size, order.end(), [this](int left, int right) {
+            return sortOrder == Qt::AscendingOrder ? keys.numbers[left] < keys.numbers[right] : keys.numbers[right] < keys.numbers[left];
+        });
+    }
+}
+
+std::vector<int> SortFilterProxyModel::sortRows(const SortKeys &keys, std::vector<int> rows, Qt::SortOrder order, int threads)
+{
+    if (rows.size() < parallelThreshold)
+    {
+        threads = 1;
+    }
+
+    if (keys.type == KeyType::Text)
+    {
+        if (order == Qt::AscendingOrder)
+        {
+            mergeSort(rows, [&keys](int left, int right) { return keys.strings[left] < keys.strings[right]; }, threads);
+        }
+        else
+        {
+            mergeSort(rows, [&keys](int left, int right) { return keys.strings[right] < keys.strings[left]; }, threads);
+        }
+        return rows;
+    }
+
+    // Descending order flips every key so that the sort itself stays ascending and stable
+    u64 flip = order == Qt::AscendingOrder ? 0 : ~0ULL;
+    std::vector<std::pair<u64, int>> items(rows.size());
+    for (size_t i = 0; i < rows.size(); i++)
+    {
+        items[i] = { keys.numbers[rows[i]] ^ flip, rows[i] };
+    }
+
+    radixSort(items, threads);
+
+    for (size_t i = 0; i < rows.size(); i++)
+    {
+        rows[i] = items[i].second;
+    }
+    return rows;
+}
+
+void SortFilterProxyModel::setOrder(std::vector<int> order)
+{
+    emit layoutAboutToBeChanged({}, QAbstractItemModel::VerticalSortHint);
+
+    QModelIndexList from = persistentIndexList();
+    QModelIndexList sources;
+    sources.reserve(from.size());
+    for (const QModelIndex &index : from)
+    {
+        sources.append(mapToSource(index));
+    }
+
+    proxyToSource = std::move(order);
+    updateSourceToProxy();
+
+    QModelIndexList to;
+    to.reserve(sources.size());
+    for (const QModelIndex &index : sources)
+    {
+        to.append(mapFromSource(index));
+    }
+    changePersistentIndexList(from, to);
+
+    emit layoutChanged({}, QAbstractItemModel::VerticalSortHint);
+}
+
+void SortFilterProxyModel::sourceRowsAppended(int first, int last)
+{
+    std::vector<int> rows = acceptedRows(first, last + 1);
+    sourceToProxy.resize(last + 1, -1);
+
+    bool merge = true;
+    if (sortColumn >= 0)
+    {
+        merge = extractKeys(rows, last + 1);
+    }
+
+    if (rows.empty())
+    {
+        return;
+    }
+
+    size_t size = proxyToSource.size();
+    beginInsertRows(QModelIndex(), static_cast<int>(size), static_cast<int>(size + rows.size()) - 1);
+    for (int row : rows)
+    {
+        sourceToProxy[row] = static_cast<int>(proxyToSource.size());
+        proxyToSource.emplace_back(row);
+    }
+    endInsertRows();
+
+    if (sortColumn >= 0)
+    {
+        if (!merge)
+        {
+            // The new rows need a different key encoding than the cached keys
+            sort(sortColumn, sortOrder);
+        }
+        else if (!pending)
+        {
+            std::vector<int> order(proxyToSource.begin(), proxyToSource.begin() + size);
+            mergeRows(order, std::move(rows));
+            setOrder(std::move(order));
+        }
+    }
+}
+
+void SortFilterProxyModel::sourceRowsAboutToBeRemoved(int first, int last)
+{
+    if (resetting)
+    {
+        return;
+    }
+
+    last = std::min(last, static_cast<int>(sourceToProxy.size()) - 1);
+
+    std::vector<int> rows;
+    for (int row = first; row <= last; row++)
+    {
+        if (sourceToProxy[row] != -1)
+        {
+            rows.emplace_back(sourceToProxy[row]);
+        }
+    }
+
+    if (rows.empty())
+    {
+        return;
+    }
+
+    if (rows.size() == proxyToSource.size())
+    {
+        beginRemoveRows(QModelIndex(), 0, static_cast<int>(proxyToSource.size()) - 1);
+        proxyToSource.clear();
+        updateSourceToProxy();
+        endRemoveRows();
+        return;
+    }
+
+    // Group the proxy rows into ranges, each removed on its own. Too many ranges are cheaper to handle with a reset.
+    std::sort(rows.begin(), rows.end(), std::greater<>());
+    std::vector<std::pair<int, int>> ranges;
+    for (int row : rows)
+    {
+        if (!ranges.empty() && ranges.back().first == row + 1)
+        {
+            ranges.back().first = row;
+        }
+        else
+        {
+            ranges.emplace_back(row, row);
+        }
+    }
+
+    if (ranges.size() > removeRangeThreshold)
+    {
+        sourceAboutToBeReset();
+        return;
+    }
+
+    // Ranges are removed from the bottom up so the proxy rows of the remaining ranges stay valid
+    for (const auto &[start, end] : ranges)
+    {
+        beginRemoveRows(QModelIndex(), start, end);
+        proxyToSource.erase(proxyToSource.begin() + start, proxyToSource.begin() + end + 1);
+        updateSourceToProxy();
+        endRemoveRows();
+    }
+}
+
+void SortFilterProxyModel::sourceRowsRemoved(int first, int last)
+{
+    int size = static_cast<int>(sourceToProxy.size());
+    int count = std::min(last, size - 1) - first + 1;
+
+    // The filter follows the source rows even when the proxy is rebuilt
+    if (filtered && count > 0)
+    {
+        auto begin = std::lower_bound(filterRows.begin(), filterRows.end(), first);
+        auto end = std::upper_bound(begin, filterRows.end(), last);
+        std::for_each(end, filterRows.end(), [count](int &row) { row -= count; });
+        filterRows.erase(begin, end);
+
+        // Nothing is left to filter once every source row is gone
+        if (size == count)
+        {
+            filtered = false;
+        }
+    }
+
+    if (resetting)
+    {
+        sourceReset();
+        return;
+    }
+
+    if (count <= 0)
+    {
+        return;
+    }
+
+    for (int &row : proxyToSource)
+    {
+        if (row > last)
+        {
+            row -= count;
+        }
+    }
+
+    auto eraseKeys = [first, count](auto &values) {
+        if (values.size() > static_cast<size_t>(first))
+        {
+            values.erase(values.begin() + first, values.begin() + std::min(values.size(), static_cast<size_t>(first + count)));
+        }
+    };
+    eraseKeys(keys.numbers);
+    eraseKeys(keys.strings);
+
+    sourceToProxy.resize(sourceToProxy.size() - count);
+    updateSourceToProxy();
+
+    // A running sort still refers to the old source rows
+    if (pending)
+    {
+        sort(sortColumn, sortOrder);
+    }
+}
+
+void SortFilterProxyModel::sourceAboutToBeReset()
+{
+    if (!resetting)
+    {
+        resetting = true;
+        beginResetModel();
+    }
+}
+
+void SortFilterProxyModel::sourceReset()
+{
+    if (!resetting)
+    {
+        beginResetModel();
+    }
+
+    generation++;
+    pending = false;
+    resetting = false;
+    keys = SortKeys();
+    sourceToProxy.resize(sourceModel() ? sourceModel()->rowCount() : 0);
+    proxyToSource = acceptedRows(0, static_cast<int>(sourceToProxy.size()));
+    updateSourceToProxy();
+
+    endResetModel();
+
+    if (sortColumn >= 0)
+    {
+        sort(sortColumn, sortOrder);
+    }
+}
+
+void SortFilterProxyModel::updateSourceToProxy()
+{
+    std::fill(sourceToProxy.begin(), sourceToProxy.end(), -1);
+    for (size_t i = 0; i < proxyToSource.size(); i++)
+    {
+        sourceToProxy[proxyToSource[i]] = static_cast<int>(i);
+    }
+}
@@ -20,12 +20,19 @@
 #ifndef SORTFILTERPROXYMODEL_HPP
 #define SORTFILTERPROXYMODEL_HPP
 
-#include <QSortFilterProxyModel>
+#include <Core/Global.hpp>
+#include <QAbstractProxyModel>
+#include <vector>
 
 /**
- * @brief Provides a proxy to sort/filter data from a table model
+ * @brief Provides a proxy to sort/filter data from a table model.
+ *
+ * Each row of the sorted column is read from the source model once and reduced to a typed key (integer, floating point,
+ * hexadecimal string or text). Source models that implement ISortKeyProvider hand over the keys straight from their storage.
+ * Keys are sorted with a parallel radix/merge sort, large models are sorted on a worker thread, and rows appended to or
+ * removed from the source model are merged into or dropped from the existing order instead of resorting every row.
  */
-class SortFilterProxyModel : public QSortFilterProxyModel
+class SortFilterProxyModel : public QAbstractProxyModel
 {
 public:
     /**
@@ -34,10 +41,241 @@ public:
      * @param parent Parent object, which takes memory ownership
      * @param model Source model to be processed by proxy
      */
-    SortFilterProxyModel(QObject *parent, QAbstractItemModel *model) : QSortFilterProxyModel(parent)
+    SortFilterProxyModel(QObject *parent, QAbstractItemModel *model);
+
+    /**
+     * @brief Adds source \p rows that the source model has not appended yet to the row filter. They are displayed once they are
+     * appended, without rebuilding the proxy. Only applies while the proxy is limited to filtered rows.
+     *
+     * @param rows Source rows to display, in ascending order and past the last source row
+     */
+    void appendFilteredRows(const std::vector<int> &rows);
+
+    /**
+     * @brief Removes the row filter so every source row is displayed
+     */
+    void clearFilteredRows();
+
+    /**
+     * @brief Returns the number of columns of the source model
+     *
+     * @param parent Unused parent index
+     *
+     * @return Number of columns
+     */
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    /**
+     * @brief Returns header data of the source model
+     *
+     * @param section Column/row index
+     * @param orientation Column or row
+     * @param role Header role
+     *
+     * @return Header data
+     */
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+    /**
+     * @brief Returns the proxy index of \p row and \p column
+     *
+     * @param row Proxy row
+     * @param column Proxy column
+     * @param parent Unused parent index
+     *
+     * @return Proxy index
+     */
+    QModelIndex index(int row, int column, const QModelIndex &parent = QModelIndex()) const override;
+
+    /**
+     * @brief Maps a source index to the proxy
+     *
+     * @param sourceIndex Source index
+     *
+     * @return Proxy index, invalid if the row is filtered out
+     */
+    QModelIndex mapFromSource(const QModelIndex &sourceIndex) const override;
+
+    /**
+     * @brief Maps a proxy index to the source
+     *
+     * @param proxyIndex Proxy index
+     *
+     * @return Source index
+     */
+    QModelIndex mapToSource(const QModelIndex &proxyIndex) const override;
+
+    /**
+     * @brief Returns the parent of \p child. Table models have no hierarchy.
+     *
+     * @param child Child index
+     *
+     * @return Invalid index
+     */
+    QModelIndex parent(const QModelIndex &child) const override;
+
+    /**
+     * @brief Returns the number of rows displayed by the proxy
+     *
+     * @param parent Unused parent index
+     *
+     * @return Number of rows
+     */
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    /**
+     * @brief Limits the proxy to the source \p rows. The rows follow later removals from the source model, and a reset of the
+     * source model drops the filter.
+     *
+     * @param rows Source rows to display
+     */
+    void setFilteredRows(std::vector<int> rows);
+
+    /**
+     * @brief Sets the source model and rebuilds the mapping
+     *
+     * @param model Source model
+     */
+    void setSourceModel(QAbstractItemModel *model) override;
+
+    /**
+     * @brief Sets the role used to read sort keys from the source model
+     *
+     * @param role Data role
+     */
+    void setSortRole(int role);
+
+    /**
+     * @brief Sorts the proxy by \p column. A negative column restores the source order.
+     *
+     * @param column Column to sort by
+     * @param order Ascending or descending
+     */
+    void sort(int column, Qt::SortOrder order = Qt::AscendingOrder) override;
+
+private:
+    /**
+     * @brief Encoding used for the keys of the sorted column
+     */
+    enum class KeyType : u8
+    {
+        Empty,
+        Signed,
+        Unsigned,
+        Double,
+        Hex,
+        Text
+    };
+
+    /**
+     * @brief Sort keys of the sorted column indexed by source row
+     */
+    struct SortKeys
     {
-        setSourceModel(model);
-    }
+        std::vector<u64> numbers;
+        std::vector<QString> strings;
+        KeyType type = KeyType::Empty;
+        int length = 0;
+    };
+
+    std::vector<int> filterRows;
+    std::vector<int> proxyToSource;
+    std::vector<int> sourceToProxy;
+    SortKeys keys;
+    u64 generation;
+    int sortColumn;
+    int sortKeyRole;
+    Qt::SortOrder sortOrder;
+    bool filtered;
+    bool pending;
+    bool resetting;
+
+    /**
+     * @brief Returns the source rows in [\p first, \p last) that pass the filter
+     *
+     * @param first First source row
+     * @param last One past the last source row
+     *
+     * @return Accepted source rows
+     */
+    std::vector<int> acceptedRows(int first, int last) const;
+
+    /**
+     * @brief Reads the sort keys of source \p rows into the key cache
+     *
+     * @param rows Source rows to read
+     * @param last Number of source rows covered by the key cache
+     *
+     * @return true Keys were read
+     * @return false Keys require a different encoding than the cached keys
+     */
+    bool extractKeys(const std::vector<int> &rows, int last);
+
+    /**
+     * @brief Merges the source \p rows into the sorted \p order
+     *
+     * @param order Sorted proxy order
+     * @param rows Unsorted source rows
+     */
+    void mergeRows(std::vector<int> &order, std::vector<int> rows) const;
+
+    /**
+     * @brief Sorts source \p rows by their cached keys. Safe to call from a worker thread.
+     *
+     * @param keys Sort keys indexed by source row
+     * @param rows Source rows to sort
+     * @param order Ascending or descending
+     * @param threads Number of threads to sort with
+     *
+     * @return Sorted source rows
+     */
+    static std::vector<int> sortRows(const SortKeys &keys, std::vector<int> rows, Qt::SortOrder order, int threads);
+
+    /**
+     * @brief Replaces the proxy order with \p order, updating persistent indexes
+     *
+     * @param order New proxy order. Must contain the same rows as the current order.
+     */
+    void setOrder(std::vector<int> order);
+
+    /**
+     * @brief Handles rows appended to the source model
+     *
+     * @param first First inserted row
+     * @param last Last inserted row
+     */
+    void sourceRowsAppended(int first, int last);
+
+    /**
+     * @brief Removes the proxy rows of the source rows that are about to be removed
+     *
+     * @param first First removed row
+     * @param last Last removed row
+     */
+    void sourceRowsAboutToBeRemoved(int first, int last);
+
+    /**
+     * @brief Shifts the rows following the removed source rows
+     *
+     * @param first First removed row
+     * @param last Last removed row
+     */
+    void sourceRowsRemoved(int first, int last);
+
+    /**
+     * @brief Begins a reset of the proxy before the source model changes structure
+     */
+    void sourceAboutToBeReset();
+
+    /**
+     * @brief Rebuilds the proxy after the source model changes structure
+     */
+    void sourceReset();
+
+    /**
+     * @brief Rebuilds the source to proxy mapping from the proxy to source mapping
+     */
+    void updateSourceToProxy();
 };
 
 #endif // SORTFILTERPROXYMODEL_HPP
@@ -0,0 +1,108 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "StateFilterProxyModel.hpp"
+#include <QThread>
+#include <QTimer>
+
+StateFilterProxyModel::StateFilterProxyModel(QObject *parent, QAbstractItemModel *model) :
+    SortFilterProxyModel(parent, model),
+    candidates(std::make_shared<StateCandidates>()),
+    timer(new QTimer(this)),
+    filterGeneration(0),
+    narrowed(false),
+    searching(false)
+{
+    // Typing a value or checking several natures emits a change for every step, only the last one is applied
+    timer->setSingleShot(true);
+    timer->setInterval(200);
+    connect(timer, &QTimer::timeout, this, &StateFilterProxyModel::refilter);
+}
+
+void StateFilterProxyModel::finishSearch()
+{
+    searching = false;
+    refilter();
+}
+
+void StateFilterProxyModel::setStateFilter(const StateFilter &filter)
+{
+    pendingFilter = filter;
+    if (searchedFilter && !searching)
+    {
+        timer->start();
+    }
+}
+
+StateFilter StateFilterProxyModel::startSearch(const StateFilter &filter)
+{
+    timer->stop();
+    filterGeneration++;
+    searching = true;
+
+    // A filter thread of the previous search keeps its own candidates alive
+    candidates = std::make_shared<StateCandidates>();
+    this->filter = filter;
+    pendingFilter.reset();
+    searchedFilter = filter.relaxed();
+
+    narrowed = !filter.contains(*searchedFilter);
+    if (narrowed)
+    {
+        setFilteredRows({});
+    }
+    else
+    {
+        clearFilteredRows();
+    }
+    return *searchedFilter;
+}
+
+void StateFilterProxyModel::refilter()
+{
+    if (!searchedFilter || searching || !pendingFilter)
+    {
+        return;
+    }
+
+    filter = pendingFilter;
+    pendingFilter.reset();
+    u64 current = ++filterGeneration;
+
+    // Every candidate passes a filter that contains the searched filter
+    narrowed = !filter->contains(*searchedFilter);
+    if (!narrowed)
+    {
+        clearFilteredRows();
+        return;
+    }
+
+    auto result = std::make_shared<std::vector<int>>();
+    auto *thread = QThread::create([result, candidates = candidates, filter = *filter] {
+        *result = candidates->filter(filter, QThread::idealThreadCount());
+    });
+    connect(thread, &QThread::finished, thread, &QThread::deleteLater);
+    connect(thread, &QThread::finished, this, [this, result, current] {
+        if (current == filterGeneration)
+        {
+            setFilteredRows(std::move(*result));
+        }
+    });
+    thread->start();
+}
@@ -0,0 +1,106 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef STATEFILTERPROXYMODEL_HPP
+#define STATEFILTERPROXYMODEL_HPP
+
+#include <Core/Parents/Filters/StateFilter.hpp>
+#include <Core/Parents/States/StateCandidates.hpp>
+#include <Model/SortFilterProxyModel.hpp>
+#include <memory>
+#include <optional>
+
+class QTimer;
+
+/**
+ * @brief Provides a proxy to filter the results of a search without searching again.
+ *
+ * The search is run with the relaxed version of the filter (see StateFilter::relaxed()) and the filtered settings of every result are
+ * kept as \ref StateCandidates. The proxy displays the results that pass the current filter. Filter changes are applied to the
+ * candidates on a worker thread once the filter stops changing. Results outside of the searched IV, level and shiny bounds were never
+ * found, a filter wider than those only displays the candidates that pass it until the next search.
+ */
+class StateFilterProxyModel : public SortFilterProxyModel
+{
+public:
+    /**
+     * @brief Construct a new StateFilterProxyModel object
+     *
+     * @param parent Parent object, which takes memory ownership
+     * @param model Source model to be processed by proxy
+     */
+    StateFilterProxyModel(QObject *parent, QAbstractItemModel *model);
+
+    /**
+     * @brief Adds the results that are about to be appended to the source model as candidates. Results that pass the filter are
+     * displayed once they are appended.
+     *
+     * @tparam Item Result class
+     * @param items Results to add
+     */
+    template <class Item>
+    void addCandidates(const std::vector<Item> &items)
+    {
+        size_t first = candidates->size();
+        candidates->append(items);
+        if (narrowed)
+        {
+            appendFilteredRows(candidates->filter(*filter, 1, first));
+        }
+    }
+
+    /**
+     * @brief Applies the candidates of the search and any filter change made while searching
+     */
+    void finishSearch();
+
+    /**
+     * @brief Sets the filter to display results for. Applied once the filter has not changed for a short time, filters set while a
+     * search is running are applied when it finishes.
+     *
+     * @param filter Filter to apply
+     */
+    void setStateFilter(const StateFilter &filter);
+
+    /**
+     * @brief Drops the candidates of the previous search. Call after the source model is cleared.
+     *
+     * @param filter Filter of the search
+     *
+     * @return Relaxed filter to run the search with
+     */
+    StateFilter startSearch(const StateFilter &filter);
+
+private:
+    std::shared_ptr<StateCandidates> candidates;
+    std::optional<StateFilter> filter;
+    std::optional<StateFilter> pendingFilter;
+    std::optional<StateFilter> searchedFilter;
+    QTimer *timer;
+    u64 filterGeneration;
+    bool narrowed;
+    bool searching;
+
+    /**
+     * @brief Filters the candidates with the latest filter on a worker thread
+     */
+    void refilter();
+};
+
+#endif // STATEFILTERPROXYMODEL_HPP
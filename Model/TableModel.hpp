@@ -20,13 +20,15 @@
 #ifndef TABLEMODEL_HPP
 #define TABLEMODEL_HPP
 
+#include <Model/ISortKeyProvider.hpp>
+#include <Model/TableStorage.hpp>
 #include <QAbstractTableModel>
 
 /**
  * @brief Provides a templated implementation for children to add/edit/remove their data to a table model
  */
 template <class Item>
-class TableModel : public QAbstractTableModel
+class TableModel : public QAbstractTableModel, public ISortKeyProvider
 {
 public:
     /**
@@ -47,7 +49,7 @@ public:
     {
         int i = rowCount();
         beginInsertRows(QModelIndex(), i, i);
-        model.emplace_back(item);
+        model.append(item);
         endInsertRows();
     }
 
@@ -62,7 +64,7 @@ public:
         {
             int i = rowCount();
             beginInsertRows(QModelIndex(), i, i + static_cast<int>(items.size()) - 1);
-            model.insert(model.end(), items.begin(), items.end());
+            model.append(items);
             endInsertRows();
         }
     }
@@ -76,7 +78,6 @@ public:
         {
             beginRemoveRows(QModelIndex(), 0, rowCount() - 1);
             model.clear();
-            model.shrink_to_fit();
             endRemoveRows();
         }
     }
@@ -96,13 +97,38 @@ public:
     /**
      * @brief Returns the underlying model data
      *
-     * @return Vector of Items of the model
+     * @return Items of the model
      */
-    const std::vector<Item> &getModel() const
+    const TableStorage<Item> &getModel() const
     {
         return model;
     }
 
+    /**
+     * @brief Reads the sort keys of the \p column for the source \p rows. Keys order the same way as the displayed values.
+     *
+     * @param column Column to read
+     * @param rows Source rows to read
+     * @param keys Keys to store the result in, one per row
+     *
+     * @return true Column has typed keys
+     * @return false Column has to be sorted by its displayed data
+     */
+    bool getSortKeys(int column, const std::vector<int> &rows, std::vector<u64> &keys) const final
+    {
+        if (!hasSortKey(column))
+        {
+            return false;
+        }
+
+        keys.resize(rows.size());
+        for (size_t i = 0; i < rows.size(); i++)
+        {
+            keys[i] = getSortKey(model[rows[i]], column);
+        }
+        return true;
+    }
+
     /**
      * @brief Returns the number of rows in the model
      *
@@ -123,8 +149,7 @@ public:
     void removeItem(int row)
     {
         beginRemoveRows(QModelIndex(), row, row);
-        model.erase(model.begin() + row);
-        model.shrink_to_fit();
+        model.erase(row);
         endRemoveRows();
     }
 
@@ -137,12 +162,38 @@ public:
      */
     void updateItem(const Item &item, int row)
     {
-        model[row] = item;
+        model.set(row, item);
         emit dataChanged(index(row, 0), index(row, columnCount() - 1));
     }
 
 protected:
-    std::vector<Item> model;
+    TableStorage<Item> model;
+
+    /**
+     * @brief Returns if the \p column is sorted by a key read from the item instead of its displayed data
+     *
+     * @param column Column index
+     *
+     * @return true Column has a sort key
+     * @return false Column is sorted by its displayed data
+     */
+    virtual bool hasSortKey(int column) const
+    {
+        return false;
+    }
+
+    /**
+     * @brief Returns the sort key of the \p column for the \p item. Only called for columns where hasSortKey() is true.
+     *
+     * @param item Item to read
+     * @param column Column index
+     *
+     * @return Sort key
+     */
+    virtual u64 getSortKey(const Item &item, int column) const
+    {
+        return 0;
+    }
 };
 
 #endif // TABLEMODEL_HPP
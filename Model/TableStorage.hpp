@@ -0,0 +1,263 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TABLESTORAGE_HPP
+#define TABLESTORAGE_HPP
+
+#include <Core/Util/ResultStream.hpp>
+#include <QDir>
+#include <QTemporaryFile>
+#include <memory>
+
+/**
+ * @brief Row storage of a TableModel.
+ *
+ * Rows are kept in fixed capacity chunks so appending never reallocates existing rows and references to them stay valid. Once the
+ * rows exceed a size limit, every row is moved to a temporary ResultStream and paged back in on demand.
+ *
+ * @tparam Item Row type
+ */
+template <class Item>
+class TableStorage
+{
+    static constexpr size_t chunkSize = 4096;
+
+public:
+    /**
+     * @brief Construct a new TableStorage object
+     *
+     * @param spillBytes Size of the rows in bytes above which they are moved to a paged file
+     */
+    TableStorage(size_t spillBytes = 64 * 1024 * 1024) : count(0), spillBytes(spillBytes)
+    {
+    }
+
+    /**
+     * @brief Returns the item at \p row. Paged rows are only valid until the next read, use at() when reading from several threads.
+     *
+     * @param row Row to get
+     *
+     * @return Item
+     */
+    const Item &operator[](int row) const
+    {
+        return stream ? (*stream)[row] : chunks[row / chunkSize][row % chunkSize];
+    }
+
+    /**
+     * @brief Adds \p items to the end of the storage
+     *
+     * @param items Items to add
+     */
+    void append(const std::vector<Item> &items)
+    {
+        if constexpr (std::is_trivially_copyable_v<Item>)
+        {
+            if (!stream && (count + items.size()) * sizeof(Item) > spillBytes)
+            {
+                spill();
+            }
+
+            if (stream)
+            {
+                stream->append(items);
+                count += items.size();
+                return;
+            }
+        }
+
+        for (const auto &item : items)
+        {
+            emplace(item);
+        }
+    }
+
+    /**
+     * @brief Adds \p item to the end of the storage
+     *
+     * @param item Item to add
+     */
+    void append(const Item &item)
+    {
+        if constexpr (std::is_trivially_copyable_v<Item>)
+        {
+            if (stream || (count + 1) * sizeof(Item) > spillBytes)
+            {
+                append(std::vector<Item> { item });
+                return;
+            }
+        }
+
+        emplace(item);
+    }
+
+    /**
+     * @brief Returns a copy of the item at \p row. Safe to call from several threads while the storage is not modified.
+     *
+     * @param row Row to get
+     *
+     * @return Item
+     */
+    Item at(int row) const
+    {
+        return stream ? stream->at(row) : chunks[row / chunkSize][row % chunkSize];
+    }
+
+    /**
+     * @brief Removes all items
+     */
+    void clear()
+    {
+        stream.reset();
+        chunks.clear();
+        count = 0;
+    }
+
+    /**
+     * @brief Returns if the storage is empty
+     *
+     * @return true Storage is empty
+     * @return false Storage is not empty
+     */
+    bool empty() const
+    {
+        return count == 0;
+    }
+
+    /**
+     * @brief Returns if the rows were spilled to a paged file
+     *
+     * @return true Rows are paged
+     * @return false Rows are in memory
+     */
+    bool paged() const
+    {
+        return stream != nullptr;
+    }
+
+    /**
+     * @brief Removes the item at \p row
+     *
+     * @param row Row to remove
+     */
+    void erase(int row)
+    {
+        if (stream)
+        {
+            stream->erase(row);
+            count--;
+            return;
+        }
+
+        size_t index = row / chunkSize;
+        chunks[index].erase(chunks[index].begin() + row % chunkSize);
+
+        // Pull the first row of every following chunk back by one
+        for (size_t i = index + 1; i < chunks.size(); i++)
+        {
+            chunks[i - 1].emplace_back(std::move(chunks[i].front()));
+            chunks[i].erase(chunks[i].begin());
+        }
+
+        if (chunks.back().empty())
+        {
+            chunks.pop_back();
+        }
+        count--;
+    }
+
+    /**
+     * @brief Replaces the item at \p row
+     *
+     * @param row Row to replace
+     * @param item New item
+     */
+    void set(int row, const Item &item)
+    {
+        if (stream)
+        {
+            stream->set(row, item);
+        }
+        else
+        {
+            chunks[row / chunkSize][row % chunkSize] = item;
+        }
+    }
+
+    /**
+     * @brief Returns the number of items
+     *
+     * @return Number of items
+     */
+    size_t size() const
+    {
+        return count;
+    }
+
+private:
+    std::unique_ptr<ResultStream<Item>> stream;
+    std::vector<std::vector<Item>> chunks;
+    size_t count;
+    size_t spillBytes;
+
+    /**
+     * @brief Adds \p item to the last chunk, starting a new chunk when it is full
+     *
+     * @param item Item to add
+     */
+    void emplace(const Item &item)
+    {
+        if (chunks.empty() || chunks.back().size() == chunkSize)
+        {
+            chunks.emplace_back().reserve(chunkSize);
+        }
+        chunks.back().emplace_back(item);
+        count++;
+    }
+
+    /**
+     * @brief Moves every row into a temporary file
+     */
+    void spill()
+    {
+        QTemporaryFile temp(QDir::temp().filePath("pokefinder-XXXXXX.bin"));
+        temp.setAutoRemove(false);
+        if (!temp.open())
+        {
+            return;
+        }
+        temp.close();
+
+        stream = std::make_unique<ResultStream<Item>>(temp.fileName().toStdString());
+        if (!stream->good())
+        {
+            stream.reset();
+            return;
+        }
+
+        for (const auto &chunk : chunks)
+        {
+            stream->append(chunk);
+        }
+        chunks.clear();
+        chunks.shrink_to_fit();
+    }
+};
+
+#endif // TABLESTORAGE_HPP
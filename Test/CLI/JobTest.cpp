@@ -0,0 +1,135 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "JobTest.hpp"
+#include <CLI/Job.hpp>
+#include <Core/Util/Translator.hpp>
+#include <QTemporaryDir>
+#include <QTest>
+#include <Test/Data.hpp>
+#include <algorithm>
+#include <sstream>
+
+void JobTest::initTestCase()
+{
+    Translator::init("en");
+}
+
+void JobTest::merge_data()
+{
+    QTest::addColumn<std::string>("job");
+    QTest::addColumn<u32>("shards");
+
+    json data = readData("job", "merge");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data()) << d["job"].get<json>().dump() << d["shards"].get<u32>();
+    }
+}
+
+void JobTest::merge()
+{
+    QFETCH(std::string, job);
+    QFETCH(u32, shards);
+
+    json j = json::parse(job);
+
+    // Unsharded rows are written in the order the threads find them, merged rows are sorted
+    std::ostringstream unsharded;
+    QVERIFY(Job::run(j, unsharded));
+
+    std::istringstream stream(unsharded.str());
+    std::string header;
+    std::getline(stream, header);
+
+    std::vector<std::string> rows;
+    for (std::string row; std::getline(stream, row);)
+    {
+        rows.emplace_back(row);
+    }
+    std::ranges::sort(rows);
+    QVERIFY(!rows.empty());
+
+    std::string expected = header + '\n';
+    for (const auto &row : rows)
+    {
+        expected += row + '\n';
+    }
+
+    QTemporaryDir temp;
+    QVERIFY(temp.isValid());
+
+    std::vector<std::string> directories;
+    for (u32 i = 0; i < shards; i++)
+    {
+        json shard = j;
+        shard["shard"] = { { "index", i }, { "count", shards } };
+        shard["directory"] = temp.filePath(QString::number(i)).toStdString();
+        directories.emplace_back(shard["directory"].get<std::string>());
+
+        std::ostringstream out;
+        QVERIFY(Job::run(shard, out));
+        QVERIFY(out.str().empty());
+    }
+
+    std::ostringstream merged;
+    QVERIFY(Job::merge(directories, merged));
+    QCOMPARE(merged.str(), expected);
+
+    // A shard of a search with different parameters is rejected
+    json other = j;
+    other["initialAdvances"] = j.value("initialAdvances", 0) + 1;
+    other["shard"] = { { "index", 0 }, { "count", shards } };
+    other["directory"] = temp.filePath("other").toStdString();
+
+    std::ostringstream out;
+    QVERIFY(Job::run(other, out));
+
+    directories[0] = other["directory"].get<std::string>();
+    QVERIFY(!Job::merge(directories, out));
+
+    // Resuming a shard in the directory of a different search fails
+    other["directory"] = directories[1];
+    QVERIFY(!Job::run(other, out));
+}
+
+void JobTest::run_data()
+{
+    QTest::addColumn<std::string>("job");
+    QTest::addColumn<bool>("valid");
+    QTest::addColumn<std::string>("output");
+
+    json data = readData("job", "run");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data())
+            << d["job"].get<json>().dump() << d["valid"].get<bool>() << d["output"].get<std::string>();
+    }
+}
+
+void JobTest::run()
+{
+    QFETCH(std::string, job);
+    QFETCH(bool, valid);
+    QFETCH(std::string, output);
+
+    std::ostringstream out;
+    QCOMPARE(Job::run(json::parse(job), out), valid);
+    QCOMPARE(out.str(), output);
+}
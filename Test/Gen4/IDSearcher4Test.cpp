@@ -20,8 +20,10 @@
 #include "IDSearcher4Test.hpp"
 #include <Core/Gen4/Searchers/IDSearcher4.hpp>
 #include <Core/Gen4/States/IDState4.hpp>
+#include <QTemporaryDir>
 #include <QTest>
 #include <Test/Data.hpp>
+#include <filesystem>
 
 static bool operator==(const IDState4 &left, const json &right)
 {
@@ -68,3 +70,40 @@ void IDSearcher4Test::search()
         QVERIFY(state == j[i]);
     }
 }
+
+void IDSearcher4Test::checkpoint_data()
+{
+    search_data();
+}
+
+void IDSearcher4Test::checkpoint()
+{
+    QFETCH(u16, tid);
+    QFETCH(u32, maxDelay);
+    QFETCH(u32, minDelay);
+    QFETCH(u16, year);
+    QFETCH(std::string, results);
+
+    json j = json::parse(results);
+
+    QTemporaryDir temp;
+    QVERIFY(temp.isValid());
+    std::string file = temp.filePath("ids4.checkpoint").toStdString();
+
+    IDFilter filter({ tid }, { }, { }, { }, { }, { });
+
+    // A completed search removes its checkpoint
+    IDSearcher4 searcher(filter);
+    searcher.setCheckpoint(file);
+    searcher.startSearch(false, year, minDelay, maxDelay);
+    QCOMPARE(searcher.getResults().size(), j.size());
+    QVERIFY(!searcher.getCheckpointFailed());
+    QVERIFY(!std::filesystem::exists(file));
+
+    // A checkpoint that can not be written is reported without losing any results
+    IDSearcher4 failed(filter);
+    failed.setCheckpoint(temp.filePath("missing/ids4.checkpoint").toStdString());
+    failed.startSearch(false, year, minDelay, maxDelay);
+    QCOMPARE(failed.getResults().size(), j.size());
+    QVERIFY(failed.getCheckpointFailed());
+}
@@ -28,6 +28,9 @@ class IDSearcher4Test : public QObject
 private slots:
     void search_data();
     void search();
+
+    void checkpoint_data();
+    void checkpoint();
 };
 
 #endif // IDSEARCHER4TEST_HPP
@@ -0,0 +1,98 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "IVCacheSearcherTest.hpp"
+#include <Core/Gen5/Searchers/IVCacheSearcher.hpp>
+#include <QTest>
+#include <Test/Data.hpp>
+#include <sstream>
+
+using Seeds = std::vector<std::vector<u32>>;
+
+void IVCacheSearcherTest::startSearch_data()
+{
+    QTest::addColumn<u32>("initialAdvances");
+    QTest::addColumn<u32>("maxAdvances");
+    QTest::addColumn<u64>("start");
+    QTest::addColumn<u64>("end");
+    QTest::addColumn<u32>("units");
+    QTest::addColumn<int>("threads");
+    QTest::addColumn<Seeds>("entralink");
+    QTest::addColumn<Seeds>("normal");
+    QTest::addColumn<Seeds>("roamer");
+
+    json data = readData("ivcachesearcher", "startSearch");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data())
+            << d["initialAdvances"].get<u32>() << d["maxAdvances"].get<u32>() << d["start"].get<u64>() << d["end"].get<u64>()
+            << d["units"].get<u32>() << d["threads"].get<int>() << d["entralink"].get<Seeds>() << d["normal"].get<Seeds>()
+            << d["roamer"].get<Seeds>();
+    }
+}
+
+void IVCacheSearcherTest::startSearch()
+{
+    QFETCH(u32, initialAdvances);
+    QFETCH(u32, maxAdvances);
+    QFETCH(u64, start);
+    QFETCH(u64, end);
+    QFETCH(u32, units);
+    QFETCH(int, threads);
+    QFETCH(Seeds, entralink);
+    QFETCH(Seeds, normal);
+    QFETCH(Seeds, roamer);
+
+    // Vector paths are used while initialAdvances + maxAdvances + 32 <= 227, the full MT fallback after
+    IVCacheSearcher searcher(initialAdvances, maxAdvances);
+    searcher.startSearch(threads, Shard::split(start, end, units));
+
+    std::stringstream stream;
+    searcher.writeResults(stream);
+
+    u32 header[3];
+    stream.read(reinterpret_cast<char *>(header), sizeof(header));
+    QCOMPARE(header[0], 0xd08cb7c0);
+    QCOMPARE(header[1], initialAdvances);
+    QCOMPARE(header[2], maxAdvances);
+
+    Seeds seeds[3] = { Seeds(entralink.size()), Seeds(normal.size()), Seeds(roamer.size()) };
+    for (auto &type : seeds)
+    {
+        for (auto &advance : type)
+        {
+            u32 count;
+            stream.read(reinterpret_cast<char *>(&count), sizeof(count));
+            advance.resize(count);
+        }
+    }
+    for (auto &type : seeds)
+    {
+        for (auto &advance : type)
+        {
+            stream.read(reinterpret_cast<char *>(advance.data()), advance.size() * sizeof(u32));
+        }
+    }
+    QVERIFY(stream.good());
+    QCOMPARE(stream.peek(), std::char_traits<char>::eof());
+
+    QCOMPARE(seeds[0], entralink);
+    QCOMPARE(seeds[1], normal);
+    QCOMPARE(seeds[2], roamer);
+}
@@ -0,0 +1,153 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "IVCacheTest.hpp"
+#include <Core/Enum/Game.hpp>
+#include <Core/Gen5/IVCache.hpp>
+#include <Core/Parents/Filters/StateFilter.hpp>
+#include <Core/RNG/MT.hpp>
+#include <QTemporaryDir>
+#include <QTest>
+#include <Test/Data.hpp>
+#include <Test/Enum.hpp>
+#include <fstream>
+
+/**
+ * @brief Writes a cache file where each of the \p advances of the \p type holds all of the \p seeds
+ */
+static void writeCache(const std::string &file, u32 fileAdvances, CacheType type, const std::vector<u32> &advances,
+                       const std::vector<u32> &seeds)
+{
+    std::vector<std::vector<u32>> caches[3];
+    caches[static_cast<u8>(CacheType::Entralink)].resize(fileAdvances + 5);
+    caches[static_cast<u8>(CacheType::Normal)].resize(fileAdvances + 3);
+    caches[static_cast<u8>(CacheType::Roamer)].resize(fileAdvances + 1);
+    for (u32 advance : advances)
+    {
+        caches[static_cast<u8>(type)][advance] = seeds;
+    }
+
+    std::ofstream stream(file, std::ios_base::out | std::ios_base::binary);
+
+    u32 header[3] = { 0xd08cb7c0, 0, fileAdvances };
+    stream.write(reinterpret_cast<const char *>(header), sizeof(header));
+    for (const auto &cache : caches)
+    {
+        for (const auto &advance : cache)
+        {
+            u32 count = advance.size();
+            stream.write(reinterpret_cast<const char *>(&count), sizeof(count));
+        }
+    }
+    for (const auto &cache : caches)
+    {
+        for (const auto &advance : cache)
+        {
+            stream.write(reinterpret_cast<const char *>(advance.data()), advance.size() * sizeof(u32));
+        }
+    }
+}
+
+void IVCacheTest::getCache_data()
+{
+    QTest::addColumn<Game>("version");
+    QTest::addColumn<CacheType>("type");
+    QTest::addColumn<u32>("fileAdvances");
+    QTest::addColumn<std::vector<u32>>("advances");
+    QTest::addColumn<std::vector<u32>>("seeds");
+    QTest::addColumn<u32>("initialAdvances");
+    QTest::addColumn<u32>("maxAdvances");
+    QTest::addColumn<int>("threads");
+    QTest::addColumn<size_t>("results");
+
+    json data = readData("ivcache", "getCache");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data())
+            << d["version"].get<Game>() << static_cast<CacheType>(d["type"].get<u8>()) << d["fileAdvances"].get<u32>()
+            << d["advances"].get<std::vector<u32>>() << d["seeds"].get<std::vector<u32>>() << d["initialAdvances"].get<u32>()
+            << d["maxAdvances"].get<u32>() << d["threads"].get<int>() << d["results"].get<size_t>();
+    }
+}
+
+void IVCacheTest::getCache()
+{
+    QFETCH(Game, version);
+    QFETCH(CacheType, type);
+    QFETCH(u32, fileAdvances);
+    QFETCH(std::vector<u32>, advances);
+    QFETCH(std::vector<u32>, seeds);
+    QFETCH(u32, initialAdvances);
+    QFETCH(u32, maxAdvances);
+    QFETCH(int, threads);
+    QFETCH(size_t, results);
+
+    QTemporaryDir temp;
+    QVERIFY(temp.isValid());
+    std::string file = temp.filePath("test.ivcache").toStdString();
+    writeCache(file, fileAdvances, type, advances, seeds);
+
+    IVCache ivCache(file);
+    QVERIFY(ivCache.isValid());
+
+    std::array<u8, 6> min = { 0, 0, 0, 0, 0, 0 };
+    std::array<u8, 6> max = { 31, 31, 31, 31, 31, 31 };
+    std::array<bool, 25> natures;
+    natures.fill(true);
+    std::array<bool, 16> powers;
+    powers.fill(true);
+    StateFilter filter(255, 255, 255, 0, 255, 0, 255, 0, 255, false, min, max, natures, powers);
+
+    // B2W2 normal seeds are stored two advances ahead of the searched advance
+    u32 offset = type == CacheType::Normal && (version & Game::BW) == Game::None ? 2 : 0;
+    u32 mtOffset = type == CacheType::Entralink ? 22 : type == CacheType::Roamer ? 1 : 0;
+
+    // Single thread and multiple threads split the seeds of an advance differently between the 8, 4 and 1 lane paths
+    for (int count : { 1, threads })
+    {
+        auto cache = ivCache.getCache(initialAdvances, maxAdvances, version, type, filter, count);
+        QCOMPARE(cache.size(), results);
+
+        for (u32 advance : advances)
+        {
+            if (advance < initialAdvances + offset || advance > initialAdvances + maxAdvances + offset)
+            {
+                continue;
+            }
+
+            for (u32 seed : seeds)
+            {
+                MT mt(seed, advance + mtOffset);
+                std::array<u8, 6> ivs;
+                for (int i = 0; i < 6; i++)
+                {
+                    ivs[i] = mt.next() >> 27;
+                }
+                if (type == CacheType::Roamer)
+                {
+                    std::rotate(ivs.begin() + 3, ivs.begin() + 5, ivs.end());
+                }
+
+                auto entry = cache.find((static_cast<u64>(advance - offset) << 32) | seed);
+                QVERIFY(entry != cache.end());
+                QCOMPARE(entry->second, ivs);
+            }
+        }
+    }
+}
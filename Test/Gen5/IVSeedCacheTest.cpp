@@ -0,0 +1,104 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "IVSeedCacheTest.hpp"
+#include <Core/Gen5/IVSeedCache.hpp>
+#include <QTest>
+#include <Test/Data.hpp>
+
+void IVSeedCacheTest::find_data()
+{
+    QTest::addColumn<u32>("initialAdvances");
+    QTest::addColumn<u32>("maxAdvances");
+    QTest::addColumn<std::string>("cache");
+    QTest::addColumn<std::vector<u32>>("seeds");
+    QTest::addColumn<int>("results");
+
+    json data = readData("ivseedcache", "find");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data())
+            << d["initialAdvances"].get<u32>() << d["maxAdvances"].get<u32>() << d["cache"].get<std::string>()
+            << d["seeds"].get<std::vector<u32>>() << d["results"].get<int>();
+    }
+}
+
+void IVSeedCacheTest::find()
+{
+    QFETCH(u32, initialAdvances);
+    QFETCH(u32, maxAdvances);
+    QFETCH(std::string, cache);
+    QFETCH(std::vector<u32>, seeds);
+    QFETCH(int, results);
+
+    fph::MetaFphMap<u64, std::array<u8, 6>> ivCache;
+    for (const auto &entry : json::parse(cache))
+    {
+        ivCache.emplace((entry[0].get<u64>() << 32) | entry[1].get<u32>(), entry[2].get<std::array<u8, 6>>());
+    }
+
+    IVSeedCache seedCache(ivCache, initialAdvances, maxAdvances);
+
+    // Lookup the searchers did before the seed cache, one probe per advance
+    std::vector<std::vector<IVSeedCache::Entry>> expected;
+    for (u32 seed : seeds)
+    {
+        auto &entries = expected.emplace_back();
+        for (u64 advance = initialAdvances; advance <= initialAdvances + maxAdvances; advance++)
+        {
+            auto entry = ivCache.find((advance << 32) | seed);
+            if (entry != ivCache.end())
+            {
+                entries.emplace_back(advance, entry->second);
+            }
+        }
+    }
+
+    int count = 0;
+    for (size_t i = 0; i < seeds.size(); i++)
+    {
+        auto entries = seedCache.find(seeds[i]);
+        QVERIFY(std::ranges::equal(entries, expected[i]));
+        count += entries.size();
+    }
+    QCOMPARE(count, results);
+
+    // Batch lookup takes SHA1 seeds, the lower halves must be ignored
+    for (size_t i = 0; i < seeds.size(); i += 8)
+    {
+        u32 size = std::min<size_t>(8, seeds.size() - i);
+
+        std::array<u64, 8> sha1Seeds;
+        for (u32 j = 0; j < size; j++)
+        {
+            sha1Seeds[j] = (static_cast<u64>(seeds[i + j]) << 32) | (seeds[i + j] ^ 0x12345678);
+        }
+
+        std::array<std::span<const IVSeedCache::Entry>, 8> entries;
+        u32 hits = seedCache.find(sha1Seeds.data(), size, entries.data());
+        for (u32 j = 0; j < size; j++)
+        {
+            QCOMPARE((hits >> j) & 1, static_cast<u32>(!expected[i + j].empty()));
+            if ((hits >> j) & 1)
+            {
+                QVERIFY(std::ranges::equal(entries[j], expected[i + j]));
+            }
+        }
+    }
+}
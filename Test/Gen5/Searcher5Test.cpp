@@ -0,0 +1,190 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "Searcher5Test.hpp"
+#include <Core/Enum/DSType.hpp>
+#include <Core/Enum/Game.hpp>
+#include <Core/Enum/Language.hpp>
+#include <Core/Enum/Shiny.hpp>
+#include <Core/Gen5/Generators/EggGenerator5.hpp>
+#include <Core/Gen5/Generators/EventGenerator5.hpp>
+#include <Core/Gen5/PGF.hpp>
+#include <Core/Gen5/Profile5.hpp>
+#include <Core/Gen5/Searchers/Searcher5.hpp>
+#include <Core/Gen5/States/EggState5.hpp>
+#include <Core/Gen5/States/EventState5.hpp>
+#include <QTest>
+#include <Test/Data.hpp>
+#include <Test/Enum.hpp>
+
+using IVs = std::array<u8, 6>;
+using KeyPresses = std::array<bool, 9>;
+
+static bool operator==(const SearcherState5<EventState5> &left, const SearcherState5<EventState5> &right)
+{
+    const auto &leftState = left.getState();
+    const auto &rightState = right.getState();
+    return left.getDateTime() == right.getDateTime() && left.getInitialSeed() == right.getInitialSeed()
+        && left.getButtons() == right.getButtons() && left.getTimer0() == right.getTimer0() && leftState.getPID() == rightState.getPID()
+        && leftState.getIVs() == rightState.getIVs() && leftState.getAdvances() == rightState.getAdvances()
+        && leftState.getNature() == rightState.getNature() && leftState.getShiny() == rightState.getShiny();
+}
+
+void Searcher5Test::packed_data()
+{
+    QTest::addColumn<Game>("version");
+    QTest::addColumn<KeyPresses>("keypresses");
+    QTest::addColumn<u16>("timer0Min");
+    QTest::addColumn<u16>("timer0Max");
+    QTest::addColumn<Date>("start");
+    QTest::addColumn<Date>("end");
+    QTest::addColumn<IVs>("min");
+    QTest::addColumn<IVs>("max");
+    QTest::addColumn<int>("threads");
+    QTest::addColumn<size_t>("results");
+
+    json data = readData("searcher5", "packed");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data())
+            << d["version"].get<Game>() << d["keypresses"].get<KeyPresses>() << d["timer0Min"].get<u16>()
+            << d["timer0Max"].get<u16>() << Date(d["start"].get<int>()) << Date(d["end"].get<int>()) << d["min"].get<IVs>()
+            << d["max"].get<IVs>() << d["threads"].get<int>() << d["results"].get<size_t>();
+    }
+}
+
+void Searcher5Test::packed()
+{
+    QFETCH(Game, version);
+    QFETCH(KeyPresses, keypresses);
+    QFETCH(u16, timer0Min);
+    QFETCH(u16, timer0Max);
+    QFETCH(Date, start);
+    QFETCH(Date, end);
+    QFETCH(IVs, min);
+    QFETCH(IVs, max);
+    QFETCH(int, threads);
+    QFETCH(size_t, results);
+
+    std::array<bool, 25> natures;
+    natures.fill(true);
+
+    std::array<bool, 16> powers;
+    powers.fill(true);
+
+    Profile5 profile("-", version, 12345, 54321, "", "", 0x0009bf123456, keypresses, 0x60, 6, 5, false, timer0Min, timer0Max, false, false,
+                     DSType::DS, Language::English);
+
+    PGF pgf(0, 0, 519, 0, 1, 1, Shiny::Never, 1, 255, 255, 255, 255, 255, 255, true);
+    StateFilter filter(255, 255, 255, 1, 100, 0, 255, 0, 255, false, min, max, natures, powers);
+    EventGenerator5 generator(0, 10, 0, pgf, profile, filter);
+
+    Searcher5<EventGenerator5, EventState5> full(generator, profile);
+    full.startSearch(threads, start, end);
+    auto states = full.getResults();
+
+    Searcher5<EventGenerator5, EventState5> packed(generator, profile, true);
+    packed.startSearch(threads, start, end);
+    QVERIFY(packed.getResults().empty());
+
+    auto packedStates = packed.getPackedResults();
+    QCOMPARE(states.size(), results);
+    QCOMPARE(packedStates.size(), results);
+
+    // Threads finish in any order, so both searches are sorted the same way before comparing
+    auto order = [](const SearcherState5<EventState5> &left, const SearcherState5<EventState5> &right) {
+        return std::tuple(left.getDateTime(), left.getTimer0(), left.getButtons(), left.getState().getAdvances())
+            < std::tuple(right.getDateTime(), right.getTimer0(), right.getButtons(), right.getState().getAdvances());
+    };
+
+    std::vector<SearcherState5<EventState5>> rehydrated;
+    for (const auto &state : packedStates)
+    {
+        auto full = packed.rehydrate(state);
+        QVERIFY(full.has_value());
+        rehydrated.emplace_back(*full);
+    }
+
+    std::ranges::sort(states, order);
+    std::ranges::sort(rehydrated, order);
+    for (size_t i = 0; i < states.size(); i++)
+    {
+        QVERIFY(rehydrated[i] == states[i]);
+    }
+
+    // Packed states that do not match the generator output are rejected
+    if (!packedStates.empty())
+    {
+        const auto &state = packedStates.front();
+        PackedSearcherState5 outOfRange(state.getDateTime(), state.getButtons(), state.getTimer0(), 11, state.getAdvances());
+        PackedSearcherState5 otherAdvances(state.getDateTime(), state.getButtons(), state.getTimer0(), state.getIndex(),
+                                           state.getAdvances() + 1);
+        QVERIFY(!packed.rehydrate(outOfRange));
+        QVERIFY(!packed.rehydrate(otherAdvances));
+    }
+}
+
+void Searcher5Test::egg_data()
+{
+    QTest::addColumn<Game>("version");
+    QTest::addColumn<u16>("timer0");
+    QTest::addColumn<Date>("date");
+    QTest::addColumn<IVs>("min");
+    QTest::addColumn<IVs>("max");
+    QTest::addColumn<size_t>("results");
+
+    json data = readData("searcher5", "egg");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data())
+            << d["version"].get<Game>() << d["timer0"].get<u16>() << Date(d["date"].get<int>()) << d["min"].get<IVs>()
+            << d["max"].get<IVs>() << d["results"].get<size_t>();
+    }
+}
+
+void Searcher5Test::egg()
+{
+    QFETCH(Game, version);
+    QFETCH(u16, timer0);
+    QFETCH(Date, date);
+    QFETCH(IVs, min);
+    QFETCH(IVs, max);
+    QFETCH(size_t, results);
+
+    std::array<bool, 25> natures;
+    natures.fill(true);
+
+    std::array<bool, 16> powers;
+    powers.fill(true);
+
+    Profile5 profile("-", version, 12345, 54321, "", "", 0x0009bf123456, { true, false, false, false, false, false, false, false, false },
+                     0x60, 6, 5, false, timer0, timer0, false, false, DSType::DS, Language::English);
+
+    Daycare daycare({ { { 31, 31, 31, 31, 31, 31 }, { 0, 0, 0, 0, 0, 0 } } }, { 0, 0 }, { 0, 1 }, { 0, 0 }, { 0, 0 }, 1, true);
+    StateFilter filter(255, 255, 255, 1, 100, 0, 255, 0, 255, false, min, max, natures, powers);
+    EggGenerator5 generator(0, 10, 0, daycare, profile, filter);
+
+    // A whole day of seeds on one thread, strict filters should only pay for the initial advances of the seeds that pass
+    QBENCHMARK
+    {
+        Searcher5<EggGenerator5, EggState5> searcher(generator, profile);
+        searcher.startSearch(1, date, date);
+        QCOMPARE(searcher.getResults().size(), results);
+    }
+}
@@ -0,0 +1,80 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "Utilities5Test.hpp"
+#include <Core/Enum/DSType.hpp>
+#include <Core/Enum/Game.hpp>
+#include <Core/Enum/Language.hpp>
+#include <Core/Gen5/Profile5.hpp>
+#include <Core/Util/Utilities.hpp>
+#include <QTest>
+#include <Test/Data.hpp>
+#include <Test/Enum.hpp>
+
+void Utilities5Test::initialAdvances_data()
+{
+    QTest::addColumn<Game>("version");
+    QTest::addColumn<bool>("memoryLink");
+    QTest::addColumn<std::vector<u64>>("seeds");
+    QTest::addColumn<std::vector<u32>>("advances");
+
+    json data = readData("utilities5", "initialAdvances");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data()) << d["version"].get<Game>() << d["memoryLink"].get<bool>()
+                                                           << d["seeds"].get<std::vector<u64>>() << d["advances"].get<std::vector<u32>>();
+    }
+}
+
+void Utilities5Test::initialAdvances()
+{
+    QFETCH(Game, version);
+    QFETCH(bool, memoryLink);
+    QFETCH(std::vector<u64>, seeds);
+    QFETCH(std::vector<u32>, advances);
+
+    Profile5 profile("-", version, 12345, 54321, "", "", 0, { false, false, false, false, false, false, false, false, false }, 0, 0, 0,
+                     false, 0, 0, memoryLink, false, DSType::DS, Language::English);
+
+    for (size_t i = 0; i < seeds.size(); i++)
+    {
+        QCOMPARE(Utilities5::initialAdvances(seeds[i], profile), advances[i]);
+    }
+
+    for (size_t i = 0; i < seeds.size(); i += 4)
+    {
+        auto batch = Utilities5::initialAdvances(std::array<u64, 4> { seeds[i], seeds[i + 1], seeds[i + 2], seeds[i + 3] }, profile);
+        for (size_t j = 0; j < batch.size(); j++)
+        {
+            QCOMPARE(batch[j], advances[i + j]);
+        }
+    }
+
+    for (size_t i = 0; i < seeds.size(); i += 8)
+    {
+        std::array<u64, 8> lanes;
+        std::copy(seeds.begin() + i, seeds.begin() + i + 8, lanes.begin());
+
+        auto batch = Utilities5::initialAdvances(lanes, profile);
+        for (size_t j = 0; j < batch.size(); j++)
+        {
+            QCOMPARE(batch[j], advances[i + j]);
+        }
+    }
+}
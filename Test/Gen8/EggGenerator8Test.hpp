@@ -28,6 +28,9 @@ class EggGenerator8Test : public QObject
 private slots:
     void generate_data();
     void generate();
+
+    void generateThreads_data();
+    void generateThreads();
 };
 
 #endif // EGGGENERATOR8TEST_HPP
@@ -115,3 +115,59 @@ void EventGenerator8Test::generate()
         QVERIFY(state == j[i]);
     }
 }
+
+void EventGenerator8Test::generateThreads_data()
+{
+    generate_data();
+}
+
+void EventGenerator8Test::generateThreads()
+{
+    QFETCH(u64, seed0);
+    QFETCH(u64, seed1);
+    QFETCH(u16, tid);
+    QFETCH(u16, sid);
+    QFETCH(u32, ec);
+    QFETCH(u32, pid);
+    QFETCH(u16, specie);
+    QFETCH(u8, form);
+    QFETCH(u8, gender);
+    QFETCH(bool, egg);
+    QFETCH(u8, nature);
+    QFETCH(u8, ability);
+    QFETCH(u8, shiny);
+    QFETCH(u8, ivCount);
+    QFETCH(u8, level);
+
+    std::array<u8, 6> min;
+    min.fill(0);
+
+    std::array<u8, 6> max;
+    max.fill(31);
+
+    std::array<bool, 25> natures;
+    natures.fill(true);
+
+    std::array<bool, 16> powers;
+    powers.fill(true);
+
+    Profile8 profile("-", Game::BD, 12345, 54321, false, false, false);
+
+    WB8 wb8(tid, sid, ec, pid, specie, form, gender, egg, nature, ability, shiny, ivCount, level);
+    StateFilter filter(255, 255, 255, 1, 100, 0, 255, 0, 255, false, min, max, natures, powers);
+    EventGenerator8 generator(1000, 0x10000, 0, wb8, profile, filter);
+
+    // Every thread jumps its RNG to the start of its block, so the threaded output has to match the sequential output
+    auto states = generator.generate(seed0, seed1);
+    auto threaded = generator.generate(seed0, seed1, 4);
+    QVERIFY(states.size() > 0x4000);
+    QCOMPARE(threaded.size(), states.size());
+
+    for (size_t i = 0; i < states.size(); i++)
+    {
+        QCOMPARE(threaded[i].getAdvances(), states[i].getAdvances());
+        QCOMPARE(threaded[i].getEC(), states[i].getEC());
+        QCOMPARE(threaded[i].getPID(), states[i].getPID());
+        QCOMPARE(threaded[i].getIVs(), states[i].getIVs());
+    }
+}
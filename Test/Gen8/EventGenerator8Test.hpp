@@ -28,6 +28,9 @@ class EventGenerator8Test : public QObject
 private slots:
     void generate_data();
     void generate();
+
+    void generateThreads_data();
+    void generateThreads();
 };
 
 #endif // EVENTGENERATOR8TEST_HPP
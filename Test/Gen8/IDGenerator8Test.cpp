@@ -64,3 +64,30 @@ void IDGenerator8Test::generate()
         QVERIFY(state == j[i]);
     }
 }
+
+void IDGenerator8Test::generateThreads_data()
+{
+    generate_data();
+}
+
+void IDGenerator8Test::generateThreads()
+{
+    QFETCH(u64, seed0);
+    QFETCH(u64, seed1);
+
+    IDFilter filter({ }, { }, { }, { }, { }, { });
+    IDGenerator8 generator(1000, 0x10000, filter);
+
+    // Every thread jumps its RNG to the start of its block, so the threaded output has to match the sequential output
+    auto states = generator.generate(seed0, seed1);
+    auto threaded = generator.generate(seed0, seed1, 4);
+    QVERIFY(states.size() > 0x4000);
+    QCOMPARE(threaded.size(), states.size());
+
+    for (size_t i = 0; i < states.size(); i++)
+    {
+        QCOMPARE(threaded[i].getAdvances(), states[i].getAdvances());
+        QCOMPARE(threaded[i].getTID(), states[i].getTID());
+        QCOMPARE(threaded[i].getSID(), states[i].getSID());
+    }
+}
@@ -28,6 +28,9 @@ class IDGenerator8Test : public QObject
 private slots:
     void generate_data();
     void generate();
+
+    void generateThreads_data();
+    void generateThreads();
 };
 
 #endif // IDGENERATOR8TEST_HPP
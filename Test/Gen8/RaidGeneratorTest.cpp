@@ -98,3 +98,65 @@ void RaidGeneratorTest::generate()
         QVERIFY(state == j[i]);
     }
 }
+
+void RaidGeneratorTest::generateTargets_data()
+{
+    generate_data();
+}
+
+void RaidGeneratorTest::generateTargets()
+{
+    QFETCH(u64, seed);
+    QFETCH(Game, version);
+    QFETCH(int, denIndex);
+    QFETCH(int, rarity);
+    QFETCH(int, raidIndex);
+    QFETCH(u8, level);
+    QFETCH(std::string, results);
+
+    json j = json::parse(results);
+
+    std::array<u8, 6> min;
+    min.fill(0);
+
+    std::array<u8, 6> max;
+    max.fill(31);
+
+    std::array<bool, 25> natures;
+    natures.fill(true);
+
+    std::array<bool, 16> powers;
+    powers.fill(true);
+
+    Profile8 profile("-", version, 12345, 54321, false, false, false);
+
+    const Den *den = Encounters8::getDen(denIndex, rarity);
+    Raid raid = den->getRaid(raidIndex, version);
+
+    StateFilter filter(255, 255, 255, 1, 100, 0, 255, 0, 255, false, min, max, natures, powers);
+    RaidGenerator generator(0, 9, 0, profile, filter);
+
+    auto targets = generator.generate({ { seed, raid, level }, { seed, raid, level } }, 2);
+    QCOMPARE(targets.size(), 2);
+
+    for (const auto &states : targets)
+    {
+        QCOMPARE(states.size(), j.size());
+        for (size_t i = 0; i < states.size(); i++)
+        {
+            const auto &state = states[i];
+            QVERIFY(state == j[i]);
+        }
+    }
+
+    // Thread counts below 1 still generate on one thread
+    auto clamped = generator.generate({ { seed, raid, level } }, 0);
+    QCOMPARE(clamped.size(), 1);
+    QCOMPARE(clamped[0].size(), j.size());
+    for (size_t i = 0; i < clamped[0].size(); i++)
+    {
+        QVERIFY(clamped[0][i] == j[i]);
+    }
+
+    QVERIFY(generator.generate({}, 4).empty());
+}
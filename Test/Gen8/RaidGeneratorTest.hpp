@@ -28,6 +28,9 @@ class RaidGeneratorTest : public QObject
 private slots:
     void generate_data();
     void generate();
+
+    void generateTargets_data();
+    void generateTargets();
 };
 
 #endif // RAIDGENERATORTEST_HPP
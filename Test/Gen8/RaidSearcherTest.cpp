@@ -0,0 +1,204 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "RaidSearcherTest.hpp"
+#include <Core/Enum/Game.hpp>
+#include <Core/Gen8/Den.hpp>
+#include <Core/Gen8/Encounters8.hpp>
+#include <Core/Gen8/Generators/RaidGenerator.hpp>
+#include <Core/Gen8/Searchers/RaidSearcher.hpp>
+#include <Core/Gen8/States/State8.hpp>
+#include <QTest>
+#include <Test/Data.hpp>
+#include <algorithm>
+
+using IVs = std::array<u8, 6>;
+
+void RaidSearcherTest::search_data()
+{
+    QTest::addColumn<u64>("seed");
+    QTest::addColumn<Game>("version");
+    QTest::addColumn<int>("denIndex");
+    QTest::addColumn<int>("rarity");
+    QTest::addColumn<int>("raidIndex");
+    QTest::addColumn<u8>("level");
+    QTest::addColumn<u32>("advances");
+    QTest::addColumn<u32>("ec");
+    QTest::addColumn<u32>("pid");
+    QTest::addColumn<IVs>("ivs");
+    QTest::addColumn<u8>("nature");
+    QTest::addColumn<size_t>("seeds");
+
+    json data = readData("raid", "search");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data())
+            << d["seed"].get<u64>() << d["version"].get<Game>() << d["denIndex"].get<int>() << d["rarity"].get<int>()
+            << d["raidIndex"].get<int>() << d["level"].get<u8>() << d["advances"].get<u32>() << d["ec"].get<u32>() << d["pid"].get<u32>()
+            << d["ivs"].get<IVs>() << d["nature"].get<u8>() << d["seeds"].get<size_t>();
+    }
+}
+
+void RaidSearcherTest::search()
+{
+    QFETCH(u64, seed);
+    QFETCH(Game, version);
+    QFETCH(int, denIndex);
+    QFETCH(int, rarity);
+    QFETCH(int, raidIndex);
+    QFETCH(u8, level);
+    QFETCH(u32, advances);
+    QFETCH(u32, ec);
+    QFETCH(u32, pid);
+    QFETCH(IVs, ivs);
+    QFETCH(u8, nature);
+    QFETCH(size_t, seeds);
+
+    std::array<u8, 6> min;
+    min.fill(0);
+
+    std::array<u8, 6> max;
+    max.fill(31);
+
+    std::array<bool, 25> natures;
+    natures.fill(true);
+
+    std::array<bool, 16> powers;
+    powers.fill(true);
+
+    Profile8 profile("-", version, 12345, 54321, false, false, false);
+
+    const Den *den = Encounters8::getDen(denIndex, rarity);
+    Raid raid = den->getRaid(raidIndex, version);
+
+    StateFilter filter(255, 255, 255, 1, 100, 0, 255, 0, 255, false, min, max, natures, powers);
+    RaidGenerator generator(0, advances, 0, profile, filter);
+
+    RaidSearcher searcher({ { advances, ec, pid, ivs, nature } }, level, raid, generator);
+    searcher.setMaxProgress(searcher.getMaxProgress());
+    searcher.startSearch(4);
+    auto states = searcher.getResults();
+    QVERIFY(!states.empty());
+
+    // Only the observed state of each den seed is kept
+    QCOMPARE(states.size(), seeds);
+
+    bool found = false;
+    std::vector<u64> denSeeds;
+    for (const auto &state : states)
+    {
+        found |= state.getSeed0() == seed && state.getState().getAdvances() == advances;
+        denSeeds.emplace_back(state.getSeed0());
+
+        // Ensure generator agrees
+        auto generatorStates = generator.generate(state.getSeed0(), level, raid);
+        QVERIFY(std::any_of(generatorStates.begin(), generatorStates.end(), [&](const State8 &generatorState) {
+            return generatorState.getAdvances() == advances && generatorState.getEC() == ec && generatorState.getPID() == pid
+                && (ivs[0] == 255 || generatorState.getIVs() == ivs) && (nature == 255 || generatorState.getNature() == nature);
+        }));
+    }
+    QVERIFY(found);
+
+    std::ranges::sort(denSeeds);
+    denSeeds.erase(std::unique(denSeeds.begin(), denSeeds.end()), denSeeds.end());
+    QCOMPARE(denSeeds.size(), seeds);
+}
+
+void RaidSearcherTest::searchEmpty()
+{
+    std::array<u8, 6> min;
+    min.fill(0);
+
+    std::array<u8, 6> max;
+    max.fill(31);
+
+    std::array<bool, 25> natures;
+    natures.fill(true);
+
+    std::array<bool, 16> powers;
+    powers.fill(true);
+
+    Profile8 profile("-", Game::Sword, 12345, 54321, false, false, false);
+
+    const Den *den = Encounters8::getDen(0, 0);
+    Raid raid = den->getRaid(0, Game::Sword);
+
+    StateFilter filter(255, 255, 255, 1, 100, 0, 255, 0, 255, false, min, max, natures, powers);
+    RaidGenerator generator(0, 1, 0, profile, filter);
+
+    // The ECs disagree on the lower half of the den seed, so there are no candidates
+    RaidSearcher searcher({ { 0, 580741723, 314025583 }, { 1, 580741723, 3969527159 } }, 15, raid, generator);
+    QVERIFY(searcher.getMaxProgress() == 0);
+
+    searcher.startSearch(4);
+    QVERIFY(searcher.getResults().empty());
+}
+
+void RaidSearcherTest::searchBenchmark_data()
+{
+    search_data();
+}
+
+void RaidSearcherTest::searchBenchmark()
+{
+    QFETCH(u64, seed);
+    QFETCH(Game, version);
+    QFETCH(int, denIndex);
+    QFETCH(int, rarity);
+    QFETCH(int, raidIndex);
+    QFETCH(u8, level);
+    QFETCH(u32, advances);
+    QFETCH(u32, ec);
+    QFETCH(u32, pid);
+    QFETCH(IVs, ivs);
+    QFETCH(u8, nature);
+    QFETCH(size_t, seeds);
+
+    std::array<u8, 6> min;
+    min.fill(0);
+
+    std::array<u8, 6> max;
+    max.fill(31);
+
+    std::array<bool, 25> natures;
+    natures.fill(true);
+
+    std::array<bool, 16> powers;
+    powers.fill(true);
+
+    Profile8 profile("-", version, 12345, 54321, false, false, false);
+
+    const Den *den = Encounters8::getDen(denIndex, rarity);
+    Raid raid = den->getRaid(raidIndex, version);
+
+    StateFilter filter(255, 255, 255, 1, 100, 0, 255, 0, 255, false, min, max, natures, powers);
+    RaidGenerator generator(0, advances, 0, profile, filter);
+
+    // Candidate solving and validation on one thread
+    QBENCHMARK
+    {
+        RaidSearcher searcher({ { advances, ec, pid, ivs, nature } }, level, raid, generator);
+        searcher.setMaxProgress(searcher.getMaxProgress());
+        searcher.startSearch(1);
+
+        auto states = searcher.getResults();
+        QVERIFY(std::any_of(states.begin(), states.end(), [seed](const SearcherState8<State8> &state) { return state.getSeed0() == seed; }));
+        QCOMPARE(states.size(), seeds);
+    }
+}
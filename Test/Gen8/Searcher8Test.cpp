@@ -0,0 +1,109 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "Searcher8Test.hpp"
+#include <Core/Enum/Game.hpp>
+#include <Core/Enum/Lead.hpp>
+#include <Core/Gen8/Encounters8.hpp>
+#include <Core/Gen8/Generators/StaticGenerator8.hpp>
+#include <Core/Gen8/Searchers/Searcher8.hpp>
+#include <Core/Gen8/States/State8.hpp>
+#include <Core/RNG/Xorshift.hpp>
+#include <QTest>
+#include <Test/Data.hpp>
+#include <algorithm>
+
+void Searcher8Test::search_data()
+{
+    QTest::addColumn<u64>("seed0");
+    QTest::addColumn<u64>("seed1");
+    QTest::addColumn<int>("category");
+    QTest::addColumn<int>("pokemon");
+    QTest::addColumn<u32>("advances");
+    QTest::addColumn<u32>("count");
+    QTest::addColumn<u32>("mask");
+    QTest::addColumn<u64>("solutions");
+
+    json data = readData("static8", "search");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data())
+            << d["seed0"].get<u64>() << d["seed1"].get<u64>() << d["category"].get<int>() << d["pokemon"].get<int>()
+            << d["advances"].get<u32>() << d["count"].get<u32>() << d["mask"].get<u32>() << d["solutions"].get<u64>();
+    }
+}
+
+void Searcher8Test::search()
+{
+    QFETCH(u64, seed0);
+    QFETCH(u64, seed1);
+    QFETCH(int, category);
+    QFETCH(int, pokemon);
+    QFETCH(u32, advances);
+    QFETCH(u32, count);
+    QFETCH(u32, mask);
+    QFETCH(u64, solutions);
+
+    std::array<u8, 6> min;
+    min.fill(0);
+
+    std::array<u8, 6> max;
+    max.fill(31);
+
+    std::array<bool, 25> natures;
+    natures.fill(true);
+
+    std::array<bool, 16> powers;
+    powers.fill(true);
+
+    Profile8 profile("-", Game::BDSP, 12345, 54321, false, false, false);
+
+    const StaticTemplate8 *staticTemplate = Encounters8::getStaticEncounter(category, pokemon);
+    StateFilter filter(255, 255, 255, 1, 100, 0, 255, 0, 255, false, min, max, natures, powers);
+    StaticGenerator8 generator(0, 9, 0, Lead::None, *staticTemplate, profile, filter);
+
+    Xorshift rng(seed0, seed1, advances);
+    std::vector<XorshiftObservation> observations;
+    for (u32 i = 0; i < count; i++)
+    {
+        observations.emplace_back(XorshiftObservation { advances + i, mask, rng.next() & mask });
+    }
+
+    Searcher8<StaticGenerator8, State8> searcher(observations, generator);
+    QCOMPARE(searcher.getMaxProgress(), solutions);
+
+    searcher.setMaxProgress(searcher.getMaxProgress());
+    searcher.startSearch(4);
+    auto states = searcher.getResults();
+    QCOMPARE(states.size(), static_cast<size_t>(solutions * 10));
+
+    bool found = false;
+    for (const auto &state : states)
+    {
+        found |= state.getSeed0() == seed0 && state.getSeed1() == seed1;
+
+        // Ensure generator agrees
+        auto generatorStates = generator.generate(state.getSeed0(), state.getSeed1());
+        QVERIFY(std::any_of(generatorStates.begin(), generatorStates.end(), [&](const State8 &generatorState) {
+            return generatorState.getAdvances() == state.getState().getAdvances() && generatorState.getEC() == state.getState().getEC()
+                && generatorState.getPID() == state.getState().getPID() && generatorState.getIVs() == state.getState().getIVs();
+        }));
+    }
+    QVERIFY(solutions == 0 || found);
+}
@@ -149,3 +149,94 @@ void StaticGenerator8Test::generateRoamer()
         QVERIFY(state == j[i]);
     }
 }
+
+void StaticGenerator8Test::generateThreads_data()
+{
+    generate_data();
+}
+
+void StaticGenerator8Test::generateThreads()
+{
+    QFETCH(u64, seed0);
+    QFETCH(u64, seed1);
+    QFETCH(Lead, lead);
+    QFETCH(int, category);
+    QFETCH(int, pokemon);
+
+    std::array<u8, 6> min;
+    min.fill(0);
+
+    std::array<u8, 6> max;
+    max.fill(31);
+
+    std::array<bool, 25> natures;
+    natures.fill(true);
+
+    std::array<bool, 16> powers;
+    powers.fill(true);
+
+    Profile8 profile("-", Game::BDSP, 12345, 54321, false, false, false);
+
+    const StaticTemplate8 *staticTemplate = Encounters8::getStaticEncounter(category, pokemon);
+    StateFilter filter(255, 255, 255, 1, 100, 0, 255, 0, 255, false, min, max, natures, powers);
+    StaticGenerator8 generator(1000, 0x10000, 0, lead, *staticTemplate, profile, filter);
+
+    // Every thread jumps its RNG to the start of its block, so the threaded output has to match the sequential output
+    auto states = generator.generate(seed0, seed1);
+    auto threaded = generator.generate(seed0, seed1, 4);
+    QVERIFY(states.size() > 0x4000);
+    QCOMPARE(threaded.size(), states.size());
+
+    for (size_t i = 0; i < states.size(); i++)
+    {
+        QCOMPARE(threaded[i].getAdvances(), states[i].getAdvances());
+        QCOMPARE(threaded[i].getEC(), states[i].getEC());
+        QCOMPARE(threaded[i].getPID(), states[i].getPID());
+        QCOMPARE(threaded[i].getIVs(), states[i].getIVs());
+    }
+}
+
+void StaticGenerator8Test::generateRoamerThreads_data()
+{
+    generateRoamer_data();
+}
+
+void StaticGenerator8Test::generateRoamerThreads()
+{
+    QFETCH(u64, seed0);
+    QFETCH(u64, seed1);
+    QFETCH(int, category);
+    QFETCH(int, pokemon);
+
+    std::array<u8, 6> min;
+    min.fill(0);
+
+    std::array<u8, 6> max;
+    max.fill(31);
+
+    std::array<bool, 25> natures;
+    natures.fill(true);
+
+    std::array<bool, 16> powers;
+    powers.fill(true);
+
+    Profile8 profile("-", Game::BD, 12345, 54321, false, false, false);
+
+    const StaticTemplate8 *staticTemplate = Encounters8::getStaticEncounter(category, pokemon);
+    StateFilter filter(255, 255, 255, 1, 100, 0, 255, 0, 255, false, min, max, natures, powers);
+    StaticGenerator8 generator(1000, 0x10000, 0, Lead::None, *staticTemplate, profile, filter);
+
+    // Every thread jumps its RNG to the start of its block, so the threaded output has to match the sequential output
+    auto states = generator.generate(seed0, seed1);
+    auto threaded = generator.generate(seed0, seed1, 4);
+    QVERIFY(states.size() > 0x4000);
+    QCOMPARE(threaded.size(), states.size());
+
+    for (size_t i = 0; i < states.size(); i++)
+    {
+        QCOMPARE(threaded[i].getAdvances(), states[i].getAdvances());
+        QCOMPARE(threaded[i].getEC(), states[i].getEC());
+        QCOMPARE(threaded[i].getPID(), states[i].getPID());
+        QCOMPARE(threaded[i].getIVs(), states[i].getIVs());
+    }
+}
@@ -29,8 +29,14 @@ private slots:
     void generate_data();
     void generate();
 
+    void generateThreads_data();
+    void generateThreads();
+
     void generateRoamer_data();
     void generateRoamer();
+
+    void generateRoamerThreads_data();
+    void generateRoamerThreads();
 };
 
 #endif // STATICGENERATOR8TEST_HPP
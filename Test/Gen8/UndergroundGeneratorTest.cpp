@@ -106,3 +106,55 @@ void UndergroundGeneratorTest::generate()
         QVERIFY(state == j[i]);
     }
 }
+
+void UndergroundGeneratorTest::generateThreads_data()
+{
+    generate_data();
+}
+
+void UndergroundGeneratorTest::generateThreads()
+{
+    QFETCH(u64, seed0);
+    QFETCH(u64, seed1);
+    QFETCH(Lead, lead);
+    QFETCH(bool, diglett);
+    QFETCH(u8, levelFlag);
+    QFETCH(u8, storyFlag);
+    QFETCH(int, location);
+
+    std::array<u8, 6> min;
+    min.fill(0);
+
+    std::array<u8, 6> max;
+    max.fill(31);
+
+    std::array<bool, 25> natures;
+    natures.fill(true);
+
+    std::array<bool, 16> powers;
+    powers.fill(true);
+
+    Profile8 profile("", Game::BD, 12345, 54321, false, false, false);
+
+    std::vector<UndergroundArea> encounterAreas = Encounters8::getUndergroundEncounters(storyFlag, diglett, &profile);
+    auto encounterArea = std::ranges::find_if(
+        encounterAreas, [location](const UndergroundArea &encounterArea) { return encounterArea.getLocation() == location; });
+
+    UndergroundStateFilter filter(255, 255, 255, 1, 100, 0, 255, 0, 255, false, min, max, natures, powers, encounterArea->getSpecies());
+    UndergroundGenerator generator(1000, 0x10000, 0, lead, diglett, levelFlag, *encounterArea, profile, filter);
+
+    // Every thread jumps its RNG to the start of its block, so the threaded output has to match the sequential output
+    auto states = generator.generate(seed0, seed1);
+    auto threaded = generator.generate(seed0, seed1, 4);
+    QVERIFY(states.size() > 0x4000);
+    QCOMPARE(threaded.size(), states.size());
+
+    for (size_t i = 0; i < states.size(); i++)
+    {
+        QCOMPARE(threaded[i].getAdvances(), states[i].getAdvances());
+        QCOMPARE(threaded[i].getEC(), states[i].getEC());
+        QCOMPARE(threaded[i].getPID(), states[i].getPID());
+        QCOMPARE(threaded[i].getIVs(), states[i].getIVs());
+        QCOMPARE(threaded[i].getSpecie(), states[i].getSpecie());
+    }
+}
@@ -28,6 +28,9 @@ class UndergroundGeneratorTest : public QObject
 private slots:
     void generate_data();
     void generate();
+
+    void generateThreads_data();
+    void generateThreads();
 };
 
 #endif // UNDERGROUNDGENERATORTEST_HPP
@@ -176,3 +176,60 @@ void WildGenerator8Test::generateHoneyTree()
         QVERIFY(state == j[i]);
     }
 }
+
+void WildGenerator8Test::generateWildThreads_data()
+{
+    generateWild_data();
+}
+
+void WildGenerator8Test::generateWildThreads()
+{
+    QFETCH(u64, seed0);
+    QFETCH(u64, seed1);
+    QFETCH(Encounter, encounter);
+    QFETCH(Lead, lead);
+    QFETCH(bool, feebasTile);
+    QFETCH(int, location);
+
+    std::array<u8, 6> min;
+    min.fill(0);
+
+    std::array<u8, 6> max;
+    max.fill(31);
+
+    std::array<bool, 25> natures;
+    natures.fill(true);
+
+    std::array<bool, 16> powers;
+    powers.fill(true);
+
+    std::array<bool, 13> encounterSlots;
+    encounterSlots.fill(true);
+
+    Profile8 profile("", Game::BD, 12345, 54321, false, false, false);
+    EncounterSettings8 settings = { };
+
+    settings.feebasTile = feebasTile;
+
+    std::vector<EncounterArea8> encounterAreas = Encounters8::getEncounters(encounter, settings, &profile);
+    auto encounterArea = std::ranges::find_if(
+        encounterAreas, [location](const EncounterArea8 &encounterArea) { return encounterArea.getLocation() == location; });
+
+    WildStateFilter filter(255, 255, 255, 1, 100, 0, 255, 0, 255, false, min, max, natures, powers, encounterSlots);
+    WildGenerator8 generator(1000, 0x10000, 0, Method::None, lead, feebasTile, *encounterArea, profile, filter);
+
+    // Every thread jumps its RNG to the start of its block, so the threaded output has to match the sequential output
+    auto states = generator.generate(seed0, seed1, 0);
+    auto threaded = generator.generate(seed0, seed1, 0, 4);
+    QVERIFY(states.size() > 0x4000);
+    QCOMPARE(threaded.size(), states.size());
+
+    for (size_t i = 0; i < states.size(); i++)
+    {
+        QCOMPARE(threaded[i].getAdvances(), states[i].getAdvances());
+        QCOMPARE(threaded[i].getEC(), states[i].getEC());
+        QCOMPARE(threaded[i].getPID(), states[i].getPID());
+        QCOMPARE(threaded[i].getIVs(), states[i].getIVs());
+        QCOMPARE(threaded[i].getEncounterSlot(), states[i].getEncounterSlot());
+    }
+}
@@ -29,6 +29,9 @@ private slots:
     void generateWild_data();
     void generateWild();
 
+    void generateWildThreads_data();
+    void generateWildThreads();
+
     void generateHoneyTree_data();
     void generateHoneyTree();
 };
@@ -0,0 +1,169 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "SortFilterProxyModelTest.hpp"
+#include <Model/SortFilterProxyModel.hpp>
+#include <Model/TableModel.hpp>
+#include <QPersistentModelIndex>
+#include <QTest>
+#include <Test/Data.hpp>
+
+using Ranges = std::vector<std::pair<int, int>>;
+using Rows = std::vector<int>;
+using Values = std::vector<u32>;
+
+/**
+ * @brief Source model with the same value in three columns: a typed sort key, an integer and a padded hex string
+ */
+class ValueModel : public TableModel<u32>
+{
+public:
+    ValueModel() : TableModel(nullptr)
+    {
+    }
+
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override
+    {
+        return 3;
+    }
+
+    QVariant data(const QModelIndex &index, int role) const override
+    {
+        if (role == Qt::DisplayRole)
+        {
+            u32 value = model[index.row()];
+            switch (index.column())
+            {
+            case 0:
+                return value;
+            case 1:
+                return static_cast<int>(value);
+            case 2:
+                return QString::number(value, 16).toUpper().rightJustified(8, '0');
+            }
+        }
+        return QVariant();
+    }
+
+    void removeItems(int first, int last)
+    {
+        beginRemoveRows(QModelIndex(), first, last);
+        for (int row = last; row >= first; row--)
+        {
+            model.erase(row);
+        }
+        endRemoveRows();
+    }
+
+protected:
+    bool hasSortKey(int column) const override
+    {
+        return column == 0;
+    }
+
+    u64 getSortKey(const u32 &value, int column) const override
+    {
+        return value;
+    }
+};
+
+void SortFilterProxyModelTest::proxy_data()
+{
+    QTest::addColumn<Values>("values");
+    QTest::addColumn<int>("column");
+    QTest::addColumn<bool>("descending");
+    QTest::addColumn<Rows>("filter");
+    QTest::addColumn<Ranges>("removes");
+    QTest::addColumn<Values>("appends");
+    QTest::addColumn<Values>("results");
+
+    json data = readData("sortfilterproxymodel", "proxy");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data())
+            << d["values"].get<Values>() << d["column"].get<int>() << d["descending"].get<bool>() << d["filter"].get<Rows>()
+            << d["removes"].get<Ranges>() << d["appends"].get<Values>() << d["results"].get<Values>();
+    }
+}
+
+void SortFilterProxyModelTest::proxy()
+{
+    QFETCH(Values, values);
+    QFETCH(int, column);
+    QFETCH(bool, descending);
+    QFETCH(Rows, filter);
+    QFETCH(Ranges, removes);
+    QFETCH(Values, appends);
+    QFETCH(Values, results);
+
+    ValueModel model;
+    model.addItems(values);
+
+    SortFilterProxyModel proxy(nullptr, &model);
+    proxy.sort(column, descending ? Qt::DescendingOrder : Qt::AscendingOrder);
+    if (!filter.empty())
+    {
+        proxy.setFilteredRows(filter);
+    }
+
+    // Removed rows must not reset the proxy, which would drop the sort order and the selection of the view
+    int resets = 0;
+    connect(&proxy, &QAbstractItemModel::modelReset, this, [&resets] { resets++; });
+
+    std::vector<std::pair<QPersistentModelIndex, u32>> indexes;
+    for (int row = 0; row < proxy.rowCount(); row++)
+    {
+        QModelIndex index = proxy.index(row, 0);
+        indexes.emplace_back(index, model.getItem(proxy.mapToSource(index).row()));
+    }
+
+    for (const auto &[first, last] : removes)
+    {
+        model.removeItems(first, last);
+    }
+    QCOMPARE(resets, 0);
+
+    // Persistent indexes of the remaining rows still point at the same value
+    int valid = 0;
+    for (const auto &[index, value] : indexes)
+    {
+        if (index.isValid())
+        {
+            QCOMPARE(model.getItem(proxy.mapToSource(index).row()), value);
+            valid++;
+        }
+    }
+    QCOMPARE(valid, proxy.rowCount());
+
+    model.addItems(appends);
+
+    // Sorting again rebuilds the rows from the filter, which has to follow the removed rows as well
+    for (int pass = 0; pass < 2; pass++)
+    {
+        QCOMPARE(proxy.rowCount(), static_cast<int>(results.size()));
+        for (int row = 0; row < proxy.rowCount(); row++)
+        {
+            QModelIndex index = proxy.mapToSource(proxy.index(row, 0));
+            QCOMPARE(model.getItem(index.row()), results[row]);
+            QCOMPARE(proxy.mapFromSource(index).row(), row);
+            QCOMPARE(proxy.index(row, column < 0 ? 0 : column).data(), model.index(index.row(), column < 0 ? 0 : column).data());
+        }
+        proxy.sort(column, descending ? Qt::DescendingOrder : Qt::AscendingOrder);
+    }
+}
@@ -0,0 +1,159 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "TableStorageTest.hpp"
+#include <Model/TableStorage.hpp>
+#include <QTest>
+#include <Test/Data.hpp>
+
+using Flags = std::vector<bool>;
+using Rows = std::vector<u32>;
+
+/**
+ * @brief Row kept in the storage. The value is derived from the row it was first added as, so moved rows can be told apart.
+ */
+struct Row
+{
+    u32 row;
+    u32 value;
+
+    bool operator==(const Row &other) const = default;
+};
+
+static Row makeRow(u32 row, u32 salt)
+{
+    return Row { row, (row * 0x9e3779b1) ^ salt };
+}
+
+void TableStorageTest::storage_data()
+{
+    QTest::addColumn<u32>("spillRows");
+    QTest::addColumn<Rows>("batches");
+    QTest::addColumn<Flags>("paged");
+    QTest::addColumn<Rows>("erases");
+    QTest::addColumn<Rows>("sets");
+
+    json data = readData("tablestorage", "storage");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data()) << d["spillRows"].get<u32>() << d["batches"].get<Rows>()
+                                                           << d["paged"].get<Flags>() << d["erases"].get<Rows>() << d["sets"].get<Rows>();
+    }
+}
+
+void TableStorageTest::storage()
+{
+    QFETCH(u32, spillRows);
+    QFETCH(Rows, batches);
+    QFETCH(Flags, paged);
+    QFETCH(Rows, erases);
+    QFETCH(Rows, sets);
+
+    TableStorage<Row> storage(spillRows * sizeof(Row));
+    QVERIFY(storage.empty());
+    QVERIFY(!storage.paged());
+
+    std::vector<Row> expected;
+    for (size_t i = 0; i < batches.size(); i++)
+    {
+        std::vector<Row> rows;
+        for (u32 j = 0; j < batches[i]; j++)
+        {
+            rows.emplace_back(makeRow(expected.size() + j, 0));
+        }
+
+        // In memory rows never move, even when more rows are added
+        const Row *first = expected.empty() || storage.paged() ? nullptr : &storage[0];
+
+        // A batch of one goes through the single item overload
+        if (rows.size() == 1)
+        {
+            storage.append(rows[0]);
+        }
+        else
+        {
+            storage.append(rows);
+        }
+        expected.insert(expected.end(), rows.begin(), rows.end());
+
+        QCOMPARE(storage.paged(), paged[i]);
+        QCOMPARE(storage.size(), expected.size());
+        if (first && !storage.paged())
+        {
+            QVERIFY(first == &storage[0]);
+        }
+
+        for (size_t row = 0; row < expected.size(); row++)
+        {
+            QCOMPARE(storage[row], expected[row]);
+            QCOMPARE(storage.at(row), expected[row]);
+        }
+    }
+
+    for (u32 row : erases)
+    {
+        storage.erase(row);
+        expected.erase(expected.begin() + row);
+    }
+
+    for (u32 row : sets)
+    {
+        Row item = makeRow(row, 0xffffffff);
+        storage.set(row, item);
+        expected[row] = item;
+    }
+
+    QCOMPARE(storage.size(), expected.size());
+    QCOMPARE(storage.empty(), expected.empty());
+    for (size_t row = 0; row < expected.size(); row++)
+    {
+        QCOMPARE(storage[row], expected[row]);
+        QCOMPARE(storage.at(row), expected[row]);
+    }
+
+    storage.clear();
+    QVERIFY(storage.empty());
+    QVERIFY(!storage.paged());
+    QCOMPARE(storage.size(), 0);
+}
+
+void TableStorageTest::storageNonTrivial()
+{
+    // Rows that can not be written as raw records stay in memory regardless of their size
+    TableStorage<std::string> storage(1);
+
+    std::vector<std::string> expected;
+    for (u32 i = 0; i < 5000; i++)
+    {
+        expected.emplace_back(std::to_string(i));
+    }
+    storage.append(expected);
+    QVERIFY(!storage.paged());
+
+    storage.erase(0);
+    expected.erase(expected.begin());
+    storage.set(4096, "set");
+    expected[4096] = "set";
+
+    QCOMPARE(storage.size(), expected.size());
+    for (size_t row = 0; row < expected.size(); row++)
+    {
+        QCOMPARE(storage[row], expected[row]);
+    }
+}
@@ -22,6 +22,7 @@
 #include <QTest>
 #include <Test/Data.hpp>
 #include <Test/Enum.hpp>
+#include <algorithm>
 
 using IVs = std::array<u8, 6>;
 
@@ -80,6 +81,45 @@ void LCRNGReverseTest::recoverPokeRNGIV()
     }
 }
 
+void LCRNGReverseTest::recoverPokeRNGIVRow_data()
+{
+    QTest::addColumn<Method>("method");
+    QTest::addColumn<IVs>("ivs");
+    QTest::addColumn<std::vector<u32>>("results");
+
+    json data = readData("lcrngreverse", "recoverPokeRNGIV");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data())
+            << d["method"].get<Method>() << d["ivs"].get<IVs>() << d["results"].get<std::vector<u32>>();
+    }
+}
+
+void LCRNGReverseTest::recoverPokeRNGIVRow()
+{
+    QFETCH(Method, method);
+    QFETCH(IVs, ivs);
+    QFETCH(std::vector<u32>, results);
+
+    // Request the full row so the scan is used instead of the lattice recovery
+    IVs min = { ivs[0], ivs[1], ivs[2], 0, 0, 0 };
+    IVs max = { ivs[0], ivs[1], ivs[2], 31, 31, 31 };
+
+    std::vector<u32> seeds;
+    auto addSeeds = [&](const IVs &rowIVs, const RecoverySeeds<6> &rowSeeds) {
+        if (rowIVs == ivs)
+        {
+            seeds.insert(seeds.end(), rowSeeds.seeds, rowSeeds.seeds + rowSeeds.count);
+        }
+    };
+    LCRNGReverse::recoverPokeRNGIVRow(ivs[0], ivs[1], ivs[2], min, max, method, addSeeds);
+
+    // Row scans do not preserve the ordering of the lattice recovery
+    std::sort(seeds.begin(), seeds.end());
+    std::sort(results.begin(), results.end());
+    QCOMPARE(seeds, results);
+}
+
 void LCRNGReverseTest::recoverPokeRNGPID_data()
 {
     QTest::addColumn<Method>("method");
@@ -135,6 +175,42 @@ void LCRNGReverseTest::recoverXDRNGIV()
     }
 }
 
+void LCRNGReverseTest::recoverXDRNGIVRow_data()
+{
+    QTest::addColumn<IVs>("ivs");
+    QTest::addColumn<std::vector<u32>>("results");
+
+    json data = readData("lcrngreverse", "recoverXDRNGIV");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data()) << d["ivs"].get<IVs>() << d["results"].get<std::vector<u32>>();
+    }
+}
+
+void LCRNGReverseTest::recoverXDRNGIVRow()
+{
+    QFETCH(IVs, ivs);
+    QFETCH(std::vector<u32>, results);
+
+    // Request the full row so the scan is used instead of the lattice recovery
+    IVs min = { ivs[0], ivs[1], ivs[2], 0, 0, 0 };
+    IVs max = { ivs[0], ivs[1], ivs[2], 31, 31, 31 };
+
+    std::vector<u32> seeds;
+    auto addSeeds = [&](const IVs &rowIVs, const RecoverySeeds<6> &rowSeeds) {
+        if (rowIVs == ivs)
+        {
+            seeds.insert(seeds.end(), rowSeeds.seeds, rowSeeds.seeds + rowSeeds.count);
+        }
+    };
+    LCRNGReverse::recoverXDRNGIVRow(ivs[0], ivs[1], ivs[2], min, max, addSeeds);
+
+    // Row scans do not preserve the ordering of the lattice recovery
+    std::sort(seeds.begin(), seeds.end());
+    std::sort(results.begin(), results.end());
+    QCOMPARE(seeds, results);
+}
+
 void LCRNGReverseTest::recoverXDRNGPID_data()
 {
     QTest::addColumn<u32>("pid");
@@ -32,12 +32,18 @@ private slots:
     void recoverPokeRNGIV_data();
     void recoverPokeRNGIV();
 
+    void recoverPokeRNGIVRow_data();
+    void recoverPokeRNGIVRow();
+
     void recoverPokeRNGPID_data();
     void recoverPokeRNGPID();
 
     void recoverXDRNGIV_data();
     void recoverXDRNGIV();
 
+    void recoverXDRNGIVRow_data();
+    void recoverXDRNGIVRow();
+
     void recoverXDRNGPID_data();
     void recoverXDRNGPID();
 };
@@ -89,3 +89,38 @@ void MTTest::next()
     MT rng(seed);
     QCOMPARE(rng.next(), result);
 }
+
+void MTTest::split_data()
+{
+    QTest::addColumn<u32>("seed");
+    QTest::addColumn<u32>("advances");
+    QTest::addColumn<u32>("count");
+    QTest::addColumn<u32>("length");
+    QTest::addColumn<std::vector<u32>>("results");
+
+    json data = readData("mt", "split");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data()) << d["seed"].get<u32>() << d["advances"].get<u32>() << d["count"].get<u32>()
+                                                           << d["length"].get<u32>() << d["results"].get<std::vector<u32>>();
+    }
+}
+
+void MTTest::split()
+{
+    QFETCH(u32, seed);
+    QFETCH(u32, advances);
+    QFETCH(u32, count);
+    QFETCH(u32, length);
+    QFETCH(std::vector<u32>, results);
+
+    MT rng(seed);
+    rng.advance(advances);
+
+    auto streams = rng.split(count, length);
+    QCOMPARE(streams.size(), results.size());
+    for (size_t i = 0; i < streams.size(); i++)
+    {
+        QCOMPARE(streams[i].next(), results[i]);
+    }
+}
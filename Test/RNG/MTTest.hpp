@@ -34,6 +34,9 @@ private slots:
 
     void next_data();
     void next();
+
+    void split_data();
+    void split();
 };
 
 #endif // MTTEST_HPP
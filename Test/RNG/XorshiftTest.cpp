@@ -19,6 +19,7 @@
 
 #include "XorshiftTest.hpp"
 #include <Core/RNG/Xorshift.hpp>
+#include <Core/RNG/XorshiftReverse.hpp>
 #include <QTest>
 #include <Test/Data.hpp>
 
@@ -90,3 +91,58 @@ void XorshiftTest::next()
     Xorshift rng(seed, seed ^ (seed >> 32));
     QCOMPARE(rng.next(), result);
 }
+
+void XorshiftTest::reverse_data()
+{
+    QTest::addColumn<u64>("seed");
+    QTest::addColumn<u32>("advances");
+    QTest::addColumn<u32>("count");
+    QTest::addColumn<u32>("mask");
+    QTest::addColumn<u64>("results");
+
+    json data = readData("xorshift", "reverse");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data()) << d["seed"].get<u64>() << d["advances"].get<u32>() << d["count"].get<u32>()
+                                                           << d["mask"].get<u32>() << d["results"].get<u64>();
+    }
+}
+
+void XorshiftTest::reverse()
+{
+    QFETCH(u64, seed);
+    QFETCH(u32, advances);
+    QFETCH(u32, count);
+    QFETCH(u32, mask);
+    QFETCH(u64, results);
+
+    Xorshift rng(seed, seed ^ (seed >> 32), advances);
+    std::vector<XorshiftObservation> observations;
+    for (u32 i = 0; i < count; i++)
+    {
+        observations.emplace_back(XorshiftObservation { advances + i, mask, rng.next() & mask });
+    }
+
+    XorshiftReverse reverse(observations);
+    QCOMPARE(reverse.getSolutionCount(), results);
+
+    bool found = false;
+    for (u64 i = 0; i < results; i++)
+    {
+        auto solution = reverse.getSolution(i);
+        if (solution[0] == seed && solution[1] == (seed ^ (seed >> 32)))
+        {
+            found = true;
+        }
+
+        Xorshift check(solution[0], solution[1]);
+        u32 advance = 0;
+        for (const auto &observation : observations)
+        {
+            check.advance(observation.advance - advance);
+            QCOMPARE(check.next() & mask, observation.value);
+            advance = observation.advance + 1;
+        }
+    }
+    QVERIFY(results == 0 || found);
+}
@@ -34,6 +34,9 @@ private slots:
 
     void next_data();
     void next();
+
+    void reverse_data();
+    void reverse();
 };
 
 #endif // XORSHIFTTEST_HPP
@@ -0,0 +1,53 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "AdvanceSearcherTest.hpp"
+#include <Core/Util/AdvanceSearcher.hpp>
+#include <QTest>
+#include <Test/Data.hpp>
+
+using Values = std::vector<u8>;
+using Results = std::vector<size_t>;
+
+void AdvanceSearcherTest::findMatches_data()
+{
+    QTest::addColumn<Values>("values");
+    QTest::addColumn<AdvanceSearcher::Sequence>("sequence");
+    QTest::addColumn<int>("threads");
+    QTest::addColumn<Results>("results");
+
+    json data = readData("advancesearcher", "findMatches");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data()) << d["values"].get<Values>()
+                                                           << d["sequence"].get<AdvanceSearcher::Sequence>() << d["threads"].get<int>()
+                                                           << d["results"].get<Results>();
+    }
+}
+
+void AdvanceSearcherTest::findMatches()
+{
+    QFETCH(Values, values);
+    QFETCH(AdvanceSearcher::Sequence, sequence);
+    QFETCH(int, threads);
+    QFETCH(Results, results);
+
+    auto matches = AdvanceSearcher::findMatches(values, sequence, threads);
+    QCOMPARE(matches, results);
+}
@@ -0,0 +1,95 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "CheckpointTest.hpp"
+#include <Core/Util/Checkpoint.hpp>
+#include <QTemporaryDir>
+#include <QTest>
+#include <Test/Data.hpp>
+#include <filesystem>
+
+using Units = std::vector<u32>;
+
+void CheckpointTest::open_data()
+{
+    QTest::addColumn<u64>("key");
+    QTest::addColumn<u32>("units");
+    QTest::addColumn<std::string>("writes");
+    QTest::addColumn<u32>("truncate");
+    QTest::addColumn<u64>("resumeKey");
+    QTest::addColumn<u32>("resumeUnits");
+    QTest::addColumn<bool>("resumed");
+    QTest::addColumn<Units>("done");
+    QTest::addColumn<std::string>("data");
+
+    json data = readData("checkpoint", "open");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data())
+            << d["key"].get<u64>() << d["units"].get<u32>() << d["writes"].get<json>().dump() << d["truncate"].get<u32>()
+            << d["resumeKey"].get<u64>() << d["resumeUnits"].get<u32>() << d["resumed"].get<bool>() << d["done"].get<Units>()
+            << d["data"].get<std::string>();
+    }
+}
+
+void CheckpointTest::open()
+{
+    QFETCH(u64, key);
+    QFETCH(u32, units);
+    QFETCH(std::string, writes);
+    QFETCH(u32, truncate);
+    QFETCH(u64, resumeKey);
+    QFETCH(u32, resumeUnits);
+    QFETCH(bool, resumed);
+    QFETCH(Units, done);
+    QFETCH(std::string, data);
+
+    QTemporaryDir temp;
+    QVERIFY(temp.isValid());
+    std::string file = temp.filePath("test.checkpoint").toStdString();
+
+    Checkpoint checkpoint(file);
+    QVERIFY(!checkpoint.open(key, units));
+    for (const auto &write : json::parse(writes))
+    {
+        QVERIFY(checkpoint.write(write["unit"].get<u32>(), write["data"].get<std::string>()));
+    }
+
+    // Simulates a crash part way through writing
+    std::filesystem::resize_file(file, std::filesystem::file_size(file) - truncate);
+
+    Checkpoint resume(file);
+    QCOMPARE(resume.open(resumeKey, resumeUnits), resumed);
+    for (u32 unit = 0; unit < resumeUnits; unit++)
+    {
+        QCOMPARE(resume.isDone(unit), std::ranges::find(done, unit) != done.end());
+    }
+    QCOMPARE(resume.getData(), data);
+
+    // Units completed after resuming are appended to the ones already in the file
+    QVERIFY(resume.write(resumeUnits - 1, "last"));
+
+    Checkpoint last(file);
+    QVERIFY(last.open(resumeKey, resumeUnits));
+    QVERIFY(last.isDone(resumeUnits - 1));
+    QCOMPARE(last.getData(), data + "last");
+
+    last.remove();
+    QVERIFY(!std::filesystem::exists(file));
+}
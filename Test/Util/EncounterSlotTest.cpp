@@ -93,6 +93,32 @@ void EncounterSlotTest::kSlot()
     }
 }
 
+void EncounterSlotTest::bwSlot_data()
+{
+    QTest::addColumn<Encounter>("encounter");
+    QTest::addColumn<u8>("luckyPower");
+    QTest::addColumn<std::vector<u8>>("rand");
+
+    json data = readData("encounterslot", "bw");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data())
+            << d["encounter"].get<Encounter>() << d["luckyPower"].get<u8>() << d["rand"].get<std::vector<u8>>();
+    }
+}
+
+void EncounterSlotTest::bwSlot()
+{
+    QFETCH(Encounter, encounter);
+    QFETCH(u8, luckyPower);
+    QFETCH(std::vector<u8>, rand);
+
+    for (size_t i = 0; i < rand.size(); i++)
+    {
+        QCOMPARE(EncounterSlot::bwSlot(rand[i], encounter, luckyPower), i);
+    }
+}
+
 void EncounterSlotTest::bdspSlot_data()
 {
     QTest::addColumn<Encounter>("encounter");
@@ -35,6 +35,9 @@ private slots:
     void kSlot_data();
     void kSlot();
 
+    void bwSlot_data();
+    void bwSlot();
+
     void bdspSlot_data();
     void bdspSlot();
 };
@@ -0,0 +1,135 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "ResultStreamTest.hpp"
+#include <Core/Util/ResultStream.hpp>
+#include <QTemporaryDir>
+#include <QTest>
+#include <Test/Data.hpp>
+#include <filesystem>
+
+using Rows = std::vector<u32>;
+
+/**
+ * @brief Row written to the stream. The value is derived from the row it was first written to, so moved rows can be told apart.
+ */
+struct Row
+{
+    u32 row;
+    u32 value;
+
+    bool operator==(const Row &other) const = default;
+};
+
+static Row makeRow(u32 row, u32 salt)
+{
+    return Row { row, (row * 0x9e3779b1) ^ salt };
+}
+
+void ResultStreamTest::roundTrip_data()
+{
+    QTest::addColumn<Rows>("batches");
+    QTest::addColumn<Rows>("erases");
+    QTest::addColumn<Rows>("sets");
+
+    json data = readData("resultstream", "roundTrip");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data())
+            << d["batches"].get<Rows>() << d["erases"].get<Rows>() << d["sets"].get<Rows>();
+    }
+}
+
+void ResultStreamTest::roundTrip()
+{
+    QFETCH(Rows, batches);
+    QFETCH(Rows, erases);
+    QFETCH(Rows, sets);
+
+    QTemporaryDir temp;
+    QVERIFY(temp.isValid());
+    std::string file = temp.filePath("test.bin").toStdString();
+
+    std::vector<Row> expected;
+    {
+        ResultStream<Row> stream(file);
+        QVERIFY(stream.good());
+
+        for (u32 batch : batches)
+        {
+            std::vector<Row> rows;
+            for (u32 i = 0; i < batch; i++)
+            {
+                rows.emplace_back(makeRow(expected.size() + i, 0));
+            }
+            stream.append(rows);
+            expected.insert(expected.end(), rows.begin(), rows.end());
+
+            // Reading the last row caches a partially filled page that the next append has to replace
+            if (!expected.empty())
+            {
+                QCOMPARE(stream[expected.size() - 1], expected.back());
+            }
+        }
+        QCOMPARE(stream.size(), expected.size());
+
+        // Forward, backward and strided reads touch more pages than the cache holds
+        for (size_t i = 0; i < expected.size(); i++)
+        {
+            QCOMPARE(stream[i], expected[i]);
+        }
+        for (size_t i = expected.size(); i-- > 0;)
+        {
+            QCOMPARE(stream.at(i), expected[i]);
+        }
+        for (size_t stride = 4095; stride <= 4097; stride++)
+        {
+            for (size_t i = 0; i < expected.size(); i += stride)
+            {
+                QCOMPARE(stream[i], expected[i]);
+            }
+        }
+
+        for (u32 row : erases)
+        {
+            stream.erase(row);
+            expected.erase(expected.begin() + row);
+        }
+
+        // The page of each replaced row is cached first, so a stale page would be returned afterwards
+        for (u32 row : sets)
+        {
+            QCOMPARE(stream[row], expected[row]);
+
+            Row item = makeRow(row, 0xffffffff);
+            stream.set(row, item);
+            expected[row] = item;
+            QCOMPARE(stream[row], item);
+        }
+
+        QCOMPARE(stream.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); i++)
+        {
+            QCOMPARE(stream.at(i), expected[i]);
+        }
+        QVERIFY(stream.good());
+    }
+
+    QVERIFY(!std::filesystem::exists(file));
+}
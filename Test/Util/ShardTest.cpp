@@ -0,0 +1,92 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "ShardTest.hpp"
+#include <Core/Util/Shard.hpp>
+#include <QTest>
+#include <Test/Data.hpp>
+
+using Ranges = std::vector<std::array<u64, 2>>;
+using Units = std::vector<u32>;
+
+void ShardTest::getUnits_data()
+{
+    QTest::addColumn<u32>("index");
+    QTest::addColumn<u32>("count");
+    QTest::addColumn<Units>("units");
+    QTest::addColumn<Units>("results");
+
+    json data = readData("shard", "getUnits");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data())
+            << d["index"].get<u32>() << d["count"].get<u32>() << d["units"].get<Units>() << d["results"].get<Units>();
+    }
+}
+
+void ShardTest::getUnits()
+{
+    QFETCH(u32, index);
+    QFETCH(u32, count);
+    QFETCH(Units, units);
+    QFETCH(Units, results);
+
+    Shard shard = units.empty() ? Shard(index, count) : Shard(units);
+    auto selected = shard.getUnits(Shard::split(0, 99, 10));
+
+    QCOMPARE(selected.size(), results.size());
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        QCOMPARE(selected[i].index, results[i]);
+        QVERIFY(shard.contains(results[i]));
+    }
+}
+
+void ShardTest::split_data()
+{
+    QTest::addColumn<u64>("start");
+    QTest::addColumn<u64>("end");
+    QTest::addColumn<u32>("count");
+    QTest::addColumn<Ranges>("results");
+
+    json data = readData("shard", "split");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data())
+            << d["start"].get<u64>() << d["end"].get<u64>() << d["count"].get<u32>() << d["results"].get<Ranges>();
+    }
+}
+
+void ShardTest::split()
+{
+    QFETCH(u64, start);
+    QFETCH(u64, end);
+    QFETCH(u32, count);
+    QFETCH(Ranges, results);
+
+    auto units = Shard::split(start, end, count);
+
+    QCOMPARE(units.size(), results.size());
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        QCOMPARE(units[i].index, static_cast<u32>(i));
+        QCOMPARE(units[i].start, results[i][0]);
+        QCOMPARE(units[i].end, results[i][1]);
+    }
+}
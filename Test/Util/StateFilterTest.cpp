@@ -0,0 +1,298 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "StateFilterTest.hpp"
+#include <Core/Enum/Game.hpp>
+#include <Core/Parents/Filters/StateFilter.hpp>
+#include <Core/Parents/PersonalLoader.hpp>
+#include <Core/Parents/States/State.hpp>
+#include <Core/Parents/States/StateBatch.hpp>
+#include <Core/Parents/States/StateCandidates.hpp>
+#include <Core/RNG/LCRNG.hpp>
+#include <QTest>
+#include <Test/Data.hpp>
+
+using IVs = std::array<u8, 6>;
+
+/**
+ * @brief Returns a table with the entries listed in \p key of \p j kept, or every entry kept when \p key is missing
+ */
+template <size_t size>
+static std::array<bool, size> getFlags(const json &j, const std::string &key)
+{
+    std::array<bool, size> flags;
+    flags.fill(!j.contains(key));
+    if (j.contains(key))
+    {
+        for (u8 flag : j[key].get<std::vector<u8>>())
+        {
+            flags[flag] = true;
+        }
+    }
+    return flags;
+}
+
+/**
+ * @brief Builds a filter from \p j where missing values do not filter anything
+ */
+static WildStateFilter getFilter(const json &j)
+{
+    return WildStateFilter(j.value<u8>("gender", 255), j.value<u8>("ability", 255), j.value<u8>("shiny", 255), j.value<u8>("levelMin", 0),
+                           j.value<u8>("levelMax", 100), 0, 255, 0, 255, j.value("skip", false), j.value("min", IVs { 0, 0, 0, 0, 0, 0 }),
+                           j.value("max", IVs { 31, 31, 31, 31, 31, 31 }), getFlags<25>(j, "natures"), getFlags<16>(j, "powers"),
+                           getFlags<13>(j, "encounterSlots"));
+}
+
+void StateFilterTest::compareIV_data()
+{
+    QTest::addColumn<IVs>("min");
+    QTest::addColumn<IVs>("max");
+    QTest::addColumn<IVs>("ivs");
+    QTest::addColumn<bool>("result");
+
+    json data = readData("statefilter", "compareIV");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data())
+            << d["min"].get<IVs>() << d["max"].get<IVs>() << d["ivs"].get<IVs>() << d["result"].get<bool>();
+    }
+}
+
+void StateFilterTest::compareIV()
+{
+    QFETCH(IVs, min);
+    QFETCH(IVs, max);
+    QFETCH(IVs, ivs);
+    QFETCH(bool, result);
+
+    std::array<bool, 25> natures;
+    natures.fill(true);
+
+    std::array<bool, 16> powers;
+    powers.fill(true);
+
+    StateFilter filter(255, 255, 255, 0, 255, 0, 255, 0, 255, false, min, max, natures, powers);
+    QCOMPARE(filter.compareIV(ivs), result);
+
+    State state(0, ivs, 0, 0, 50, 0, 0, PersonalLoader::getPersonal(Game::Black, 1));
+    QCOMPARE(filter.compareState(state), result);
+}
+
+void StateFilterTest::contains_data()
+{
+    QTest::addColumn<std::string>("searched");
+    QTest::addColumn<std::string>("filter");
+    QTest::addColumn<bool>("wild");
+    QTest::addColumn<bool>("result");
+
+    json data = readData("statefilter", "contains");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data())
+            << d["searched"].dump() << d["filter"].dump() << d["wild"].get<bool>() << d["result"].get<bool>();
+    }
+}
+
+void StateFilterTest::contains()
+{
+    QFETCH(std::string, searched);
+    QFETCH(std::string, filter);
+    QFETCH(bool, wild);
+    QFETCH(bool, result);
+
+    WildStateFilter searchedFilter = getFilter(json::parse(searched));
+    WildStateFilter newFilter = getFilter(json::parse(filter));
+    if (wild)
+    {
+        QCOMPARE(searchedFilter.contains(newFilter), result);
+    }
+    else
+    {
+        // Copies only keep the StateFilter part so encounter slots are ignored
+        StateFilter searchedState = searchedFilter;
+        StateFilter newState = newFilter;
+        QCOMPARE(searchedState.contains(newState), result);
+    }
+}
+
+void StateFilterTest::compareStates_data()
+{
+    QTest::addColumn<std::string>("filter");
+    QTest::addColumn<u32>("size");
+
+    json data = readData("statefilter", "compareStates");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data()) << d["filter"].dump() << d["size"].get<u32>();
+    }
+}
+
+void StateFilterTest::compareStates()
+{
+    QFETCH(std::string, filter);
+    QFETCH(u32, size);
+
+    StateFilter stateFilter = getFilter(json::parse(filter));
+    const PersonalInfo *info = PersonalLoader::getPersonal(Game::Black, 1);
+
+    // Random columns, sizes that are not a multiple of 16 also run the scalar tail after the SIMD rows
+    PokeRNG rng(size);
+    StateBatch batch(size);
+    for (u32 row = 0; row < size; row++)
+    {
+        batch.advances[row] = row;
+        batch.ec[row] = rng.next();
+        batch.pid[row] = rng.next();
+        for (auto &column : batch.ivs)
+        {
+            column[row] = rng.nextUShort(32);
+        }
+        batch.ability[row] = rng.nextUShort(3);
+        batch.gender[row] = rng.nextUShort(3);
+        batch.level[row] = rng.nextUShort(100) + 1;
+        batch.nature[row] = rng.nextUShort(25);
+        batch.shiny[row] = rng.nextUShort(3);
+    }
+
+    std::vector<u32> rows;
+    stateFilter.compareStates(batch, rows);
+
+    std::vector<u32> expected;
+    for (u32 row = 0; row < size; row++)
+    {
+        GeneratorState state = batch.getState(row, info);
+        QCOMPARE(state.getAdvances(), batch.advances[row]);
+        QCOMPARE(state.getEC(), batch.ec[row]);
+        QCOMPARE(state.getPID(), batch.pid[row]);
+        QCOMPARE(state.getIVs(), (IVs { batch.ivs[0][row], batch.ivs[1][row], batch.ivs[2][row], batch.ivs[3][row], batch.ivs[4][row],
+                                        batch.ivs[5][row] }));
+        QCOMPARE(state.getAbility(), batch.ability[row]);
+        QCOMPARE(state.getGender(), batch.gender[row]);
+        QCOMPARE(state.getLevel(), batch.level[row]);
+        QCOMPARE(state.getNature(), batch.nature[row]);
+        QCOMPARE(state.getShiny(), batch.shiny[row]);
+
+        if (stateFilter.compareState(static_cast<const State &>(state)))
+        {
+            expected.emplace_back(row);
+        }
+    }
+    QCOMPARE(rows, expected);
+
+    std::vector<GeneratorState> states;
+    batch.getStates(rows, info, states);
+    QCOMPARE(states.size(), rows.size());
+    for (size_t i = 0; i < rows.size(); i++)
+    {
+        QCOMPARE(states[i].getAdvances(), rows[i]);
+    }
+}
+
+void StateFilterTest::relaxed_data()
+{
+    QTest::addColumn<std::string>("filter");
+    QTest::addColumn<std::string>("other");
+    QTest::addColumn<bool>("contains");
+
+    json data = readData("statefilter", "relaxed");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data()) << d["filter"].dump() << d["other"].dump() << d["contains"].get<bool>();
+    }
+}
+
+void StateFilterTest::relaxed()
+{
+    QFETCH(std::string, filter);
+    QFETCH(std::string, other);
+    QFETCH(bool, contains);
+
+    StateFilter stateFilter = getFilter(json::parse(filter));
+    StateFilter relaxedFilter = stateFilter.relaxed();
+
+    QVERIFY(relaxedFilter.contains(stateFilter));
+    QCOMPARE(relaxedFilter.contains(getFilter(json::parse(other))), contains);
+}
+
+void StateFilterTest::candidates_data()
+{
+    QTest::addColumn<std::string>("filter");
+    QTest::addColumn<u32>("size");
+    QTest::addColumn<int>("threads");
+    QTest::addColumn<u32>("first");
+
+    json data = readData("statefilter", "candidates");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data())
+            << d["filter"].dump() << d["size"].get<u32>() << d["threads"].get<int>() << d["first"].get<u32>();
+    }
+}
+
+void StateFilterTest::candidates()
+{
+    QFETCH(std::string, filter);
+    QFETCH(u32, size);
+    QFETCH(int, threads);
+    QFETCH(u32, first);
+
+    StateFilter stateFilter = getFilter(json::parse(filter));
+    const PersonalInfo *info = PersonalLoader::getPersonal(Game::Black, 1);
+
+    PokeRNG rng(size);
+    std::vector<GeneratorState> states;
+    for (u32 row = 0; row < size; row++)
+    {
+        IVs ivs;
+        for (u8 &iv : ivs)
+        {
+            iv = rng.nextUShort(32);
+        }
+        u32 ec = rng.next();
+        u32 pid = rng.next();
+        u8 ability = rng.nextUShort(3);
+        u8 gender = rng.nextUShort(3);
+        u8 level = rng.nextUShort(100) + 1;
+        u8 nature = rng.nextUShort(25);
+        u8 shiny = rng.nextUShort(3);
+        states.emplace_back(row, ec, pid, ivs, ability, gender, level, nature, shiny, info);
+    }
+
+    // Results arrive in uneven chunks that do not line up with the batches
+    StateCandidates candidates;
+    for (u32 start = 0; start < size; start += 3001)
+    {
+        candidates.append(std::vector<GeneratorState>(states.begin() + start, states.begin() + std::min(start + 3001, size)));
+    }
+    QCOMPARE(candidates.size(), static_cast<size_t>(size));
+
+    std::vector<int> expected;
+    for (u32 row = first; row < size; row++)
+    {
+        if (stateFilter.compareState(static_cast<const State &>(states[row])))
+        {
+            expected.emplace_back(row);
+        }
+    }
+    QCOMPARE(candidates.filter(stateFilter, threads, first), expected);
+
+    candidates.clear();
+    QCOMPARE(candidates.size(), static_cast<size_t>(0));
+    QVERIFY(candidates.filter(stateFilter, threads).empty());
+}
@@ -0,0 +1,45 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef STATEFILTERTEST_HPP
+#define STATEFILTERTEST_HPP
+
+#include <QObject>
+
+class StateFilterTest : public QObject
+{
+    Q_OBJECT
+private slots:
+    void compareIV_data();
+    void compareIV();
+
+    void contains_data();
+    void contains();
+
+    void compareStates_data();
+    void compareStates();
+
+    void relaxed_data();
+    void relaxed();
+
+    void candidates_data();
+    void candidates();
+};
+
+#endif // STATEFILTERTEST_HPP
@@ -19,6 +19,7 @@
 
 #include <QDebug>
 #include <QTest>
+#include <Test/CLI/JobTest.hpp>
 #include <Test/Gen3/EggGenerator3Test.hpp>
 #include <Test/Gen3/GameCubeGeneratorTest.hpp>
 #include <Test/Gen3/GameCubeSearcherTest.hpp>
@@ -45,16 +46,25 @@
 #include <Test/Gen5/EventGenerator5Test.hpp>
 #include <Test/Gen5/HiddenGrottoGeneratorTest.hpp>
 #include <Test/Gen5/IDGenerator5Test.hpp>
+#include <Test/Gen5/IVCacheSearcherTest.hpp>
+#include <Test/Gen5/IVCacheTest.hpp>
+#include <Test/Gen5/IVSeedCacheTest.hpp>
 #include <Test/Gen5/ProfileSearcher5Test.hpp>
+#include <Test/Gen5/Searcher5Test.hpp>
 #include <Test/Gen5/StaticGenerator5Test.hpp>
+#include <Test/Gen5/Utilities5Test.hpp>
 #include <Test/Gen5/WildGenerator5Test.hpp>
 #include <Test/Gen8/EggGenerator8Test.hpp>
 #include <Test/Gen8/EventGenerator8Test.hpp>
 #include <Test/Gen8/IDGenerator8Test.hpp>
 #include <Test/Gen8/RaidGeneratorTest.hpp>
+#include <Test/Gen8/RaidSearcherTest.hpp>
+#include <Test/Gen8/Searcher8Test.hpp>
 #include <Test/Gen8/StaticGenerator8Test.hpp>
 #include <Test/Gen8/UndergroundGeneratorTest.hpp>
 #include <Test/Gen8/WildGenerator8Test.hpp>
+#include <Test/Model/SortFilterProxyModelTest.hpp>
+#include <Test/Model/TableStorageTest.hpp>
 #include <Test/RNG/LCRNG64Test.hpp>
 #include <Test/RNG/LCRNGReverseTest.hpp>
 #include <Test/RNG/LCRNGTest.hpp>
@@ -64,10 +74,15 @@
 #include <Test/RNG/TinyMTTest.hpp>
 #include <Test/RNG/XoroshiroTest.hpp>
 #include <Test/RNG/XorshiftTest.hpp>
+#include <Test/Util/AdvanceSearcherTest.hpp>
+#include <Test/Util/CheckpointTest.hpp>
 #include <Test/Util/DateTimeTest.hpp>
 #include <Test/Util/EncounterSlotTest.hpp>
 #include <Test/Util/IVCheckerTest.hpp>
 #include <Test/Util/IVToPIDCalculatorTest.hpp>
+#include <Test/Util/ResultStreamTest.hpp>
+#include <Test/Util/ShardTest.hpp>
+#include <Test/Util/StateFilterTest.hpp>
 
 template <class Testname>
 int runTest(QStringList &fails)
@@ -88,6 +103,9 @@ int main()
     int status = 0;
     QStringList fails;
 
+    // CLI
+    status += runTest<JobTest>(fails);
+
     // Gen 3
     status += runTest<EggGenerator3Test>(fails);
     status += runTest<GameCubeGeneratorTest>(fails);
@@ -119,8 +137,13 @@ int main()
     status += runTest<EventGenerator5Test>(fails);
     status += runTest<HiddenGrottoGeneratorTest>(fails);
     status += runTest<IDGenerator5Test>(fails);
+    status += runTest<IVCacheSearcherTest>(fails);
+    status += runTest<IVCacheTest>(fails);
+    status += runTest<IVSeedCacheTest>(fails);
     status += runTest<ProfileSearcher5Test>(fails);
+    status += runTest<Searcher5Test>(fails);
     status += runTest<StaticGenerator5Test>(fails);
+    status += runTest<Utilities5Test>(fails);
     status += runTest<WildGenerator5Test>(fails);
 
     // Gen 8
@@ -128,10 +151,16 @@ int main()
     status += runTest<EggGenerator8Test>(fails);
     status += runTest<EventGenerator8Test>(fails);
     status += runTest<RaidGeneratorTest>(fails);
+    status += runTest<RaidSearcherTest>(fails);
+    status += runTest<Searcher8Test>(fails);
     status += runTest<StaticGenerator8Test>(fails);
     status += runTest<UndergroundGeneratorTest>(fails);
     status += runTest<WildGenerator8Test>(fails);
 
+    // Model Tests
+    status += runTest<SortFilterProxyModelTest>(fails);
+    status += runTest<TableStorageTest>(fails);
+
     // RNG Tests
     status += runTest<LCRNGTest>(fails);
     status += runTest<LCRNGReverseTest>(fails);
@@ -147,12 +176,17 @@ int main()
     status += runTest<XorshiftTest>(fails);
 
     // Util Tests
+    status += runTest<AdvanceSearcherTest>(fails);
+    status += runTest<CheckpointTest>(fails);
     status += runTest<DateTest>(fails);
     status += runTest<DateTimeTest>(fails);
     status += runTest<TimeTest>(fails);
     status += runTest<EncounterSlotTest>(fails);
     status += runTest<IVCheckerTest>(fails);
     status += runTest<IVToPIDCalculatorTest>(fails);
+    status += runTest<ResultStreamTest>(fails);
+    status += runTest<ShardTest>(fails);
+    status += runTest<StateFilterTest>(fails);
 
     qDebug() << "";
     // Summary of failures at end for easy viewing
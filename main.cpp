@@ -18,6 +18,7 @@
  */
 
 #include <Core/Parents/ProfileLoader.hpp>
+#include <Core/Util/Startup.hpp>
 #include <Core/Util/Translator.hpp>
 #include <Form/MainWindow.hpp>
 #include <QApplication>
@@ -28,6 +29,8 @@
 #include <QStyleHints>
 #include <QThread>
 #include <QTranslator>
+#include <cstdlib>
+#include <iostream>
 
 /**
  * @brief Sets default settings for initial open or if settings get deleted
@@ -80,11 +83,22 @@ void validateSettings(QSettings &setting)
  */
 int main(int argc, char *argv[])
 {
+    // Set POKEFINDER_STARTUP to print how long each stage of startup takes
+    bool trace = std::getenv("POKEFINDER_STARTUP") != nullptr;
+    if (trace)
+    {
+        Startup::setHook([](const StartupStage &stage) {
+            std::cerr << stage.name << (stage.background ? " (background)" : "") << ": " << stage.duration.count() / 1000.0 << " ms"
+                      << std::endl;
+        });
+    }
+
     QApplication a(argc, argv);
     a.setApplicationName("PokeFinder");
     a.setOrganizationName("PokeFinder Team");
 
     Q_INIT_RESOURCE(resources);
+    Startup::mark("Application");
 
     QSettings setting;
     setting.beginGroup("settings");
@@ -92,6 +106,7 @@ int main(int argc, char *argv[])
 
     QString profilePath = setting.value("profiles").toString();
     bool profile = ProfileLoader::init(profilePath.toStdWString());
+    Startup::mark("Settings");
 
     a.setStyle("fusion");
     if (setting.value("style").toString() == "dark")
@@ -104,18 +119,29 @@ int main(int argc, char *argv[])
         auto *hints = a.styleHints();
         hints->setColorScheme(Qt::ColorScheme::Light);
     }
+    Startup::mark("Style");
 
     QString locale = setting.value("locale").toString();
     Translator::init(locale.toStdString());
+    Startup::background("Strings", [] { Translator::load(); });
 
     QTranslator translator;
     if (translator.load(QString(":/i18n/PokeFinder_%1.qm").arg(locale)))
     {
         QApplication::installTranslator(&translator);
     }
+    Startup::mark("Translations");
 
     MainWindow w(profile);
     w.show();
+    Startup::mark("Main window");
+
+    if (!Startup::finish() && trace)
+    {
+        std::cerr << "Startup exceeded the " << Startup::budget.count() << " ms budget" << std::endl;
+    }
 
-    return a.exec();
+    int code = a.exec();
+    Startup::wait();
+    return code;
 }